@@ -0,0 +1,202 @@
+# Distributed System of Equations Check
+
+# the brick column of common.tcl, with nodal masses, under an explicit
+# analysis solved with the Diagonal system, and under a static load
+# solved with the ProfileSPD and BandGeneral systems. Run first with the
+# sequential interpreter, which writes the displacements to
+# DistributedSOE.base, then on several local processes, which partitions
+# the domain and solves with DistributedDiagonalSOE,
+# DistributedProfileSPDLinSOE and DistributedBandGenLinSOE:
+#
+#     OpenSees DistributedSOE.tcl
+#     mpirun -np 4 OpenSeesSP DistributedSOE.tcl
+#
+# the parallel run must reproduce the sequential displacements.
+
+puts "DistributedSOE.tcl: Check of the distributed systems against a sequential run"
+
+set baseFile DistributedSOE.base
+set tol 1.0e-10
+
+set numP [getNP]
+
+source common.tcl
+set nz 8
+
+set dx [expr $d/($nx*1.0)]
+set dy [expr $b/($ny*1.0)]
+set dz [expr $L/($nz*1.0)]
+set numNode [expr ($nx+1)*($ny+1)*($nz+1)]
+
+proc buildColumn {} {
+    global nx ny nz dx dy dz
+
+    wipe
+    model Basic -ndm 3 -ndf 3
+
+    nDMaterial ElasticIsotropic 1 30000. 0.2
+
+    set counter 1
+    for {set i 0} {$i <= $nz} {incr i 1} {
+	for {set j 0} {$j <= $ny} {incr j 1} {
+	    for {set k 0} {$k <= $nx} {incr k 1} {
+		node $counter [expr $k*$dx] [expr $j*$dy] [expr $i*$dz]
+		mass $counter 1000.0 1000.0 1000.0
+		incr counter
+	    }
+	}
+    }
+
+    set counter 1
+    for {set i 0} {$i < $nz} {incr i 1} {
+	for {set j 0} {$j < $ny} {incr j 1} {
+	    set iNode [expr $i*($nx+1)*($ny+1) + 1 + $j*($nx+1)]
+	    set jNode [expr $iNode+1]
+	    set lNode [expr $iNode+($nx+1)]
+	    set kNode [expr $lNode+1]
+	    set mNode [expr ($i+1)*($nx+1)*($ny+1) + 1 + $j*($nx+1)]
+	    set nNode [expr $mNode+1]
+	    set pNode [expr $mNode+($nx+1)]
+	    set oNode [expr $pNode+1]
+	    for {set k 0} {$k < $nx} {incr k 1} {
+		element stdBrick $counter $iNode $jNode $kNode $lNode $mNode $nNode $oNode $pNode 1
+		incr counter
+		incr iNode 1
+		incr jNode 1
+		incr kNode 1
+		incr lNode 1
+		incr mNode 1
+		incr nNode 1
+		incr oNode 1
+		incr pNode 1
+	    }
+	}
+    }
+
+    fixZ 0.0 1 1 1
+}
+
+# displacement history of the top corner in x and y
+proc runExplicit {} {
+    global numNode
+
+    buildColumn
+    timeSeries Trig 1 0.0 10.0 0.5 -factor 10.0
+    pattern Plain 1 1 {
+	load $numNode 10.0 10.0 0.0
+    }
+
+    numberer Plain
+    constraints Plain
+    system Diagonal
+    algorithm Linear
+    integrator CentralDifference
+    analysis Transient
+
+    set disp {}
+    for {set i 0} {$i < 200} {incr i 1} {
+	if {[analyze 1 0.002] != 0} {
+	    return {}
+	}
+	lappend disp [nodeDisp $numNode 1] [nodeDisp $numNode 2]
+    }
+    return $disp
+}
+
+# displacements of the top face in x and y under a static load
+proc runStatic {system} {
+    global nx ny nz numNode
+
+    buildColumn
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	load $numNode 10.0 10.0 0.0
+    }
+
+    numberer Plain
+    constraints Plain
+    system $system
+    algorithm Linear
+    integrator LoadControl 1.0
+    analysis Static
+
+    if {[analyze 1] != 0} {
+	return {}
+    }
+    set disp {}
+    for {set node [expr $nz*($nx+1)*($ny+1)+1]} {$node <= $numNode} {incr node 1} {
+	lappend disp [nodeDisp $node 1] [nodeDisp $node 2]
+    }
+    return $disp
+}
+
+# system and displacements of each case
+set results [list Diagonal [runExplicit]]
+foreach system {ProfileSPD BandGeneral} {
+    lappend results $system [runStatic $system]
+}
+wipe
+
+set testOK 0
+
+if {$numP == 1} {
+    # sequential run, write the baseline
+    set fileID [open $baseFile w]
+    foreach {case disp} $results {
+	puts $fileID "$case $disp"
+    }
+    close $fileID
+    puts "wrote the sequential results to $baseFile, now run with mpirun -np 4 OpenSeesSP"
+
+} elseif {[file exists $baseFile] == 0} {
+    puts "failed: no $baseFile, run with the sequential interpreter first"
+    set testOK -1
+} else {
+    set fileID [open $baseFile r]
+    while {[gets $fileID line] >= 0} {
+	if {[llength $line] > 0} {
+	    set base([lindex $line 0]) [lrange $line 1 end]
+	}
+    }
+    close $fileID
+
+    set formatString {%12s%20s%20s}
+    puts [format $formatString System MaxDisp MaxDifference]
+    set formatString {%12s%20.10e%20.3e}
+    foreach {case disp} $results {
+	if {[info exists base($case)] == 0 || [llength $disp] == 0} {
+	    puts "failed: $case analysis"
+	    set testOK -1
+	    continue
+	}
+	set baseDisp $base($case)
+	if {[llength $baseDisp] != [llength $disp]} {
+	    puts "failed: $case has [llength $disp] values, $baseFile [llength $baseDisp]"
+	    set testOK -1
+	    continue
+	}
+	set maxDisp 0.0
+	set maxDiff 0.0
+	foreach u $baseDisp v $disp {
+	    if {abs($u) > $maxDisp} {set maxDisp [expr abs($u)]}
+	    if {abs($u-$v) > $maxDiff} {set maxDiff [expr abs($u-$v)]}
+	}
+	puts [format $formatString $case $maxDisp $maxDiff]
+	if {$maxDisp == 0.0 || $maxDiff > $tol*$maxDisp} {
+	    set testOK -1
+	    puts "failed $case with $numP processes -> $maxDiff [expr $tol*$maxDisp]"
+	}
+    }
+}
+
+if {$numP != 1} {
+    set resultsFile [open results.out a+]
+    if {$testOK == 0} {
+	puts "\nPASSED Check DistributedSOE.tcl on $numP processes \n\n"
+	puts $resultsFile "PASSED : DistributedSOE.tcl"
+    } else {
+	puts "\nFAILED Check DistributedSOE.tcl on $numP processes \n\n"
+	puts $resultsFile "FAILED : DistributedSOE.tcl"
+    }
+    close $resultsFile
+}
@@ -0,0 +1,111 @@
+# Condensed Substructure Example
+
+# a 2d portal frame of elastic beams whose left column (two elements,
+# fixed at the base) is replaced by a condensedSubstructure retaining
+# only the column top. Static condensation is exact for a linear
+# substructure, so the flexibility of the frame at the column top and
+# at the opposite corner, found with a unit load on each dof of the
+# column top, must be that of the full model.
+
+puts "CondensedSubstructure.tcl: Verification of condensedSubstructure against the full model"
+
+set tol 1.0e-10
+
+proc buildFrame {condensed} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+
+    node 1    0.0   0.0
+    node 2    0.0  72.0
+    node 3    0.0 144.0
+    node 4  360.0   0.0
+    node 5  360.0  72.0
+    node 6  360.0 144.0
+    node 7  180.0 144.0
+
+    fix 1 1 1 1
+    fix 4 1 1 1
+
+    geomTransf Linear 1
+    element elasticBeamColumn 1 1 2 20.0 29000. 1400. 1
+    element elasticBeamColumn 2 2 3 20.0 29000. 1400. 1
+    element elasticBeamColumn 3 4 5 20.0 29000. 1400. 1
+    element elasticBeamColumn 4 5 6 20.0 29000. 1400. 1
+    element elasticBeamColumn 5 3 7 30.0 29000. 2000. 1
+    element elasticBeamColumn 6 7 6 30.0 29000. 2000. 1
+
+    if {$condensed == 1} {
+	region 1 -ele 1 2
+	element condensedSubstructure 10 -region 1
+    }
+
+    numberer Plain
+    constraints Plain
+    algorithm Linear
+    system BandGeneral
+    integrator LoadControl 1.0
+    analysis Static
+}
+
+# displacements of nodes 3 and 6 under a unit load on each dof of node 3
+proc frameFlexibility {condensed} {
+    set flex {}
+    foreach load {{1.0 0.0 0.0} {0.0 1.0 0.0} {0.0 0.0 1.0}} {
+	buildFrame $condensed
+	timeSeries Linear 1
+	pattern Plain 1 1 "load 3 $load"
+	if {[analyze 1] != 0} {
+	    return {}
+	}
+	foreach node {3 6} {
+	    for {set dof 1} {$dof <= 3} {incr dof 1} {
+		lappend flex [nodeDisp $node $dof]
+	    }
+	}
+    }
+    return $flex
+}
+
+set testOK 0
+
+set fullFlex [frameFlexibility 0]
+set condensedFlex [frameFlexibility 1]
+
+if {[llength $fullFlex] != 18 || [llength $condensedFlex] != 18} {
+    puts "failed: analysis"
+    set testOK -1
+} else {
+    set maxFlex 0.0
+    foreach full $fullFlex {
+	if {abs($full) > $maxFlex} {set maxFlex [expr abs($full)]}
+    }
+
+    set formatString {%6s%5s%5s%20s%20s}
+    puts [format $formatString Load Node DOF Full Condensed]
+    set formatString {%6d%5d%5d%20.10e%20.10e}
+    set count 0
+    for {set load 1} {$load <= 3} {incr load 1} {
+	foreach node {3 6} {
+	    for {set dof 1} {$dof <= 3} {incr dof 1} {
+		set full [lindex $fullFlex $count]
+		set cond [lindex $condensedFlex $count]
+		puts [format $formatString $load $node $dof $full $cond]
+		if {[expr abs($full-$cond)] > $tol*$maxFlex} {
+		    set testOK -1
+		    puts "failed load $load node $node dof $dof -> [expr abs($full-$cond)]"
+		}
+		incr count 1
+	    }
+	}
+    }
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test CondensedSubstructure.tcl \n\n"
+    puts $results "PASSED : CondensedSubstructure.tcl"
+} else {
+    puts "\nFAILED Verification Test CondensedSubstructure.tcl \n\n"
+    puts $results "FAILED : CondensedSubstructure.tcl"
+}
+close $results
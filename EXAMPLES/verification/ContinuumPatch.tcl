@@ -0,0 +1,163 @@
+# Continuum Patch Test Example
+
+# a unit cube (unit square in 2d) on rollers under a uniform tension
+# sigma in x; every element that passes the constant strain patch test
+# gives the exact displacements u = sigma x/E, v = -nu sigma y/E and
+# w = -nu sigma z/E. Checked for stdBrick, bbarBrick, quad and
+# FourNodeTetrahedron (six tets), and for stdBrick again after the cube
+# is stretched to length 2 with setNodeCoord.
+
+puts "ContinuumPatch.tcl: Verification of brick, quad and tet elements under uniform stress"
+
+set E 1000.0
+set nu 0.25
+set sigma 10.0
+set tol 1.0e-10
+
+set testOK 0
+
+proc checkDisp {name node dof exact} {
+    global testOK tol
+    set osDisp [nodeDisp $node $dof]
+    puts [format {%12s%6d%5d%18.10f%18.10f} $name $node $dof $osDisp $exact]
+    if {[expr abs($osDisp-$exact)] > $tol} {
+	set testOK -1
+	puts "failed $name node $node dof $dof -> [expr abs($osDisp-$exact)] $tol"
+    }
+}
+
+proc runStatic {} {
+    numberer Plain
+    constraints Plain
+    algorithm Linear
+    system BandGeneral
+    integrator LoadControl 1.0
+    analysis Static
+    return [analyze 1]
+}
+
+# nodes of the cube are 1 + x + 2y + 4z, for x, y, z = 0 or 1
+proc buildCube {length} {
+    wipe
+    model Basic -ndm 3 -ndf 3
+    for {set k 0} {$k < 2} {incr k 1} {
+	for {set j 0} {$j < 2} {incr j 1} {
+	    for {set i 0} {$i < 2} {incr i 1} {
+		node [expr 1+$i+2*$j+4*$k] [expr $i*$length] [expr $j*1.0] [expr $k*1.0]
+	    }
+	}
+    }
+    # rollers on the faces x = 0, y = 0 and z = 0
+    fix 1 1 1 1
+    fix 2 0 1 1
+    fix 3 1 0 1
+    fix 4 0 0 1
+    fix 5 1 1 0
+    fix 6 0 1 0
+    fix 7 1 0 0
+
+    global E nu
+    nDMaterial ElasticIsotropic 1 $E $nu
+}
+
+proc checkCube {name length} {
+    global E nu sigma
+    for {set k 0} {$k < 2} {incr k 1} {
+	for {set j 0} {$j < 2} {incr j 1} {
+	    for {set i 0} {$i < 2} {incr i 1} {
+		set node [expr 1+$i+2*$j+4*$k]
+		checkDisp $name $node 1 [expr $sigma*$i*$length/$E]
+		checkDisp $name $node 2 [expr -$nu*$sigma*$j/$E]
+		checkDisp $name $node 3 [expr -$nu*$sigma*$k/$E]
+	    }
+	}
+    }
+}
+
+puts [format {%12s%6s%5s%18s%18s} Element Node DOF OpenSees Exact]
+
+# stdBrick and bbarBrick, the load on the face x = L shared by 4 nodes
+foreach eleType {stdBrick bbarBrick} {
+    buildCube 1.0
+    element $eleType 1 1 2 4 3 5 6 8 7 1
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	foreach node {2 4 6 8} {load $node [expr $sigma/4.0] 0.0 0.0}
+    }
+    if {[runStatic] != 0} {
+	puts "failed: $eleType analysis"
+	set testOK -1
+    }
+    checkCube $eleType 1.0
+}
+
+# stdBrick stretched to length 2 after its shape functions were formed
+buildCube 1.0
+element stdBrick 1 1 2 4 3 5 6 8 7 1
+timeSeries Linear 1
+pattern Plain 1 1 {
+    foreach node {2 4 6 8} {load $node [expr $sigma/4.0] 0.0 0.0}
+}
+runStatic
+reset
+foreach node {2 4 6 8} {setNodeCoord $node 1 2.0}
+if {[analyze 1] != 0} {
+    puts "failed: setNodeCoord analysis"
+    set testOK -1
+}
+checkCube setNodeCoord 2.0
+
+# six tets of positive volume sharing the diagonal from node 1 to node 8;
+# the face x = 1 is split along the diagonal from node 2 to node 8
+buildCube 1.0
+element FourNodeTetrahedron 1 1 2 4 8 1
+element FourNodeTetrahedron 2 1 2 8 6 1
+element FourNodeTetrahedron 3 1 3 8 4 1
+element FourNodeTetrahedron 4 1 3 7 8 1
+element FourNodeTetrahedron 5 1 5 6 8 1
+element FourNodeTetrahedron 6 1 5 8 7 1
+timeSeries Linear 1
+pattern Plain 1 1 {
+    foreach node {2 8} {load $node [expr $sigma/3.0] 0.0 0.0}
+    foreach node {4 6} {load $node [expr $sigma/6.0] 0.0 0.0}
+}
+if {[runStatic] != 0} {
+    puts "failed: FourNodeTetrahedron analysis"
+    set testOK -1
+}
+checkCube FourNodeTetrahedron 1.0
+
+# quad in plane stress, unit thickness
+wipe
+model Basic -ndm 2 -ndf 2
+node 1 0.0 0.0
+node 2 1.0 0.0
+node 3 1.0 1.0
+node 4 0.0 1.0
+fix 1 1 1
+fix 2 0 1
+fix 4 1 0
+nDMaterial ElasticIsotropic 1 $E $nu
+element quad 1 1 2 3 4 1.0 PlaneStress 1
+timeSeries Linear 1
+pattern Plain 1 1 {
+    foreach node {2 3} {load $node [expr $sigma/2.0] 0.0}
+}
+if {[runStatic] != 0} {
+    puts "failed: quad analysis"
+    set testOK -1
+}
+foreach {node x y} {1 0 0 2 1 0 3 1 1 4 0 1} {
+    checkDisp quad $node 1 [expr $sigma*$x/$E]
+    checkDisp quad $node 2 [expr -$nu*$sigma*$y/$E]
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ContinuumPatch.tcl \n\n"
+    puts $results "PASSED : ContinuumPatch.tcl"
+} else {
+    puts "\nFAILED Verification Test ContinuumPatch.tcl \n\n"
+    puts $results "FAILED : ContinuumPatch.tcl"
+}
+close $results
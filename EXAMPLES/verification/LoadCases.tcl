@@ -0,0 +1,111 @@
+# Linear Load Cases Example
+
+# compares the displacements of a 2d frame under three load patterns
+# obtained with analyzeLoadCases, which factors the stiffness once for
+# all the patterns, with those of a separate analysis for each pattern
+
+puts "LoadCases.tcl: Verification of analyzeLoadCases against one analysis per load case"
+
+set tol 1.0e-10
+set caseDisp "LoadCases.out"
+
+# portal frame with an inclined brace, all elements elastic
+proc buildFrame {} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+
+    node 1    0.0   0.0
+    node 2  360.0   0.0
+    node 3    0.0 144.0
+    node 4  360.0 144.0
+
+    fix 1 1 1 1
+    fix 2 1 1 0
+
+    geomTransf Linear 1
+    element elasticBeamColumn 1 1 3 20.0 29000. 1400. 1
+    element elasticBeamColumn 2 2 4 20.0 29000. 1400. 1
+    element elasticBeamColumn 3 3 4 30.0 29000. 2000. 1
+    element elasticBeamColumn 4 1 4  5.0 29000.   10. 1
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	load 3 10.0 0.0 0.0
+    }
+    pattern Plain 2 1 {
+	load 3 0.0 -50.0 0.0
+	load 4 0.0 -50.0 0.0
+    }
+    pattern Plain 3 1 {
+	load 4 -5.0 0.0 200.0
+    }
+
+    numberer RCM
+    constraints Plain
+    algorithm Linear
+    system BandGeneral
+    integrator LoadControl 1.0
+    analysis Static
+}
+
+# analyzeLoadCases: one line of displacements per case in the recorder
+buildFrame
+recorder Node -file $caseDisp -precision 16 -node 3 4 -dof 1 2 3 disp
+analyzeLoadCases 1 2 3
+remove recorders
+
+set fileID [open $caseDisp r]
+set batchResults {}
+while {[gets $fileID line] >= 0} {
+    if {[llength $line] > 0} {
+	lappend batchResults $line
+    }
+}
+close $fileID
+file delete $caseDisp
+
+set testOK 0
+if {[llength $batchResults] != 3} {
+    puts "failed: expected 3 load cases, recorded [llength $batchResults]"
+    set testOK -1
+}
+
+# one analysis per case, with only that load pattern in the model
+set formatString {%6s%5s%5s%18s%18s}
+puts [format $formatString Case Node DOF analyzeLoadCases analyze]
+set formatString {%6d%5d%5d%18.10f%18.10f}
+
+for {set case 1} {$case <= 3 && $testOK == 0} {incr case 1} {
+    buildFrame
+    foreach pattern {1 2 3} {
+	if {$pattern != $case} {
+	    remove loadPattern $pattern
+	}
+    }
+    analyze 1
+
+    set batch [lindex $batchResults [expr $case-1]]
+    set count 0
+    foreach node {3 4} {
+	for {set dof 1} {$dof <= 3} {incr dof 1} {
+	    set batchDisp [lindex $batch $count]
+	    set osDisp [nodeDisp $node $dof]
+	    puts [format $formatString $case $node $dof $batchDisp $osDisp]
+	    if {[expr abs($batchDisp-$osDisp)] > $tol*(1.0+abs($osDisp))} {
+		set testOK -1
+		puts "failed case $case node $node dof $dof"
+	    }
+	    incr count 1
+	}
+    }
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test LoadCases.tcl \n\n"
+    puts $results "PASSED : LoadCases.tcl"
+} else {
+    puts "\nFAILED Verification Test LoadCases.tcl \n\n"
+    puts $results "FAILED : LoadCases.tcl"
+}
+close $results
@@ -0,0 +1,116 @@
+# Modal Superposition Example
+
+# a linear 3 dof chain under a harmonic load on the top mass with
+# Rayleigh damping, and the same chain with truss mass under a harmonic
+# ground acceleration. With all 3 modes the ModalSuperposition integrator
+# advances the modal equations with the same Newmark recurrence as the
+# full model, so the displacements must match those of Newmark.
+
+puts "ModalSuperposition.tcl: Verification of ModalSuperposition against Newmark"
+
+set numStep 500
+set dt 0.01
+set tol 1.0e-9
+
+set testOK 0
+
+# nodes 1 to 4, fixed at node 1; springs with nodal masses, or trusses
+# carrying the mass
+proc buildChain {withTrussMass} {
+    wipe
+    model Basic -ndm 1 -ndf 1
+
+    for {set i 1} {$i <= 4} {incr i 1} {
+	node $i [expr $i-1.0]
+    }
+    fix 1 1
+
+    uniaxialMaterial Elastic 1 400.0
+    uniaxialMaterial Elastic 2 250.0
+    uniaxialMaterial Elastic 3 150.0
+
+    if {$withTrussMass == 0} {
+	mass 2 2.0
+	mass 3 1.5
+	mass 4 1.0
+	element zeroLength 1 1 2 -mat 1 -dir 1 -doRayleigh 1
+	element zeroLength 2 2 3 -mat 2 -dir 1 -doRayleigh 1
+	element zeroLength 3 3 4 -mat 3 -dir 1 -doRayleigh 1
+
+	timeSeries Trig 1 0.0 10.0 0.7 -factor 50.0
+	pattern Plain 1 1 {
+	    load 4 1.0
+	}
+	rayleigh 0.2 0.002 0.0 0.0
+    } else {
+	element Truss 1 1 2 1.0 1 -rho 2.0
+	element Truss 2 2 3 1.0 2 -rho 1.5
+	element Truss 3 3 4 1.0 3 -rho 1.0
+
+	timeSeries Trig 1 0.0 10.0 0.4 -factor 100.0
+	pattern UniformExcitation 1 1 -accel 1
+    }
+
+    constraints Plain
+    numberer Plain
+    system BandGeneral
+    test NormDispIncr 1.0e-12 10
+    algorithm Linear
+}
+
+# displacement of the top node at every step
+proc runChain {withTrussMass integrator} {
+    global numStep dt
+
+    buildChain $withTrussMass
+    eval "integrator $integrator"
+    analysis Transient
+    if {[lindex $integrator 0] == "ModalSuperposition"} {
+	eigen -fullGenLapack 3
+    }
+
+    set disp {}
+    for {set i 0} {$i < $numStep} {incr i 1} {
+	if {[analyze 1 $dt] != 0} {
+	    return {}
+	}
+	lappend disp [nodeDisp 4 1]
+    }
+    return $disp
+}
+
+set formatString {%20s%20s%20s%20s}
+puts [format $formatString Case Newmark ModalSuperposition Difference]
+set formatString {%20s%20.10f%20.10f%20.3e}
+
+foreach {case withTrussMass} {NodalLoad 0 UniformExcitation 1} {
+    set exact [runChain $withTrussMass "Newmark 0.5 0.25"]
+    set modal [runChain $withTrussMass "ModalSuperposition 0.5 0.25"]
+    if {[llength $modal] != $numStep || [llength $exact] != $numStep} {
+	puts "failed: $case analysis"
+	set testOK -1
+	continue
+    }
+
+    set maxDisp 0.0
+    set maxDiff 0.0
+    foreach u $exact v $modal {
+	if {abs($u) > $maxDisp} {set maxDisp [expr abs($u)]}
+	if {abs($u-$v) > $maxDiff} {set maxDiff [expr abs($u-$v)]}
+    }
+    puts [format $formatString $case [lindex $exact end] [lindex $modal end] $maxDiff]
+    if {$maxDisp == 0.0 || $maxDiff > $tol*$maxDisp} {
+	set testOK -1
+	puts "failed $case -> $maxDiff [expr $tol*$maxDisp]"
+    }
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ModalSuperposition.tcl \n\n"
+    puts $results "PASSED : ModalSuperposition.tcl"
+} else {
+    puts "\nFAILED Verification Test ModalSuperposition.tcl \n\n"
+    puts $results "FAILED : ModalSuperposition.tcl"
+}
+close $results
@@ -0,0 +1,94 @@
+# Indefinite ProfileSPD Example
+
+# a 1d chain of 300 nodes, each connected to the 8 nodes before it by
+# trusses, with one truss of negative stiffness between nodes 150 and 151;
+# the stiffness matrix is not positive definite and its factorization
+# without pivoting has a negative pivot at node 150. ProfileSPD factors
+# systems of this size in panels and must give the same displacements as
+# BandGeneral, which pivots.
+
+puts "ProfileSPDIndefinite.tcl: Verification of ProfileSPD with a negative pivot"
+
+set numNode 300
+set band 8
+set tol 1.0e-8
+
+proc buildChain {system} {
+    global numNode band
+
+    wipe
+    model Basic -ndm 1 -ndf 1
+
+    for {set i 0} {$i <= $numNode} {incr i 1} {
+	node $i [expr $i*1.0]
+    }
+    fix 0 1
+
+    uniaxialMaterial Elastic 1 1.0
+    uniaxialMaterial Elastic 2 -10.0
+
+    set eleTag 1
+    for {set i 1} {$i <= $numNode} {incr i 1} {
+	for {set k 1} {$k <= $band && $i-$k >= 0} {incr k 1} {
+	    element Truss $eleTag [expr $i-$k] $i 1.0 1
+	    incr eleTag 1
+	}
+    }
+    element Truss $eleTag 150 151 1.0 2
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	load 100 1.0
+	load $numNode 1.0
+    }
+
+    numberer Plain
+    constraints Plain
+    algorithm Linear
+    system $system
+    integrator LoadControl 1.0
+    analysis Static
+
+    return [analyze 1]
+}
+
+set testOK 0
+
+if {[buildChain BandGeneral] != 0} {
+    puts "failed: BandGeneral analysis"
+    set testOK -1
+}
+set bandDisp {}
+for {set i 1} {$i <= $numNode} {incr i 1} {
+    lappend bandDisp [nodeDisp $i 1]
+}
+
+if {[buildChain ProfileSPD] != 0} {
+    puts "failed: ProfileSPD analysis"
+    set testOK -1
+}
+
+set formatString {%10s%20s%20s}
+puts [format $formatString Node ProfileSPD BandGeneral]
+set formatString {%10d%20.10f%20.10f}
+for {set i 1} {$i <= $numNode && $testOK == 0} {incr i 1} {
+    set exactResult [lindex $bandDisp [expr $i-1]]
+    set osDisp [nodeDisp $i 1]
+    if {$i % 50 == 0} {
+	puts [format $formatString $i $osDisp $exactResult]
+    }
+    if {[expr abs($osDisp-$exactResult)] > $tol*(1.0+abs($exactResult))} {
+	set testOK -1
+	puts "failed node $i -> [expr abs($osDisp-$exactResult)] $tol"
+    }
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ProfileSPDIndefinite.tcl \n\n"
+    puts $results "PASSED : ProfileSPDIndefinite.tcl"
+} else {
+    puts "\nFAILED Verification Test ProfileSPDIndefinite.tcl \n\n"
+    puts $results "FAILED : ProfileSPDIndefinite.tcl"
+}
+close $results
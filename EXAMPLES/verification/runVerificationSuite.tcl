@@ -8,6 +8,11 @@ close $results
 source sdofTransient.tcl
 source PlanarTruss.tcl
 source PlanarTruss.Extra.tcl
+source LoadCases.tcl
+source ProfileSPDIndefinite.tcl
+source ContinuumPatch.tcl
+source ModalSuperposition.tcl
+source CondensedSubstructure.tcl
 source PortalFrame2d.tcl
 source EigenFrame.tcl
 source EigenFrame.Extra.tcl
@@ -75,3 +75,58 @@ Channel::recvMsgUnknownSize(int dataTag, int commitTag, Message &, ChannelAddres
     return -1;
 }
 
+
+int
+Channel::isendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+    int res = this->sendMatrix(dbTag, commitTag, theMatrix, theAddress);
+    return (res < 0) ? res : 0;
+}
+
+int
+Channel::irecvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+    int res = this->recvMatrix(dbTag, commitTag, theMatrix, theAddress);
+    return (res < 0) ? res : 0;
+}
+
+int
+Channel::isendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+    int res = this->sendVector(dbTag, commitTag, theVector, theAddress);
+    return (res < 0) ? res : 0;
+}
+
+int
+Channel::irecvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+    int res = this->recvVector(dbTag, commitTag, theVector, theAddress);
+    return (res < 0) ? res : 0;
+}
+
+int
+Channel::isendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+    int res = this->sendID(dbTag, commitTag, theID, theAddress);
+    return (res < 0) ? res : 0;
+}
+
+int
+Channel::irecvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+    int res = this->recvID(dbTag, commitTag, theID, theAddress);
+    return (res < 0) ? res : 0;
+}
+
+// the data of the default methods has already been sent or received
+int
+Channel::wait(int request)
+{
+    return 0;
+}
+
+int
+Channel::waitAll(void)
+{
+    return 0;
+}
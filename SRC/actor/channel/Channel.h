@@ -109,6 +109,31 @@ class Channel
 		    ID &theID, 
 		    ChannelAddress *theAddress =0) =0;      
 
+    // non-blocking methods, these return a request to be passed to
+    // wait() before the data may be used or changed. The default
+    // methods invoke the blocking methods and return request 0.
+    virtual int isendMatrix(int dbTag, int commitTag, 
+			const Matrix &theMatrix, 
+			ChannelAddress *theAddress =0);  
+    virtual int irecvMatrix(int dbTag, int commitTag, 
+			Matrix &theMatrix, 
+			ChannelAddress *theAddress =0);  
+    virtual int isendVector(int dbTag, int commitTag, 
+			const Vector &theVector, 
+			ChannelAddress *theAddress =0);  
+    virtual int irecvVector(int dbTag, int commitTag, 
+			Vector &theVector, 
+			ChannelAddress *theAddress =0);  
+    virtual int isendID(int dbTag, int commitTag, 
+		    const ID &theID, 
+		    ChannelAddress *theAddress =0);  
+    virtual int irecvID(int dbTag, int commitTag, 
+		    ID &theID, 
+		    ChannelAddress *theAddress =0);      
+
+    virtual int wait(int request);
+    virtual int waitAll(void);
+
   protected:
     
   private:
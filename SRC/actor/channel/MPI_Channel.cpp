@@ -472,6 +472,156 @@ MPI_Channel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *t
 }
 
 
+int
+MPI_Channel::setAddress(ChannelAddress *theAddress, const char *method)
+{
+    if (theAddress != 0) {
+      if (theAddress->getType() == MPI_TYPE) {
+	MPI_ChannelAddress *theMPI_ChannelAddress = (MPI_ChannelAddress *)theAddress;
+	otherTag = theMPI_ChannelAddress->otherTag;
+	otherComm= theMPI_ChannelAddress->otherComm;
+      } else {
+	opserr << "MPI_Channel::" << method << "() - a MPI_Channel ";
+	opserr << "can only communicate with a MPI_Channel";
+	opserr << " address given is not of type MPI_ChannelAddress\n"; 
+	return -1;	    
+      }		    
+    }
+    return 0;
+}
+
+
+// int post(void *, int, MPI_Datatype, bool):
+//	posts a non-blocking send or receive and returns the number
+//	of the request, a request that has been waited on is reused.
+int
+MPI_Channel::post(void *data, int size, MPI_Datatype type, bool send)
+{
+    int request = 0;
+    int numRequests = requests.size();
+    while (request < numRequests && requests[request] != MPI_REQUEST_NULL)
+      request++;
+
+    if (request == numRequests) {
+      requests.push_back(MPI_REQUEST_NULL);
+      requestSizes.push_back(-1);
+      requestTypes.push_back(type);
+    }
+
+    int res;
+    if (send == true)
+      res = MPI_Isend(data, size, type, otherTag, 0, otherComm, &requests[request]);
+    else
+      res = MPI_Irecv(data, size, type, otherTag, 0, otherComm, &requests[request]);
+
+    if (res != MPI_SUCCESS) {
+      opserr << "MPI_Channel::post() - failed to post a non-blocking ";
+      opserr << (send ? "send\n" : "recv\n");
+      requests[request] = MPI_REQUEST_NULL;
+      return -1;
+    }
+
+    requestSizes[request] = send ? -1 : size;
+    requestTypes[request] = type;
+
+    return request;
+}
+
+
+int 
+MPI_Channel::isendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+    if (this->setAddress(theAddress, "isendMatrix") < 0)
+      return -1;
+    return this->post((void *)theMatrix.data, theMatrix.dataSize, MPI_DOUBLE, true);
+}
+
+int 
+MPI_Channel::irecvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+    if (this->setAddress(theAddress, "irecvMatrix") < 0)
+      return -1;
+    return this->post((void *)theMatrix.data, theMatrix.dataSize, MPI_DOUBLE, false);
+}
+
+int 
+MPI_Channel::isendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+    if (this->setAddress(theAddress, "isendVector") < 0)
+      return -1;
+    return this->post((void *)theVector.theData, theVector.sz, MPI_DOUBLE, true);
+}
+
+int 
+MPI_Channel::irecvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+    if (this->setAddress(theAddress, "irecvVector") < 0)
+      return -1;
+    return this->post((void *)theVector.theData, theVector.sz, MPI_DOUBLE, false);
+}
+
+int 
+MPI_Channel::isendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+    if (this->setAddress(theAddress, "isendID") < 0)
+      return -1;
+    return this->post((void *)theID.data, theID.sz, MPI_INT, true);
+}
+
+int 
+MPI_Channel::irecvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+    if (this->setAddress(theAddress, "irecvID") < 0)
+      return -1;
+    return this->post((void *)theID.data, theID.sz, MPI_INT, false);
+}
+
+
+// int wait(int request):
+//	waits for the request to complete; for a recv checks that the
+//	number of entries received is the number expected.
+int
+MPI_Channel::wait(int request)
+{
+    if (request < 0 || request >= (int)requests.size()) {
+      opserr << "MPI_Channel::wait() - no request " << request << endln;
+      return -1;
+    }
+
+    if (requests[request] == MPI_REQUEST_NULL)
+      return 0;
+
+    MPI_Status status;
+    MPI_Wait(&requests[request], &status);
+
+    int size = requestSizes[request];
+    requestSizes[request] = -1;
+    if (size >= 0) {
+      int count = 0;
+      MPI_Get_count(&status, requestTypes[request], &count);
+      if (count != size) {
+	opserr << "MPI_Channel::wait() -";
+	opserr << " incorrect number of entries received: " << count << " expected: " << size << endln;
+	return -1;
+      }
+    }
+
+    return 0;
+}
+
+int
+MPI_Channel::waitAll(void)
+{
+    int result = 0;
+    int numRequests = requests.size();
+    for (int i=0; i<numRequests; i++)
+      if (this->wait(i) < 0)
+	result = -1;
+
+    return result;
+}
+
+
 /*
 int 
 MPI_Channel::getPortNumber(void) const
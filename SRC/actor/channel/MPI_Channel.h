@@ -36,6 +36,7 @@
 
 #include <mpi.h>
 #include <Channel.h>
+#include <vector>
 
 class MPI_Channel : public Channel
 {
@@ -74,12 +75,33 @@ class MPI_Channel : public Channel
     int sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress =0);
     int recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress =0);    
     
+    // non-blocking communication with MPI_Isend and MPI_Irecv
+    int isendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress =0);
+    int irecvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress =0);
+    
+    int isendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress =0);
+    int irecvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress =0);
+    
+    int isendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress =0);
+    int irecvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress =0);    
+
+    int wait(int request);
+    int waitAll(void);
     
   protected:
 	
   private:
+    int setAddress(ChannelAddress *theAddress, const char *method);
+    int post(void *data, int size, MPI_Datatype type, bool send);
+
     int otherTag;
     MPI_Comm otherComm;    
+
+    // the outstanding requests, a request is free for reuse
+    // once it is MPI_REQUEST_NULL
+    std::vector<MPI_Request> requests;
+    std::vector<int> requestSizes;     // expected size of a recv, -1 for a send
+    std::vector<MPI_Datatype> requestTypes;
 };
 
 
@@ -159,6 +159,24 @@ Shadow::recvID(ID &theID)
     return theChannel->recvID(0, commitTag, theID, theRemoteActorsAddress);
 }
 
+int
+Shadow::irecvMatrix(Matrix &theMatrix)
+{
+    return theChannel->irecvMatrix(0, commitTag, theMatrix, theRemoteActorsAddress);
+}
+
+int
+Shadow::irecvVector(Vector &theVector)
+{
+    return theChannel->irecvVector(0, commitTag, theVector, theRemoteActorsAddress);
+}
+
+int
+Shadow::wait(int request)
+{
+    return theChannel->wait(request);
+}
+
 
 void
 Shadow::setCommitTag(int tag)
@@ -75,6 +75,9 @@ class Shadow
     virtual int recvVector(Vector &theVector);      
     virtual int sendID(const ID &theID);  
     virtual int recvID(ID &theID);      
+    virtual int irecvMatrix(Matrix &theMatrix);      
+    virtual int irecvVector(Vector &theVector);      
+    virtual int wait(int request);
     void setCommitTag(int commitTag);
 
     Channel 		  *getChannelPtr(void) const;
@@ -36,6 +36,7 @@
 #include <DOF_Group.h>
 #include <DOF_GrpIter.h>
 #include <FE_EleIter.h>
+#include <Profiler.h>
 
 #include <DirectIntegrationAnalysis.h>
 #include <EquiSolnAlgo.h>
@@ -170,6 +171,7 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT, bool flush)
   int result = 0;
 
   for (int i=0; i<numSteps; i++) {
+    OPS_PROFILE_SCOPE("step");
     result = this->analyzeStep(dT);
     if (result < 0) {
       if (numSubLevels != 0)
@@ -218,7 +220,8 @@ DirectIntegrationAnalysis::analyzeStep(double dT)
     return -2;
   }
   
-  result = theAlgorithm->solveCurrentStep();
+  if (theIntegrator->setsStepResponse() == false)
+    result = theAlgorithm->solveCurrentStep();
   if (result < 0) {
     opserr << "DirectIntegrationAnalysis::analyze() - the Algorithm failed";
     opserr << " at time " << the_Domain->getCurrentTime() << endln;
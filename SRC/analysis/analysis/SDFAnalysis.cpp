@@ -19,9 +19,12 @@
 ** ****************************************************************** */
 
 #include <PathSeries.h>
+#include <Vector.h>
 
 #include <math.h>
 #include <elementAPI.h>
+#include <string>
+#include <vector>
 
 int OPS_sdfResponse()
 {
@@ -171,7 +174,7 @@ int OPS_sdfResponse()
     int i = 0;
     double ft, u=0, du, v, a, fs, zs, ftrial, kT, kTeff, dg, phat, R, R0, accel;
     double time = accelSeries->getStartTime();
-    double Tend = accelSeries->getDuration();
+    double Tend = time + accelSeries->getDuration();
     while (time < Tend) {
 
       ft = accelSeries->getFactor(time);
@@ -256,3 +259,303 @@ int OPS_sdfResponse()
     
     return 0;
 }
+
+
+// response of a block of linear oscillators of unit mass to the ground
+// acceleration ag; the lanes of a block are independent so the inner
+// loops vectorize
+#define SDF_SPECTRUM_LANES 8
+
+static void
+sdfSpectrumLinear(int numLanes, const double *omega, const double *zeta,
+		  const std::vector<double> &ag, double dt, double *out)
+{
+  const double gamma = 0.5;
+  const double beta = 0.25;
+
+  double a1[SDF_SPECTRUM_LANES], a2[SDF_SPECTRUM_LANES], a3[SDF_SPECTRUM_LANES];
+  double keff[SDF_SPECTRUM_LANES];
+  double u0[SDF_SPECTRUM_LANES], v0[SDF_SPECTRUM_LANES], a0[SDF_SPECTRUM_LANES];
+  double umax[SDF_SPECTRUM_LANES], vmax[SDF_SPECTRUM_LANES], amax[SDF_SPECTRUM_LANES];
+
+  for (int l = 0; l < SDF_SPECTRUM_LANES; l++) {
+    int j = (l < numLanes) ? l : numLanes-1;
+    double k = omega[j]*omega[j];
+    double c = 2.0*zeta[j]*omega[j];
+    a1[l] = 1.0/(beta*dt*dt) + (gamma/(beta*dt))*c;
+    a2[l] = 1.0/(beta*dt) + (gamma/beta-1.0)*c;
+    a3[l] = (0.5/beta-1.0) + dt*(0.5*gamma/beta-1.0)*c;
+    keff[l] = 1.0/(k + a1[l]);
+    u0[l] = v0[l] = a0[l] = 0.0;
+    umax[l] = vmax[l] = amax[l] = 0.0;
+  }
+
+  const double au = 1.0/(beta*dt*dt);
+  const double av = 1.0/(beta*dt);
+  const double aa = 0.5/beta-1.0;
+  const double vu = gamma/(beta*dt);
+  const double vv = 1.0-gamma/beta;
+  const double va = dt*(1.0-0.5*gamma/beta);
+
+  int numSteps = (int)ag.size();
+  for (int i = 0; i < numSteps; i++) {
+    double p = -ag[i];
+    for (int l = 0; l < SDF_SPECTRUM_LANES; l++) {
+      double u = (p + a1[l]*u0[l] + a2[l]*v0[l] + a3[l]*a0[l])*keff[l];
+      double v = vu*(u-u0[l]) + vv*v0[l] + va*a0[l];
+      double a = au*(u-u0[l]) - av*v0[l] - aa*a0[l];
+      u0[l] = u;
+      v0[l] = v;
+      a0[l] = a;
+      umax[l] = fmax(umax[l], fabs(u));
+      vmax[l] = fmax(vmax[l], fabs(v));
+      amax[l] = fmax(amax[l], fabs(a - p));
+    }
+  }
+
+  for (int l = 0; l < numLanes; l++) {
+    out[3*l] = umax[l];
+    out[3*l+1] = vmax[l];
+    out[3*l+2] = amax[l];
+  }
+}
+
+// response of one bilinear oscillator of unit mass, same scheme as
+// sdfResponse
+static void
+sdfSpectrumBilinear(double omega, double zeta, double Fy, double alpha,
+		    const std::vector<double> &ag, double dt, double *out)
+{
+  const double gamma = 0.5;
+  const double beta = 0.25;
+  const double tol = 1.0e-8;
+  const int maxIter = 10;
+
+  double k = omega*omega;
+  double c = 2.0*zeta*omega;
+  double Hkin = alpha/(1.0-alpha)*k;
+
+  double a1 = 1.0/(beta*dt*dt) + (gamma/(beta*dt))*c;
+  double a2 = 1.0/(beta*dt) + (gamma/beta-1.0)*c;
+  double a3 = (0.5/beta-1.0) + dt*(0.5*gamma/beta-1.0)*c;
+
+  double au = 1.0/(beta*dt*dt);
+  double av = 1.0/(beta*dt);
+  double aa = 0.5/beta-1.0;
+
+  double vu = gamma/(beta*dt);
+  double vv = 1.0-gamma/beta;
+  double va = dt*(1.0-0.5*gamma/beta);
+
+  double u0 = 0.0, v0 = 0.0, a0 = 0.0, fs0 = 0.0, kT0 = k, up0 = 0.0;
+  double umax = 0.0, vmax = 0.0, amax = 0.0;
+
+  int numSteps = (int)ag.size();
+  for (int i = 0; i < numSteps; i++) {
+    double p = -ag[i];
+    double u = u0;
+    double fs = fs0;
+    double kT = kT0;
+    double up = up0;
+
+    double phat = p + a1*u0 + a2*v0 + a3*a0;
+    double R = phat - fs - a1*u;
+    double R0 = R;
+    if (R0 == 0.0)
+      R0 = 1.0;
+
+    int iter = 0;
+    while (iter < maxIter && fabs(R/R0) > tol) {
+      iter++;
+      u += R/(kT + a1);
+      fs = k*(u-up0);
+      double zs = fs-Hkin*up0;
+      double ftrial = fabs(zs)-Fy;
+      if (ftrial > 0) {
+	double dg = ftrial/(k+Hkin);
+	if (fs < 0) {
+	  fs = fs + dg*k;
+	  up = up0 - dg;
+	} else {
+	  fs = fs - dg*k;
+	  up = up0 + dg;
+	}
+	kT = k*Hkin/(k+Hkin);
+      } else {
+	kT = k;
+      }
+      R = phat - fs - a1*u;
+    }
+
+    double v = vu*(u-u0) + vv*v0 + va*a0;
+    double a = au*(u-u0) - av*v0 - aa*a0;
+
+    u0 = u;
+    v0 = v;
+    a0 = a;
+    fs0 = fs;
+    kT0 = kT;
+    up0 = up;
+
+    umax = fmax(umax, fabs(u));
+    vmax = fmax(vmax, fabs(v));
+    amax = fmax(amax, fabs(a - p));
+  }
+
+  out[0] = umax;
+  out[1] = vmax;
+  out[2] = amax;
+}
+
+// sdfSpectrum -periods {T ..} -damping {zeta ..} <-Fy {Fy ..}> <-alpha alpha>
+//             -tsTags {tag ..} -dt dt
+//
+// response spectra of unit-mass oscillators for one or more ground
+// acceleration records. Fy are yield strengths per unit mass, a value of
+// 0 giving a linear oscillator. The result holds Sd, Sv and Sa (relative
+// displacement, relative velocity and total acceleration) for each
+// record, damping ratio, strength and period, the period varying fastest.
+int OPS_sdfSpectrum()
+{
+  Vector periods, damping, strengths, tags;
+  double alpha = 0.0;
+  double dt = 0.0;
+  int size = 0;
+  int numData = 1;
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    std::string type = OPS_GetString();
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+      opserr << "WARNING sdfSpectrum - missing value for " << type.c_str() << endln;
+      return -1;
+    }
+    if (type == "-periods" || type == "-T") {
+      if (OPS_GetDoubleListInput(&size, &periods) < 0) {
+	opserr << "WARNING sdfSpectrum - failed to read periods" << endln;
+	return -1;
+      }
+    } else if (type == "-damping" || type == "-zeta") {
+      if (OPS_GetDoubleListInput(&size, &damping) < 0) {
+	opserr << "WARNING sdfSpectrum - failed to read damping ratios" << endln;
+	return -1;
+      }
+    } else if (type == "-Fy") {
+      if (OPS_GetDoubleListInput(&size, &strengths) < 0) {
+	opserr << "WARNING sdfSpectrum - failed to read strengths" << endln;
+	return -1;
+      }
+    } else if (type == "-alpha") {
+      if (OPS_GetDoubleInput(&numData, &alpha) < 0) {
+	opserr << "WARNING sdfSpectrum - failed to read alpha" << endln;
+	return -1;
+      }
+    } else if (type == "-tsTags" || type == "-timeSeries") {
+      if (OPS_GetDoubleListInput(&size, &tags) < 0) {
+	opserr << "WARNING sdfSpectrum - failed to read time series tags" << endln;
+	return -1;
+      }
+    } else if (type == "-dt") {
+      if (OPS_GetDoubleInput(&numData, &dt) < 0) {
+	opserr << "WARNING sdfSpectrum - failed to read dt" << endln;
+	return -1;
+      }
+    } else {
+      opserr << "WARNING sdfSpectrum - unknown option " << type.c_str() << endln;
+      return -1;
+    }
+  }
+
+  if (periods.Size() == 0 || damping.Size() == 0 || tags.Size() == 0 || dt <= 0.0) {
+    opserr << "WARNING sdfSpectrum -periods {T ..} -damping {zeta ..} <-Fy {Fy ..}> <-alpha alpha> -tsTags {tag ..} -dt dt" << endln;
+    return -1;
+  }
+  if (alpha < 0.0 || alpha >= 1.0) {
+    opserr << "WARNING sdfSpectrum - alpha must be in [0,1)" << endln;
+    return -1;
+  }
+  for (int j = 0; j < periods.Size(); j++) {
+    if (periods(j) <= 0.0) {
+      opserr << "WARNING sdfSpectrum - periods must be positive" << endln;
+      return -1;
+    }
+  }
+  if (strengths.Size() == 0) {
+    strengths.resize(1);
+    strengths(0) = 0.0;
+  }
+
+  int numPeriods = periods.Size();
+  int numDamping = damping.Size();
+  int numStrengths = strengths.Size();
+  int numRecords = tags.Size();
+  int numOscillators = numDamping*numStrengths*numPeriods;
+
+  std::vector<double> output((size_t)3*numRecords*numOscillators, 0.0);
+
+  // oscillator properties, period varying fastest
+  std::vector<double> omega(numOscillators), zeta(numOscillators), Fy(numOscillators);
+  for (int d = 0; d < numDamping; d++)
+    for (int s = 0; s < numStrengths; s++)
+      for (int j = 0; j < numPeriods; j++) {
+	int o = (d*numStrengths + s)*numPeriods + j;
+	omega[o] = 2.0*3.14159265358979323846/periods(j);
+	zeta[o] = damping(d);
+	Fy[o] = strengths(s);
+      }
+
+  std::vector<double> ag;
+  for (int r = 0; r < numRecords; r++) {
+    TimeSeries *accelSeries = OPS_getTimeSeries((int)tags(r));
+    if (accelSeries == 0) {
+      opserr << "WARNING sdfSpectrum - invalid accel series: " << (int)tags(r) << endln;
+      return -1;
+    }
+
+    // the record is sampled once and shared by all oscillators
+    ag.clear();
+    double time = accelSeries->getStartTime();
+    double Tend = time + accelSeries->getDuration();
+    while (time < Tend) {
+      ag.push_back(accelSeries->getFactor(time));
+      time += dt;
+    }
+
+    double *out = &output[(size_t)3*r*numOscillators];
+
+    // linear oscillators go in blocks of lanes, bilinear ones one at a
+    // time; each block or oscillator is a task
+    std::vector<int> tasks;
+    for (int o = 0; o < numOscillators; ) {
+      tasks.push_back(o);
+      if (Fy[o] > 0.0) {
+	o++;
+      } else {
+	int l = 0;
+	while (o < numOscillators && l < SDF_SPECTRUM_LANES && Fy[o] <= 0.0) {
+	  o++;
+	  l++;
+	}
+      }
+    }
+    tasks.push_back(numOscillators);
+
+    int numTasks = (int)tasks.size() - 1;
+#pragma omp parallel for schedule(dynamic)
+    for (int t = 0; t < numTasks; t++) {
+      int o = tasks[t];
+      int numLanes = tasks[t+1] - o;
+      if (Fy[o] > 0.0)
+	sdfSpectrumBilinear(omega[o], zeta[o], Fy[o], alpha, ag, dt, &out[3*o]);
+      else
+	sdfSpectrumLinear(numLanes, &omega[o], &zeta[o], ag, dt, &out[3*o]);
+    }
+  }
+
+  numData = (int)output.size();
+  if (OPS_SetDoubleOutput(&numData, &output[0], false) < 0) {
+    opserr << "WARNING: failed to set output -- sdfSpectrum\n";
+    return -1;
+  }
+
+  return 0;
+}
@@ -32,6 +32,7 @@
 #include <StaticAnalysis.h>
 #include <EquiSolnAlgo.h>
 #include <AnalysisModel.h>
+#include <Profiler.h>
 #include <LinearSOE.h>
 #include <EigenSOE.h>
 #include <DOF_Numberer.h>
@@ -46,6 +47,7 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <Graph.h>
+#include <classTags.h>
 //#include <Timer.h>
 #include <Integrator.h>//Abbas
 
@@ -130,6 +132,7 @@ StaticAnalysis::analyze(int numSteps, bool flush)
     Domain *the_Domain = this->getDomainPtr();
 
     for (int i=0; i<numSteps; i++) {
+	OPS_PROFILE_SCOPE("step");
 
 	result = theAnalysisModel->analysisStep();
 
@@ -333,6 +336,121 @@ StaticAnalysis::eigen(int numMode, bool generalized, bool findSmallest)
 }
 
 
+// analyzeLoadCases():
+//      for a linear model, runs a step with each of the given load
+//      patterns in turn, starting each from the committed state. With a
+//      Linear algorithm and a LoadControl integrator the tangent is only
+//      formed and factored for the first case, the other cases only
+//      assemble their loads and do the triangular solves with the factors
+//      kept by the LinearSOE; otherwise each case is solved by the
+//      algorithm. The recorders are invoked after each case, and the
+//      domain is then reverted, so nothing is committed.
+int
+StaticAnalysis::analyzeLoadCases(const ID &patternTags, bool flush)
+{
+    Domain *the_Domain = this->getDomainPtr();
+    int numCases = patternTags.Size();
+
+    for (int i=0; i<numCases; i++)
+      if (the_Domain->getLoadPattern(patternTags(i)) == 0) {
+	opserr << "StaticAnalysis::analyzeLoadCases() - no load pattern ";
+	opserr << patternTags(i) << endln;
+	return -1;
+      }
+
+    // other integrators may solve in newStep() and other algorithms
+    // iterate, neither can skip forming the tangent
+    bool batch = theAlgorithm->getClassTag() == EquiALGORITHM_TAGS_Linear &&
+      theIntegrator->getClassTag() == INTEGRATOR_TAGS_LoadControl;
+
+    the_Domain->setLoadCases(patternTags);
+
+    int result = 0;
+    bool formed = false;
+    for (int i=0; i<numCases; i++) {
+	OPS_PROFILE_SCOPE("loadCase");
+
+	the_Domain->setCurrentLoadCase(patternTags(i));
+
+	result = theAnalysisModel->analysisStep();
+	if (result < 0) {
+	    opserr << "StaticAnalysis::analyzeLoadCases() - the AnalysisModel failed";
+	    opserr << " for load pattern " << patternTags(i) << endln;
+	    result = -2;
+	    break;
+	}
+
+	int stamp = the_Domain->hasDomainChanged();
+	if (stamp != domainStamp) {
+	    domainStamp = stamp;
+	    if (this->domainChanged() < 0) {
+		opserr << "StaticAnalysis::analyzeLoadCases() - domainChanged failed";
+		opserr << " for load pattern " << patternTags(i) << endln;
+		result = -1;
+		break;
+	    }
+	    formed = false;
+	}
+
+	if (theIntegrator->newStep() < 0) {
+	    opserr << "StaticAnalysis::analyzeLoadCases() - the Integrator failed";
+	    opserr << " for load pattern " << patternTags(i) << endln;
+	    result = -2;
+	    break;
+	}
+
+	if (batch == false) {
+	    if (theAlgorithm->solveCurrentStep() < 0) {
+		opserr << "StaticAnalysis::analyzeLoadCases() - the Algorithm failed";
+		opserr << " for load pattern " << patternTags(i) << endln;
+		result = -3;
+		break;
+	    }
+	    the_Domain->record();
+	    the_Domain->revertToLastCommit();
+	    theIntegrator->revertToLastStep();
+	    continue;
+	}
+
+	// the factors of the first case are reused as long as A is not
+	// assembled again
+	if (formed == false) {
+	    if (theIntegrator->formTangent() < 0) {
+		opserr << "StaticAnalysis::analyzeLoadCases() - the Integrator failed";
+		opserr << " in formTangent() for load pattern " << patternTags(i) << endln;
+		result = -3;
+		break;
+	    }
+	    formed = true;
+	}
+
+	if (theIntegrator->formUnbalance() < 0 || theSOE->solve() < 0
+	    || theIntegrator->update(theSOE->getX()) < 0) {
+	    opserr << "StaticAnalysis::analyzeLoadCases() - failed to solve";
+	    opserr << " for load pattern " << patternTags(i) << endln;
+	    result = -3;
+	    break;
+	}
+
+	the_Domain->record();
+
+	the_Domain->revertToLastCommit();
+	theIntegrator->revertToLastStep();
+    }
+
+    if (result < 0) {
+	the_Domain->revertToLastCommit();
+	theIntegrator->revertToLastStep();
+    }
+    the_Domain->clearLoadCases();
+
+    if (flush)
+	the_Domain->flushRecorders();
+
+    return result;
+}
+
+
 int 
 StaticAnalysis::initialize(void)
 {
@@ -42,6 +42,7 @@ class ConstraintHandler;
 class DOF_Numberer;
 class AnalysisModel;
 class StaticIntegrator;
+class ID;
 class LinearSOE;
 class EquiSolnAlgo;
 class ConvergenceTest;
@@ -64,6 +65,7 @@ class StaticAnalysis: public Analysis
     void clearAll(void);
 
     int analyze(int numSteps, bool flush = true);
+    int analyzeLoadCases(const ID &patternTags, bool flush = true);
     int eigen(int numMode, bool generlzed = true, bool findSmallest = true);
     int initialize(void);
     int domainChanged(void);
@@ -107,7 +107,7 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
     }
 
 
-    if (result >= 0) {
+    if (result >= 0 && theIntegratr->setsStepResponse() == false) {
       result = theAlgo->solveCurrentStep();
       if (result < 0) 
 	result = -3;
@@ -41,6 +41,7 @@
 #include <Node.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <MemoryReport.h>
 #include <TransientIntegrator.h>
 
 #define MAX_NUM_DOF 256
@@ -807,6 +808,16 @@ DOF_Group::getT(void)
     return 0;
 }
 
+// getSparseT(const ID *&rowStart, const ID *&cols, const Vector *&values):
+//	returns the number of columns of T, with T by rows without its zero
+//	entries: row i holds entries rowStart(i) to rowStart(i+1)-1 of cols
+//	and values. 0 is returned, and nothing set, if T is the identity.
+int
+DOF_Group::getSparseT(const ID *&rowStart, const ID *&cols, const Vector *&values)
+{
+    return 0;
+}
+
 
 
 void  
@@ -1044,3 +1055,14 @@ DOF_Group::getDampingBetaForce(int mode, double beta)
   unbalance->addMatrixVector(0.0, mass, eigenvector, -beta);
   return *unbalance;
 }
+
+void
+DOF_Group::reportMemory(MemoryReport &theReport)
+{
+  // the unbalance and tangent are only owned above MAX_NUM_DOF
+  double bytes = sizeof(DOF_Group) + MemoryReport::getBytes(myID);
+  if (numDOF > MAX_NUM_DOF)
+    bytes += MemoryReport::getBytes(unbalance) + MemoryReport::getBytes(tangent);
+
+  theReport.add("analysis model", "DOF_Group", bytes);
+}
@@ -48,6 +48,7 @@ class Vector;
 class Matrix;
 class TransientIntegrator;
 class Integrator;
+class MemoryReport;
 
 class DOF_Group: public TaggedObject
 {
@@ -110,6 +111,7 @@ class DOF_Group: public TaggedObject
 	
     // method added for TransformationDOF_Groups
     virtual Matrix *getT(void);
+    virtual int getSparseT(const ID *&rowStart, const ID *&cols, const Vector *&values);
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
     virtual void addM_ForceSensitivity(const Vector &Udotdot, double fact = 1.0);        
@@ -129,6 +131,7 @@ class DOF_Group: public TaggedObject
 				const Vector &vdotdot, int gradNum, int numGrads);
 // AddingSensitivity:END //////////////////////////////////////
     virtual void  Print(OPS_Stream&, int = 0) {return;};
+    virtual void  reportMemory(MemoryReport &theReport);
     virtual void resetNodePtr(void);
   
    protected:
@@ -327,7 +327,22 @@ TransformationDOF_Group::getTangent(Integrator *theIntegrator)
     Matrix *T = this->getT();
     if (T != 0) {
 	// *modTangent = (*T) ^ unmodTangent * (*T);
-	modTangent->addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
+	// T is mostly identity rows, so only its nonzero entries are used
+	modTangent->Zero();
+	int numRows = T->noRows();
+	for (int a=0; a<numRows; a++) {
+	  for (int b=0; b<numRows; b++) {
+	    double kab = unmodTangent(a,b);
+	    if (kab == 0.0)
+	      continue;
+	    for (int p=TrowStart(a); p<TrowStart(a+1); p++) {
+	      double tk = Tvalues(p) * kab;
+	      int c = Tcols(p);
+	      for (int q=TrowStart(b); q<TrowStart(b+1); q++)
+		(*modTangent)(c, Tcols(q)) += tk * Tvalues(q);
+	    }
+	  }
+	}
 	return *modTangent;
 	
     } else 
@@ -362,7 +377,14 @@ TransformationDOF_Group::getUnbalance(Integrator *theIntegrator)
     Matrix *T = this->getT();
     if (T != 0) {
 	// *modUnbalance = (*T) ^ unmodUnbalance;
-	modUnbalance->addMatrixTransposeVector(0.0, *T, unmodUnbalance, 1.0);
+	modUnbalance->Zero();
+	int numRows = T->noRows();
+	for (int a=0; a<numRows; a++) {
+	  double ra = unmodUnbalance(a);
+	  if (ra != 0.0)
+	    for (int p=TrowStart(a); p<TrowStart(a+1); p++)
+	      (*modUnbalance)(Tcols(p)) += Tvalues(p) * ra;
+	}
 	return *modUnbalance;    
     } else
 	return unmodUnbalance;
@@ -893,10 +915,33 @@ TransformationDOF_Group::getT(void)
     if (theMP == 0)
 	return 0;
 
-    if (theMP->isTimeVarying() == false) {
-	return Trans;
-    }
-    
+    if (theMP->isTimeVarying() == true)
+	this->formT();
+
+    return Trans;    
+}
+
+
+int
+TransformationDOF_Group::getSparseT(const ID *&rowStart, const ID *&cols, const Vector *&values)
+{
+    if (this->getT() == 0)
+	return 0;
+
+    rowStart = &TrowStart;
+    cols = &Tcols;
+    values = &Tvalues;
+    return modNumDOF;
+}
+
+
+// formT():
+//	forms T from the constraint, the identity for the dof that are not
+//	constrained and Ccr for those that are, and the copy of T by rows
+//	without the zero entries used to transform the tangent and unbalance.
+void
+TransformationDOF_Group::formT(void)
+{
     int numNodalDOF = myNode->getNumberDOF();
     const ID &retainedDOF = theMP->getRetainedDOFs();
     const ID &constrainedDOF = theMP->getConstrainedDOFs();    
@@ -918,7 +963,29 @@ TransformationDOF_Group::getT(void)
       }
     }
 
-    return Trans;    
+    int numEntries = 0;
+    for (int i=0; i<numNodalDOF; i++)
+      for (int j=0; j<modNumDOF; j++)
+	if ((*Trans)(i,j) != 0.0)
+	  numEntries++;
+
+    TrowStart.resize(numNodalDOF+1);
+    Tcols.resize(numEntries);
+    Tvalues.resize(numEntries);
+
+    numEntries = 0;
+    for (int i=0; i<numNodalDOF; i++) {
+      TrowStart(i) = numEntries;
+      for (int j=0; j<modNumDOF; j++) {
+	double value = (*Trans)(i,j);
+	if (value != 0.0) {
+	  Tcols(numEntries) = j;
+	  Tvalues(numEntries) = value;
+	  numEntries++;
+	}
+      }
+    }
+    TrowStart(numNodalDOF) = numEntries;
 }
 
 
@@ -950,21 +1017,8 @@ TransformationDOF_Group::doneID(void)
   }
   
   // if constraint is not time-varying determine the transformation matrix
-  if (theMP->isTimeVarying() == false) {
-    Trans->Zero();
-    const Matrix &Ccr = theMP->getConstraint();
-    int col = 0;
-    for (int i=0; i<numNodalDOF; i++) {
-      int loc = constrainedDOF.getLocation(i);
-      if (loc < 0) {
-	(*Trans)(i,col) = 1.0;
-	col++;
-      } else {
-	for (int j=0; j<numRetainedNodeDOF; j++)
-	  (*Trans)(i,j+numRetainedDOF) = Ccr(loc,j);
-      }
-    }
-  }
+  if (theMP->isTimeVarying() == false)
+    this->formT();
   
   // set the pointers for the tangent and residual
   if (modNumDOF <= MAX_NUM_DOF) {
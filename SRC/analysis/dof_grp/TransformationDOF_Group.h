@@ -65,6 +65,7 @@ class TransformationDOF_Group: public DOF_Group
     const ID &getID(void) const; 
     virtual void setID(int dof, int value);    
     Matrix *getT(void);
+    int getSparseT(const ID *&rowStart, const ID *&cols, const Vector *&values);
     virtual int getNumDOF(void) const;    
     virtual int getNumFreeDOF(void) const;
     virtual int getNumConstrainedDOF(void) const;
@@ -122,9 +123,14 @@ class TransformationDOF_Group: public DOF_Group
   protected:
     
   private:
+    void formT(void);
+
     // private variables - a copy for each object of the class            
     MP_Constraint *theMP;
     Matrix *Trans;
+    ID TrowStart;     // Trans by rows without its zero entries
+    ID Tcols;
+    Vector Tvalues;
     Matrix *modTangent;
     Vector *modUnbalance;
     ID *modID;
@@ -34,6 +34,8 @@
 #include <stdlib.h>
 
 #include <Element.h>
+#include <Profiler.h>
+#include <MemoryReport.h>
 #include <Domain.h>
 #include <Node.h>
 #include <DOF_Group.h>
@@ -58,7 +60,8 @@ FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
-   theResidual(0), theTangent(0), theIntegrator(0)
+   theResidual(0), theTangent(0), theIntegrator(0), lumpedMass(false),
+   linearTangent(0), linearStamp(0), linearLumped(false)
 {
   if (numDOF <= 0) {
     opserr << "FE_Element::FE_Element(Element *) ";
@@ -167,7 +170,8 @@ FE_Element::FE_Element(int tag, Element *ele)
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), theResidual(0), theTangent(0), theIntegrator(0), lumpedMass(false),
+   linearTangent(0), linearStamp(0), linearLumped(false)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
     numFEs++;
@@ -209,6 +213,9 @@ FE_Element::~FE_Element()
 	if (theResidual != 0) delete theResidual;
     }
 
+    if (linearTangent != 0)
+	delete linearTangent;
+
     // if this is the last FE_Element, clean up the
     // storage for the matrix and vector objects
     if (numFEs == 0) {
@@ -297,6 +304,7 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
     }
 
     if (myEle->isSubdomain() == false) {
+      OPS_PROFILE_SCOPE(myEle->getClassType());
       if (theNewIntegrator != 0)
 	theNewIntegrator->formEleTangent(this);	    	    
 
@@ -308,6 +316,38 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
     }
 }
 
+// getLinearTangent(Integrator *theIntegrator, double cK, double cC, double cM):
+//      for an integrator whose tangent is cK K + cC C + cM M. The tangent of
+//      a linear element is kept and only formed again when the factors or
+//      the element matrices change; other elements form it every time.
+const Matrix &
+FE_Element::getLinearTangent(Integrator *theNewIntegrator, double cK, double cC, double cM)
+{
+    if (myEle == 0 || myEle->isSubdomain() == true || myEle->isLinear() == false)
+	return this->getTangent(theNewIntegrator);
+
+    theIntegrator = theNewIntegrator;
+
+    if (linearTangent != 0 && linearStamp == myEle->getMatrixStamp() &&
+	linearLumped == lumpedMass && linearFactors[0] == cK &&
+	linearFactors[1] == cC && linearFactors[2] == cM)
+	return *linearTangent;
+
+    const Matrix &theTang = this->getTangent(theNewIntegrator);
+    if (linearTangent == 0)
+	linearTangent = new Matrix(theTang);
+    else
+	*linearTangent = theTang;
+
+    linearFactors[0] = cK;
+    linearFactors[1] = cC;
+    linearFactors[2] = cM;
+    linearStamp = myEle->getMatrixStamp();
+    linearLumped = lumpedMass;
+
+    return *linearTangent;
+}
+
 const Vector &
 FE_Element::getResidual(Integrator *theNewIntegrator)
 {
@@ -388,7 +428,7 @@ FE_Element::addCtoTang(double fact)
 void  
 FE_Element::addMtoTang(double fact)
 {
-    if (myEle != 0 && myEle->isActive()) {
+    if (myEle != 0 && myEle->isActive() && lumpedMass == false) {
 
 	// check for a quick return	
 	if (fact == 0.0) 
@@ -403,6 +443,52 @@ FE_Element::addMtoTang(double fact)
 }    
 
 
+// addLumpedMass(Vector &diag, double fact):
+//      adds fact times the element mass to diag, which is in equation
+//      numbering, if the mass matrix is diagonal; returns -1 and adds
+//      nothing if it is not, or if the element is inactive or a Subdomain.
+int
+FE_Element::addLumpedMass(Vector &diag, double fact)
+{
+  if (myEle == 0 || myEle->isSubdomain() == true || myEle->isActive() == false)
+    return -1;
+
+  const Matrix &M = myEle->getMass();
+  if (M.noRows() != numDOF || M.noCols() != numDOF)
+    return -1;
+
+  for (int j=0; j<numDOF; j++)
+    for (int i=0; i<numDOF; i++)
+      if (i != j && M(i,j) != 0.0)
+	return -1;
+
+  int size = diag.Size();
+  for (int i=0; i<numDOF; i++) {
+    int loc = myID(i);
+    if (loc >= 0 && loc < size)
+      diag(loc) += fact * M(i,i);
+  }
+
+  return 0;
+}
+
+void
+FE_Element::setLumpedMass(bool onOff)
+{
+  lumpedMass = onOff;
+}
+
+// getMatrixStamp():
+//      returns the matrix stamp of the element, 0 if there is none.
+int
+FE_Element::getMatrixStamp(void)
+{
+  if (myEle == 0)
+    return 0;
+  return myEle->getMatrixStamp();
+}
+
+
 void
 FE_Element::addKiToTang(double fact)
 {
@@ -1116,26 +1202,37 @@ FE_Element::updateElement(void)
 
 void FE_Element::activate()
 { 
-	myEle->activate();
+	if (myEle != 0)
+		myEle->activate();
 }
 
 
 void FE_Element::deactivate()
 { 
-	myEle->deactivate();
+	if (myEle != 0)
+		myEle->deactivate();
 }
 
 
+// FE_Elements without an Element, e.g. those of the MP_Constraints,
+// are always active
 bool FE_Element::isActive()
 { 
-	if (myEle->isActive())
-	{
-		// opserr << "Element # " << myEle->getTag() << " is ACTIVE." << endln;
+	if (myEle == 0 || myEle->isActive())
 		return true;
-	} 
 	else
-	{
-		// opserr << "Element # " << myEle->getTag() << " is INACTIVE." << endln;
 		return false;
-	}
+}
+
+void
+FE_Element::reportMemory(MemoryReport &theReport)
+{
+  // the tangent and residual are only owned above MAX_NUM_DOF, below
+  // that they are shared by all the FE_Elements of the same size
+  double bytes = sizeof(FE_Element) + MemoryReport::getBytes(myDOF_Groups)
+    + MemoryReport::getBytes(myID) + MemoryReport::getBytes(linearTangent);
+  if (numDOF > MAX_NUM_DOF)
+    bytes += MemoryReport::getBytes(theTangent) + MemoryReport::getBytes(theResidual);
+
+  theReport.add("analysis model", "FE_Element", bytes);
 }
@@ -43,6 +43,7 @@ class TransientIntegrator;
 class Element;
 class Integrator;
 class AnalysisModel;
+class MemoryReport;
 
 class FE_Element: public TaggedObject
 {
@@ -60,6 +61,7 @@ class FE_Element: public TaggedObject
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
+    const Matrix &getLinearTangent(Integrator *theIntegrator, double cK, double cC, double cM);
 
     // methods to allow integrator to build tangent
     virtual void  zeroTangent(void);
@@ -70,6 +72,11 @@ class FE_Element: public TaggedObject
     virtual void  addMtoTang(double fact = 1.0);    
     virtual void  addKpToTang(double fact = 1.0, int numP = 0);
     virtual int   storePreviousK(int numP);
+
+    // methods to allow integrator to assemble a lumped mass once
+    virtual int   addLumpedMass(Vector &diag, double fact = 1.0);
+    void  setLumpedMass(bool onOff);
+    int   getMatrixStamp(void);
     
     // methods to allow integrator to build residual    
     virtual void  zeroResidual(void);    
@@ -94,6 +101,7 @@ class FE_Element: public TaggedObject
     Element *getElement(void);
 
     virtual void  Print(OPS_Stream&, int = 0) {return;};
+    virtual void  reportMemory(MemoryReport &theReport);
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
     virtual void addResistingForceSensitivity(int gradNumber, double fact = 1.0);
@@ -125,6 +133,11 @@ class FE_Element: public TaggedObject
     Vector *theResidual;
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
+    bool lumpedMass;           // mass added by the integrator, skipped in addMtoTang
+    Matrix *linearTangent;     // tangent kept for a linear element
+    double linearFactors[3];   // factors on K, C and M it was formed with
+    int linearStamp;           // matrix stamp of the element when it was formed
+    bool linearLumped;         // lumpedMass when it was formed
     
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
@@ -47,13 +47,14 @@
 // static variables initialisation
 Matrix **TransformationFE::modMatrices; 
 Vector **TransformationFE::modVectors;  
-Matrix **TransformationFE::theTransformations; 
+TransformationFE::NodalT *TransformationFE::theTransformations = 0;
 int TransformationFE::numTransFE(0);           
 int TransformationFE::transCounter(0);           
 int TransformationFE::sizeTransformations(0);          
 double *TransformationFE::dataBuffer = 0;          
-double *TransformationFE::localKbuffer = 0;          
-int    *TransformationFE::dofData = 0;    ;          
+ID TransformationFE::identityRows;
+ID TransformationFE::identityCols;
+Vector TransformationFE::identityValues;
 int TransformationFE::sizeBuffer(0);            
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
@@ -101,7 +102,7 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	if (theTransformations != 0) 
 	    delete [] theTransformations;
 	
-	theTransformations = new Matrix *[numNodes];
+	theTransformations = new NodalT[numNodes];
 	if (theTransformations == 0) {
 	    opserr << "FATAL TransformationFE::TransformationFE() - out of memory ";
 	    opserr << "for array of pointers for Transformation matrices of size ";
@@ -118,12 +119,9 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	modMatrices = new Matrix *[MAX_NUM_DOF+1];
 	modVectors  = new Vector *[MAX_NUM_DOF+1];
 	dataBuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	localKbuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	dofData      = new int[MAX_NUM_DOF];
 	sizeBuffer = MAX_NUM_DOF*MAX_NUM_DOF;
 	
-	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0 ||
-	    localKbuffer == 0 || dofData == 0) {
+	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0) {
 	    opserr << "TransformationFE::TransformationFE(Element *) ";
 	    opserr << " ran out of memory";	    
 	}
@@ -178,14 +176,10 @@ TransformationFE::~TransformationFE()
 	delete [] modVectors;
 	delete [] theTransformations;
 	delete [] dataBuffer;
-	delete [] localKbuffer;
-	delete [] dofData;
 	modMatrices = 0;
 	modVectors = 0;
 	theTransformations = 0;
 	dataBuffer = 0;
-	localKbuffer = 0;
-	dofData = 0;
 	sizeTransformations = 0;
 	sizeBuffer = 0;
 	transCounter = 0;
@@ -288,99 +282,103 @@ TransformationFE::setID(void)
     return 0;
 }
 
+int
+TransformationFE::addLumpedMass(Vector &diag, double fact)
+{
+  return -1;
+}
+
 const Matrix &
 TransformationFE::getTangent(Integrator *theNewIntegrator)
 {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
 
-    static ID numDOFs(dofData, 1);
-    numDOFs.setData(dofData, numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-    
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
+    return this->transformTangent(theTangent);
+}
+
+
+// gatherT():
+//	gets T(i) of each node, by rows without its zero entries; T is mostly
+//	identity rows with a few rows coupling to the retained node, so the
+//	products below only visit its nonzero terms.
+void
+TransformationFE::gatherT(void)
+{
     int numNode = numGroups;
-    for (int a = 0; a<numNode; a++) {
-      Matrix *theT = theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if (theT != 0)
-	numDOFs[a] = theT->noRows(); // T^ 
-      else
-	numDOFs[a] = theDOFs[a]->getNumDOF();
+    for (int i=0; i<numNode; i++) {
+	NodalT &Ti = theTransformations[i];
+	Ti.numCols = theDOFs[i]->getSparseT(Ti.rowStart, Ti.cols, Ti.values);
+	if (Ti.numCols > 0) {
+	    Ti.numRows = Ti.rowStart->Size() - 1;
+	} else {
+	    // no T, the identity is assumed
+	    int numDOF = theDOFs[i]->getNumDOF();
+	    if (identityCols.Size() < numDOF) {
+		identityRows.resize(numDOF+1);
+		identityCols.resize(numDOF);
+		identityValues.resize(numDOF);
+		for (int a=0; a<numDOF; a++) {
+		    identityRows(a) = a;
+		    identityCols(a) = a;
+		    identityValues(a) = 1.0;
+		}
+		identityRows(numDOF) = numDOF;
+	    }
+	    Ti.rowStart = &identityRows;
+	    Ti.cols = &identityCols;
+	    Ti.values = &identityValues;
+	    Ti.numRows = numDOF;
+	    Ti.numCols = numDOF;
+	}
     }
+}
 
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
 
+// transformTangent(const Matrix &theTangent):
+//	forms modTangent = T^T K T, as T is block diagonal by doing
+//	T(i)^T K(i,j) T(j) for the blocks of the nodes.
+const Matrix &
+TransformationFE::transformTangent(const Matrix &theTangent)
+{
+    this->gatherT();
+    modTangent->Zero();
+
+    int numNode = numGroups;
     int startRow = 0;
-    int noRowsTransformed = 0;
     int noRowsOriginal = 0;
 
-    static Matrix localK;
-
     // foreach block row, for each block col do
     for (int i=0; i<numNode; i++) {
+	const NodalT &Ti = theTransformations[i];
+	const ID &rowStartI = *Ti.rowStart;
 
 	int startCol = 0;
-	int numDOFi = numDOFs[i];	
 	int noColsOriginal = 0;
 
 	for (int j=0; j<numNode; j++) {
-
-	    const Matrix *Ti = theTransformations[i];
-	    const Matrix *Tj = theTransformations[j];
-	    int numDOFj = numDOFs[j];	
-	    localK.setData(localKbuffer, numDOFi, numDOFj);
-
-	    // copy K(i,j) into localK matrix
-	    // CHECK SIZE OF BUFFER	    
-	    for (int a=0; a<numDOFi; a++)
-		for (int b=0; b<numDOFj; b++)
-		    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	    // now perform the matrix computation T(i)^T localK T(j)
-	    // note: if T == 0 then the Identity is assumed
-	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
-	    
-	    if (Ti != 0 && Tj != 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK * (*Tj);
-		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-	    } else if (Ti == 0 && Tj != 0) {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		// localTtKT = localK * (*Tj);	       
-		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	    } else if (Ti != 0 && Tj == 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK;
-		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-	    } else {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		localTtKT = localK;
+	    const NodalT &Tj = theTransformations[j];
+	    const ID &rowStartJ = *Tj.rowStart;
+
+	    for (int a=0; a<Ti.numRows; a++) {
+		for (int b=0; b<Tj.numRows; b++) {
+		    double kab = theTangent(noRowsOriginal+a, noColsOriginal+b);
+		    if (kab == 0.0)
+			continue;
+		    for (int p=rowStartI(a); p<rowStartI(a+1); p++) {
+			double tk = (*Ti.values)(p) * kab;
+			int c = startRow + (*Ti.cols)(p);
+			for (int q=rowStartJ(b); q<rowStartJ(b+1); q++)
+			    (*modTangent)(c, startCol + (*Tj.cols)(q)) += tk * (*Tj.values)(q);
+		    }
+		}
 	    }
-	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
-	    for (int c=0; c<noRowsTransformed; c++) 
-		for (int d=0; d<noColsTransformed; d++) 
-		    (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-	    
-	    startCol += noColsTransformed;
-	    noColsOriginal += numDOFj;
+
+	    startCol += Tj.numCols;
+	    noColsOriginal += Tj.numRows;
 	}
 
-	noRowsOriginal += numDOFi;
-	startRow += noRowsTransformed;
+	noRowsOriginal += Ti.numRows;
+	startRow += Ti.numCols;
     }
 
     return *modTangent;
@@ -396,46 +394,22 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
     
     // perform Tt R  -- as T is block diagonal do T(i)^T R(i)
     // where blocks are of size equal to num ele dof at a node
+    this->gatherT();
+    modResidual->Zero();
 
     int startRowTransformed = 0;
     int startRowOriginal = 0;
     int numNode = numGroups;
 
-    // foreach block row, for each block col do
     for (int i=0; i<numNode; i++) {
-	int noRows = 0;
-	int noCols = 0;
-	const Matrix *Ti = theDOFs[i]->getT();
-	if (Ti != 0) {
-	  noRows = Ti->noCols(); // T^
-	  noCols = Ti->noRows();
-
-	  /*
-	  Vector orig(noCols);
-	  Vector mod(noRows);
-	  for (int k=startRowOriginal; k<startRowOriginal+noCols; k++)
-	    orig(k-startRowOriginal)= theResidual(k);
-	  mod = (*Ti)^orig;
-	  for (int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-	    (*modResidual)(k) = mod (k-startRowTransformed);
-
-	  */
-
-	  for (int j=0; j<noRows; j++) {
-	    double sum = 0.0;
-	    for (int k=0; k<noCols; k++)
-	      sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-	    (*modResidual)(startRowTransformed +j) = sum;
-	  }
-
-	} else {
-	  noCols = theDOFs[i]->getNumDOF();
-	  noRows = noCols;
-	  for (int j=0; j<noRows; j++)
-	    (*modResidual)(startRowTransformed +j) = theResidual(startRowOriginal + j);
+	const NodalT &Ti = theTransformations[i];
+	for (int a=0; a<Ti.numRows; a++) {
+	    double ra = theResidual(startRowOriginal + a);
+	    for (int p=(*Ti.rowStart)(a); p<(*Ti.rowStart)(a+1); p++)
+		(*modResidual)(startRowTransformed + (*Ti.cols)(p)) += (*Ti.values)(p) * ra;
 	}
-	startRowTransformed += noRows;
-	startRowOriginal += noCols;
+	startRowTransformed += Ti.numCols;
+	startRowOriginal += Ti.numRows;
     }
 
     return *modResidual;
@@ -459,96 +433,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
   this->FE_Element::addKtToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -574,96 +459,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   this->FE_Element::addKiToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -688,96 +484,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   this->FE_Element::addMtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -802,96 +509,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   this->FE_Element::addCtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -980,32 +598,22 @@ TransformationFE::transformResponse(const Vector &modResp,
 {
     // perform T R  -- as T is block diagonal do T(i) R(i)
     // where blocks are of size equal to num ele dof at a node
+    this->gatherT();
 
     int startRowOriginal = 0;
     int startRowTransformed = 0;
     int numNode = numGroups;
-    int noRows = 0;
-    int noCols = 0;
 
     for (int i=0; i<numNode; i++) {
-	const Matrix *Ti = theDOFs[i]->getT();
-	if (Ti != 0) {
-	    noRows = Ti->noRows();
-	    noCols = Ti->noCols();
-	    for (int j=0; j<noRows; j++) {
-		double sum = 0.0;
-		for (int k=0; k<noCols; k++)
-		    sum += (*Ti)(j,k) * modResp(startRowTransformed +k) ;
-		unmodResp(startRowOriginal + j) = sum;
-	    }
-	} else {
-	    noCols = theDOFs[i]->getNumDOF();
-	    noRows = noCols;
-	    for (int j=0; j<noCols; j++)
-		unmodResp(startRowOriginal + j) = modResp(startRowTransformed +j);
+	const NodalT &Ti = theTransformations[i];
+	for (int a=0; a<Ti.numRows; a++) {
+	    double sum = 0.0;
+	    for (int p=(*Ti.rowStart)(a); p<(*Ti.rowStart)(a+1); p++)
+		sum += (*Ti.values)(p) * modResp(startRowTransformed + (*Ti.cols)(p));
+	    unmodResp(startRowOriginal + a) = sum;
 	}
-	startRowOriginal += noRows;
-	startRowTransformed += noCols;
+	startRowOriginal += Ti.numRows;
+	startRowTransformed += Ti.numCols;
     }
 
     return 0;
@@ -56,6 +56,9 @@ class TransformationFE: public FE_Element
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
+
+    // the transformation couples the mass, it can not be lumped
+    virtual int addLumpedMass(Vector &diag, double fact = 1.0);
     
     // methods for ele-by-ele strategies
     virtual const Vector &getTangForce(const Vector &x, double fact = 1.0);
@@ -79,6 +82,17 @@ class TransformationFE: public FE_Element
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
     
   private:
+    // T(i) of the i'th node by rows without its zero entries,
+    // see DOF_Group::getSparseT()
+    struct NodalT {
+      const ID *rowStart;
+      const ID *cols;
+      const Vector *values;
+      int numRows, numCols;
+    };
+
+    void gatherT(void);
+    const Matrix &transformTangent(const Matrix &theTangent);
     
     // private variables - a copy for each object of the class        
     DOF_Group **theDOFs;
@@ -94,13 +108,14 @@ class TransformationFE: public FE_Element
     // static variables - single copy for all objects of the class	
     static Matrix **modMatrices; // array of pointers to class wide matrices
     static Vector **modVectors;  // array of pointers to class widde vectors
-    static Matrix **theTransformations; // for holding pointers to the T matrices
+    static NodalT *theTransformations;  // for holding the T of the nodes
     static int numTransFE;     // number of objects    
     static int transCounter;   // a counter used to indicate when to do something
     static int sizeTransformations; // size of theTransformations array
     static double *dataBuffer;
-    static double *localKbuffer;
-    static int    *dofData;
+    static ID identityRows;    // T of a node without one, the identity
+    static ID identityCols;
+    static Vector identityValues;
     static int sizeBuffer;
 };
 
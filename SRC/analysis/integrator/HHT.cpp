@@ -241,8 +241,34 @@ int HHT::formNodTangent(DOF_Group *theDof)
 }
 
 
+bool HHT::getLumpedMassFactor(double &factor)
+{
+    // formEleTangent() adds c3 M for every tangent flag
+    factor = c3;
+    return true;
+}
+
+
+bool HHT::getTangentFactors(double &cK, double &cC, double &cM)
+{
+    // the tangent and initial stiffness of a linear element are the same
+    if (statusFlag == CURRENT_TANGENT || statusFlag == INITIAL_TANGENT)
+        cK = alpha*c1;
+    else if (statusFlag == HALL_TANGENT)
+        cK = alpha*c1*(cFactor + iFactor);
+    else
+        return false;
+
+    cC = alpha*c2;
+    cM = c3;
+    return true;
+}
+
+
 int HHT::domainChanged()
 {
+    this->clearLumpedMass();
+
     AnalysisModel *theModel = this->getAnalysisModel();
     LinearSOE *theLinSOE = this->getLinearSOE();
     const Vector &x = theLinSOE->getX();
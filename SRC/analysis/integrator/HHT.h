@@ -69,6 +69,8 @@ public:
     void Print(OPS_Stream &s, int flag = 0);
     
 protected:
+    bool getLumpedMassFactor(double &factor);
+    bool getTangentFactors(double &cK, double &cC, double &cM);
     
 private:
     double alpha;
@@ -33,20 +33,27 @@
 #include <IncrementalIntegrator.h>
 #include <FE_Element.h>
 #include <LinearSOE.h>
+#include <Profiler.h>
 #include <AnalysisModel.h>
 #include <Vector.h>
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
+#include <Domain.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
 #include <cmath>
 
+#ifdef _PARALLEL_PROCESSING
+#include <mpi.h>
+#endif
+
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
  mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0),
+ inactiveDiag(0), numInactiveEqn(0), inactiveStamp(-1)
 {
   
 }
@@ -65,6 +72,8 @@ IncrementalIntegrator::~IncrementalIntegrator()
     delete tmpV1;
   if (tmpV2 != 0)
     delete tmpV2;
+  if (inactiveDiag != 0)
+    delete inactiveDiag;
 }
 
 void
@@ -84,6 +93,7 @@ IncrementalIntegrator::setEigenSOE(EigenSOE *theEigSOE) {
 int 
 IncrementalIntegrator::formTangent(int statFlag)
 {
+    OPS_PROFILE_SCOPE("formTangent");
     int result = 0;
     statusFlag = statFlag;
 
@@ -99,15 +109,19 @@ IncrementalIntegrator::formTangent(int statFlag)
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations - CHANGE
 
-    // loop through the FE_Elements adding their contributions to the tangent
+    // loop through the FE_Elements adding their contributions to the tangent,
+    // inactive elements add nothing and leave the structure of A as it is
     FE_Element *elePtr;
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != 0)     
+    while((elePtr = theEles2()) != 0) {
+	if (elePtr->isActive() == false)
+	    continue;
 	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
 	    opserr << "WARNING IncrementalIntegrator::formTangent -";
 	    opserr << " failed in addA for ID " << elePtr->getID();	    
 	    result = -3;
 	}
+    }
 
     return result;
 }
@@ -129,6 +143,7 @@ IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 int 
 IncrementalIntegrator::formUnbalance(void)
 {
+    OPS_PROFILE_SCOPE("formUnbalance");
     if (theAnalysisModel == 0 || theSOE == 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance -";
 	opserr << " no AnalysisModel or LinearSOE has been set\n";
@@ -273,6 +288,8 @@ IncrementalIntegrator::formElementResidual(void)
 
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
     while((elePtr = theEles2()) != 0) {
+	if (elePtr->isActive() == false)
+	    continue;
 
 	if (theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0) {
 	    opserr << "WARNING IncrementalIntegrator::formElementResidual -";
@@ -284,6 +301,85 @@ IncrementalIntegrator::formElementResidual(void)
     return res;	    
 }
 
+// formInactiveTangent():
+//      adds 1.0 to the diagonal of the equations that only inactive
+//      elements are connected to, so that A keeps its size and structure
+//      while elements are deactivated. The equations are only searched for
+//      again when the active elements change or clearInactiveTangent()
+//      is invoked after a renumbering.
+int
+IncrementalIntegrator::formInactiveTangent(void)
+{
+    if (theAnalysisModel == 0 || theSOE == 0) {
+	opserr << "WARNING IncrementalIntegrator::formInactiveTangent() -";
+	opserr << " no AnalysisModel or LinearSOE have been set\n";
+	return -1;
+    }
+
+    Domain *theDomain = theAnalysisModel->getDomainPtr();
+    int numEqn = theSOE->getNumEqn();
+    int stamp = theDomain->getActiveStamp();
+
+    if (inactiveDiag == 0 || inactiveDiag->Size() != numEqn || inactiveStamp != stamp) {
+      if (inactiveDiag == 0 || inactiveDiag->Size() != numEqn) {
+	if (inactiveDiag != 0)
+	  delete inactiveDiag;
+	inactiveDiag = new Vector(numEqn);
+      }
+
+      int *connected = new int[numEqn+1];
+      for (int i=0; i<numEqn; i++)
+	connected[i] = 0;
+
+      FE_Element *elePtr;
+      FE_EleIter &theEles = theAnalysisModel->getFEs();
+      while ((elePtr = theEles()) != 0) {
+	if (elePtr->isActive() == false)
+	  continue;
+	const ID &theID = elePtr->getID();
+	for (int i=0; i<theID.Size(); i++) {
+	  int dof = theID(i);
+	  if (dof >= 0 && dof < numEqn)
+	    connected[dof] = 1;
+	}
+      }
+
+#ifdef _PARALLEL_PROCESSING
+      // an equation may be connected on another process only
+      int *allConnected = new int[numEqn+1];
+      MPI_Allreduce(connected, allConnected, numEqn, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+      delete [] connected;
+      connected = allConnected;
+#endif
+
+      numInactiveEqn = 0;
+      for (int i=0; i<numEqn; i++) {
+	if (connected[i] == 0) {
+	  (*inactiveDiag)(i) = 1.0;
+	  numInactiveEqn++;
+	} else
+	  (*inactiveDiag)(i) = 0.0;
+      }
+      delete [] connected;
+
+      inactiveStamp = stamp;
+    }
+
+    if (numInactiveEqn != 0 && theSOE->addDiagA(*inactiveDiag) < 0) {
+	opserr << "WARNING IncrementalIntegrator::formInactiveTangent -";
+	opserr << " failed in addDiagA\n";
+	return -3;
+    }
+
+    return 0;
+}
+
+void
+IncrementalIntegrator::clearInactiveTangent(void)
+{
+    inactiveStamp = -1;
+}
+
 /*
 int
 IncrementalIntegrator::setModalDampingFactors(const Vector &factors)
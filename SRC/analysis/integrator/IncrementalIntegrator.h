@@ -111,6 +111,12 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+
+    // methods for staged construction, adding 1.0 to the diagonal of
+    // the equations no active element is connected to
+    int  formInactiveTangent(void);
+    void clearInactiveTangent(void);
+
     int statusFlag;
     double iFactor;
     double cFactor;
@@ -131,6 +137,9 @@ class IncrementalIntegrator : public Integrator
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
 
+    Vector *inactiveDiag;    // 1.0 at the equations of inactive elements only
+    int numInactiveEqn;
+    int inactiveStamp;       // Domain::getActiveStamp() inactiveDiag was formed at
 };
 
 #endif
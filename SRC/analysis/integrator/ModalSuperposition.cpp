@@ -0,0 +1,458 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of the
+// ModalSuperposition class.
+
+#include <ModalSuperposition.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Domain.h>
+#include <Node.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <ElementalLoadIter.h>
+#include <classTags.h>
+#include <ID.h>
+#include <elementAPI.h>
+#include <string.h>
+#include <math.h>
+
+void *
+OPS_ModalSuperposition(void)
+{
+  double dData[2] = {0.5, 0.25};
+  int numModes = 0;
+
+  int numArgs = OPS_GetNumRemainingInputArgs();
+  if (numArgs >= 2) {
+    const char *peek = OPS_GetString();
+    OPS_ResetCurrentInputArg(-1);
+    if (strcmp(peek, "-modes") != 0) {
+      int numData = 2;
+      if (OPS_GetDouble(&numData, dData) != 0) {
+        opserr << "WARNING - invalid args want ModalSuperposition <$gamma $beta> <-modes $numModes>\n";
+        return 0;
+      }
+    }
+  }
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *option = OPS_GetString();
+    if (strcmp(option, "-modes") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+      int numData = 1;
+      if (OPS_GetInt(&numData, &numModes) != 0 || numModes < 0) {
+        opserr << "WARNING - invalid numModes want ModalSuperposition <$gamma $beta> <-modes $numModes>\n";
+        return 0;
+      }
+    } else {
+      opserr << "WARNING - unknown option " << option
+             << " want ModalSuperposition <$gamma $beta> <-modes $numModes>\n";
+      return 0;
+    }
+  }
+
+  return new ModalSuperposition(dData[0], dData[1], numModes);
+}
+
+
+ModalSuperposition::ModalSuperposition()
+  : Newmark(0.5, 0.25, true, false, INTEGRATOR_TAGS_ModalSuperposition),
+    numModes(0), eleLoads(false), basisFormed(false)
+{
+
+}
+
+
+ModalSuperposition::ModalSuperposition(double _gamma, double _beta, int nModes)
+  : Newmark(_gamma, _beta, true, false, INTEGRATOR_TAGS_ModalSuperposition),
+    numModes(nModes), eleLoads(false), basisFormed(false)
+{
+
+}
+
+
+ModalSuperposition::~ModalSuperposition()
+{
+
+}
+
+
+int
+ModalSuperposition::domainChanged(void)
+{
+  if (this->Newmark::domainChanged() < 0)
+    return -1;
+
+  // equation numbers may have changed; gather the modes again when needed
+  basisFormed = false;
+  return 0;
+}
+
+
+int
+ModalSuperposition::formTangent(int statFlag)
+{
+  opserr << "WARNING ModalSuperposition::formTangent() - the response is set in newStep(),"
+         << " use the integrator with a transient analysis\n";
+  return -1;
+}
+
+
+int
+ModalSuperposition::formUnbalance(void)
+{
+  opserr << "WARNING ModalSuperposition::formUnbalance() - the response is set in newStep(),"
+         << " use the integrator with a transient analysis\n";
+  return -1;
+}
+
+
+int
+ModalSuperposition::formNodUnbalance(DOF_Group *theDof)
+{
+  // only the applied nodal loads, the inertia is in the modal equations
+  theDof->zeroUnbalance();
+  theDof->addPtoUnbalance();
+  return 0;
+}
+
+
+int
+ModalSuperposition::newStep(double deltaT)
+{
+  if (beta == 0 || gamma == 0) {
+    opserr << "ModalSuperposition::newStep() - error in variable\n";
+    opserr << "gamma = " << gamma << " beta = " << beta << endln;
+    return -1;
+  }
+
+  if (deltaT <= 0.0) {
+    opserr << "ModalSuperposition::newStep() - error in variable\n";
+    opserr << "dT = " << deltaT << endln;
+    return -2;
+  }
+
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (U == 0 || theModel == 0) {
+    opserr << "ModalSuperposition::newStep() - domainChange() failed or hasn't been called\n";
+    return -3;
+  }
+
+  if (basisFormed == false)
+    if (this->formModalBasis() < 0)
+      return -3;
+
+  (*Ut) = *U;
+  (*Utdot) = *Udot;
+  (*Utdotdot) = *Udotdot;
+  qt = q;
+  qtdot = qdot;
+  qtdotdot = qdotdot;
+
+  // modal loads at t+deltaT
+  double time = theModel->getCurrentDomainTime() + deltaT;
+  theModel->applyLoadDomain(time);
+  if (this->formModalLoad() < 0)
+    return -4;
+
+  // advance each modal equation with the Newmark recurrence
+  double dt2 = deltaT*deltaT;
+  int nModes = q.Size();
+  for (int i = 0; i < nModes; i++) {
+    double qPred = qt(i) + deltaT*qtdot(i) + (0.5 - beta)*dt2*qtdotdot(i);
+    double qdotPred = qtdot(i) + (1.0 - gamma)*deltaT*qtdotdot(i);
+
+    qdotdot(i) = (f(i) - modalC(i)*qdotPred - modalK(i)*qPred) /
+      (modalM(i) + gamma*deltaT*modalC(i) + beta*dt2*modalK(i));
+    q(i) = qPred + beta*dt2*qdotdot(i);
+    qdot(i) = qdotPred + gamma*deltaT*qdotdot(i);
+  }
+
+  // u = Ur + Phi q
+  *U = Ur;
+  U->addMatrixVector(1.0, Phi, q, 1.0);
+  Udot->addMatrixVector(0.0, Phi, qdot, 1.0);
+  Udotdot->addMatrixVector(0.0, Phi, qdotdot, 1.0);
+
+  theModel->setResponse(*U, *Udot, *Udotdot);
+  if (theModel->updateDomain(time, deltaT) < 0) {
+    opserr << "ModalSuperposition::newStep() - failed to update the domain\n";
+    return -4;
+  }
+
+  return 0;
+}
+
+
+int
+ModalSuperposition::revertToLastStep(void)
+{
+  if (basisFormed == true) {
+    q = qt;
+    qdot = qtdot;
+    qdotdot = qtdotdot;
+  }
+
+  return this->Newmark::revertToLastStep();
+}
+
+
+int
+ModalSuperposition::update(const Vector &deltaU)
+{
+  opserr << "WARNING ModalSuperposition::update() - the response is set in newStep(),"
+         << " use the integrator with a transient analysis\n";
+  return -1;
+}
+
+
+int
+ModalSuperposition::formModalLoad(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  int nModes = Phi.noCols();
+
+  f.Zero();
+
+  // nodal loads
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = theModel->getDOFs();
+  while ((dofPtr = theDOFs()) != 0) {
+    const ID &id = dofPtr->getID();
+    const Vector &P = dofPtr->getUnbalance(this);
+    for (int j = 0; j < id.Size(); j++) {
+      int loc = id(j);
+      if (loc < 0 || P(j) == 0.0)
+        continue;
+      for (int i = 0; i < nModes; i++)
+        f(i) += Phi(loc, i) * P(j);
+    }
+  }
+
+  // element loads: the residual p - K u - C v - M a at the state of
+  // time t with the loads of t+deltaT, plus K u + C v + M a
+  if (eleLoads == true) {
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theModel->getFEs();
+    while ((elePtr = theEles()) != 0) {
+      const ID &id = elePtr->getID();
+      const Vector &R = elePtr->getResidual(this);
+      for (int j = 0; j < id.Size(); j++) {
+        int loc = id(j);
+        if (loc < 0 || R(j) == 0.0)
+          continue;
+        for (int i = 0; i < nModes; i++)
+          f(i) += Phi(loc, i) * R(j);
+      }
+    }
+
+    f.addMatrixTransposeVector(1.0, KPhi, *U, 1.0);
+    f.addMatrixTransposeVector(1.0, CPhi, *Udot, 1.0);
+    f.addMatrixTransposeVector(1.0, MPhi, *Udotdot, 1.0);
+  }
+
+  // the part of the starting displacement outside the modes
+  f.addVector(1.0, fr, -1.0);
+
+  return 0;
+}
+
+
+int
+ModalSuperposition::formModalBasis(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  Domain *theDomain = theModel->getDomainPtr();
+  int numAvailable = theDomain->getEigenvalues().Size();
+  if (numAvailable == 0) {
+    opserr << "WARNING ModalSuperposition - no eigenvectors at the nodes, run an eigen analysis first\n";
+    return -1;
+  }
+
+  int nModes = numAvailable;
+  if (numModes > 0 && numModes < numAvailable)
+    nModes = numModes;
+  else if (numModes > numAvailable)
+    opserr << "WARNING ModalSuperposition - only " << numAvailable
+           << " modes are available, using them all\n";
+
+  int numEqn = theModel->getNumEqn();
+  Phi.resize(numEqn, nModes);
+  Phi.Zero();
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = theModel->getDOFs();
+  while ((dofPtr = theDOFs()) != 0) {
+    Node *theNode = theDomain->getNode(dofPtr->getNodeTag());
+    if (theNode == 0)
+      continue;
+
+    if (theNode->getNumEigenvectors() < nModes) {
+      opserr << "WARNING ModalSuperposition - node " << theNode->getTag()
+             << " does not hold " << nModes << " eigenvectors\n";
+      return -1;
+    }
+    const Matrix &theEigenvectors = theNode->getEigenvectors();
+
+    const ID &id = dofPtr->getID();
+    int n = id.Size();
+    if (n > theEigenvectors.noRows())
+      n = theEigenvectors.noRows();
+
+    for (int j = 0; j < n; j++) {
+      int loc = id(j);
+      if (loc >= 0)
+        for (int i = 0; i < nModes; i++)
+          Phi(loc, i) = theEigenvectors(j, i);
+    }
+  }
+
+  KPhi.resize(numEqn, nModes);
+  CPhi.resize(numEqn, nModes);
+  MPhi.resize(numEqn, nModes);
+  KPhi.Zero();
+  CPhi.Zero();
+  MPhi.Zero();
+  modalM.resize(nModes);
+  modalC.resize(nModes);
+  modalK.resize(nModes);
+  f.resize(nModes);
+  fr.resize(nModes);
+  qt.resize(nModes);
+  qtdot.resize(nModes);
+  qtdotdot.resize(nModes);
+  q.resize(nModes);
+  qdot.resize(nModes);
+  qdotdot.resize(nModes);
+  Ur.resize(numEqn);
+
+  Vector phi(numEqn);
+  Vector Mphi(numEqn);   // element and nodal mass times phi
+  Vector Cphi(numEqn);   // element and nodal damping times phi
+  bool eleMass = false;
+
+  for (int i = 0; i < nModes; i++) {
+    for (int j = 0; j < numEqn; j++)
+      phi(j) = Phi(j, i);
+
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theModel->getFEs();
+    while ((elePtr = theEles()) != 0) {
+      const ID &id = elePtr->getID();
+      const Vector &fk = elePtr->getK_Force(phi, 1.0);
+      for (int j = 0; j < id.Size(); j++)
+        if (id(j) >= 0)
+          KPhi(id(j), i) += fk(j);
+      const Vector &fc = elePtr->getC_Force(phi, 1.0);
+      for (int j = 0; j < id.Size(); j++)
+        if (id(j) >= 0)
+          CPhi(id(j), i) += fc(j);
+      const Vector &fm = elePtr->getM_Force(phi, 1.0);
+      for (int j = 0; j < id.Size(); j++)
+        if (id(j) >= 0 && fm(j) != 0.0) {
+          MPhi(id(j), i) += fm(j);
+          eleMass = true;
+        }
+    }
+
+    for (int j = 0; j < numEqn; j++) {
+      Mphi(j) = MPhi(j, i);
+      Cphi(j) = CPhi(j, i);
+    }
+
+    DOF_GrpIter &theDOFs2 = theModel->getDOFs();
+    while ((dofPtr = theDOFs2()) != 0) {
+      if (dofPtr->getNodeTag() < 0)
+        continue;
+      const ID &id = dofPtr->getID();
+      const Vector &fm = dofPtr->getM_Force(phi, 1.0);
+      for (int j = 0; j < id.Size(); j++)
+        if (id(j) >= 0)
+          Mphi(id(j)) += fm(j);
+      const Vector &fc = dofPtr->getC_Force(phi, 1.0);
+      for (int j = 0; j < id.Size(); j++)
+        if (id(j) >= 0)
+          Cphi(id(j)) += fc(j);
+    }
+
+    modalM(i) = phi ^ Mphi;
+    modalC(i) = phi ^ Cphi;
+    modalK(i) = 0.0;
+    for (int j = 0; j < numEqn; j++)
+      modalK(i) += phi(j) * KPhi(j, i);
+
+    if (modalM(i) <= 0.0) {
+      opserr << "WARNING ModalSuperposition - non-positive modal mass "
+             << modalM(i) << " in mode " << i + 1 << endln;
+      return -1;
+    }
+
+    // starting modal response, the modes being orthogonal in M
+    q(i) = (Mphi ^ *U) / modalM(i);
+    qdot(i) = (Mphi ^ *Udot) / modalM(i);
+    qdotdot(i) = (Mphi ^ *Udotdot) / modalM(i);
+  }
+
+  // domain modal damping on top of the element and nodal damping
+  const Vector *modalDamping = theModel->getModalDampingFactors();
+  if (modalDamping != 0) {
+    for (int i = 0; i < nModes && i < modalDamping->Size(); i++)
+      if (modalK(i) > 0.0)
+        modalC(i) += 2.0 * (*modalDamping)(i) * sqrt(modalK(i) * modalM(i));
+  }
+
+  // the starting displacement outside the modes is held fixed
+  Ur = *U;
+  Ur.addMatrixVector(1.0, Phi, q, -1.0);
+  fr.addMatrixTransposeVector(0.0, KPhi, Ur, 1.0);
+
+  // element loads and element inertia are only known to the elements
+  eleLoads = false;
+  LoadPattern *thePattern;
+  LoadPatternIter &thePatterns = theDomain->getLoadPatterns();
+  while ((thePattern = thePatterns()) != 0 && eleLoads == false) {
+    ElementalLoadIter &theLoads = thePattern->getElementalLoads();
+    if (theLoads() != 0)
+      eleLoads = true;
+    else if (eleMass == true && thePattern->getClassTag() == PATTERN_TAG_UniformExcitation)
+      eleLoads = true;
+  }
+
+  basisFormed = true;
+  return 0;
+}
+
+
+void
+ModalSuperposition::Print(OPS_Stream &s, int flag)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel != 0) {
+    double currentTime = theModel->getCurrentDomainTime();
+    s << "\t ModalSuperposition - currentTime: " << currentTime;
+    s << "  gamma: " << gamma << "  beta: " << beta << endln;
+    s << "  modes: " << Phi.noCols() << endln;
+  } else
+    s << "\t ModalSuperposition - no associated AnalysisModel\n";
+}
@@ -0,0 +1,88 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ModalSuperposition_h
+#define ModalSuperposition_h
+
+// Description: This file contains the class definition for
+// ModalSuperposition. ModalSuperposition integrates a linear model in
+// the modal coordinates q of the eigenvectors stored at the nodes (from
+// a previous eigen analysis). Each step the external load is projected
+// onto the modes, f = Phi' p, every modal equation
+//
+//    m_i q_i'' + c_i q_i' + k_i q_i = f_i
+//
+// is advanced on its own with the Newmark (gamma, beta) recurrence, and
+// the nodal response is set to u = Phi q. The modal mass, damping and
+// stiffness are formed once from the element and nodal matrices, plus
+// the domain modal damping factors; the off-diagonal terms of Phi' C Phi
+// are dropped, i.e. the damping is taken as classical.
+//
+// The nodal loads are projected directly. Element loads and the
+// inertia of element mass under a UniformExcitation are only known to
+// the elements, so when the model has them the element residuals are
+// formed at the start of the step and the element K u + C v + M a
+// removed again to leave the element loads.
+//
+// The step is complete after newStep(), so the analysis does not call
+// the algorithm and no system of equations is formed or solved.
+
+#include <Newmark.h>
+#include <Matrix.h>
+#include <Vector.h>
+
+class ModalSuperposition : public Newmark
+{
+public:
+    ModalSuperposition();
+    ModalSuperposition(double gamma, double beta, int numModes = 0);
+    ~ModalSuperposition();
+
+    int formTangent(int statusFlag = CURRENT_TANGENT);
+    int formUnbalance(void);
+    int formNodUnbalance(DOF_Group *theDof);
+
+    int domainChanged(void);
+    int newStep(double deltaT);
+    int revertToLastStep(void);
+    int update(const Vector &deltaU);
+
+    bool setsStepResponse(void) {return true;};
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+private:
+    int formModalBasis(void);
+    int formModalLoad(void);
+
+    int numModes;              // number of modes requested, 0 for all available
+    Matrix Phi;                // mode shapes in equation numbering
+    Matrix KPhi, CPhi, MPhi;   // element stiffness, damping and mass times Phi
+    Vector modalM, modalC, modalK;  // modal mass, damping and stiffness
+    Vector f;                  // modal load at t+deltaT
+    Vector fr;                 // modal force of Ur
+    Vector Ur;                 // displacement at the start outside the span of Phi
+    Vector qt, qtdot, qtdotdot;  // modal response at t
+    Vector q, qdot, qdotdot;     // modal response at t+deltaT
+    bool eleLoads;             // element loads or element inertia to project
+    bool basisFormed;
+};
+
+#endif
@@ -311,8 +311,40 @@ int Newmark::formNodTangent(DOF_Group *theDof)
 }    
 
 
+bool Newmark::getLumpedMassFactor(double &factor)
+{
+    // formEleTangent() adds c3 M for every tangent flag
+    if (determiningMass == true)
+        return false;
+
+    factor = c3;
+    return true;
+}
+
+
+bool Newmark::getTangentFactors(double &cK, double &cC, double &cM)
+{
+    // the tangent and initial stiffness of a linear element are the same
+    if (determiningMass == true)
+        return false;
+
+    if (statusFlag == CURRENT_TANGENT || statusFlag == INITIAL_TANGENT)
+        cK = c1;
+    else if (statusFlag == HALL_TANGENT)
+        cK = c1*(cFactor + iFactor);
+    else
+        return false;
+
+    cC = c2;
+    cM = c3;
+    return true;
+}
+
+
 int Newmark::domainChanged()
 {
+    this->clearLumpedMass();
+
     AnalysisModel *myModel = this->getAnalysisModel();
     LinearSOE *theLinSOE = this->getLinearSOE();
     const Vector &x = theLinSOE->getX();
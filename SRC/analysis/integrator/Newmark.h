@@ -84,6 +84,9 @@ public:
     // AddingSensitivity:END ////////////////////////////////////
     
 protected:
+    bool getLumpedMassFactor(double &factor);
+    bool getTangentFactors(double &cK, double &cC, double &cM);
+
     int displ;      // a flag indicating whether displ(1), vel(2) or accel(3) increments
     double gamma;
     double beta;
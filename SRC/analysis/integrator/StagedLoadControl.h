@@ -58,6 +58,7 @@ public:
 
 
     int  formTangent(int statusFlag = CURRENT_TANGENT);
+    int  domainChanged(void);
 
 
 };
@@ -116,15 +116,7 @@ StagedNewmark::StagedNewmark(double _gamma, double _beta, bool dispFlag, bool af
 
 int StagedNewmark::formTangent(int statFlag)
 {
-    int rank = 0;
-    int nproc = 1;
-
-    #ifdef _PARALLEL_PROCESSING
-    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-    MPI_Comm_size(MPI_COMM_WORLD, &nproc);
-    #endif
-
-    // Run a typocal LoadControl formTangent call
+    // Run a typical IncrementalIntegrator formTangent call, inactive elements add nothing
     int errflag = this->IncrementalIntegrator::formTangent(statFlag);
 
     if (errflag < 0)
@@ -132,84 +124,14 @@ int StagedNewmark::formTangent(int statFlag)
         return errflag;
     }
 
-    // Now detect inactive nodes and add 1 to the tangent diagonal there
-
-    AnalysisModel *theAnalysisModel = this->getAnalysisModel();
-    Domain *theDomain = theAnalysisModel->getDomainPtr();
-    LinearSOE *theSOE = this->getLinearSOE();
-    int numEqn = theSOE->getNumEqn();
-
-    int * nodedofs = new int[numEqn + 1];
-    #ifdef _PARALLEL_PROCESSING
-    int * allnodedofs = new int[numEqn + 1];
-    #endif
-
-    for (int i = 0; i < numEqn; ++i)
-    {
-        nodedofs[i] = 0;
-    #ifdef _PARALLEL_PROCESSING
-        allnodedofs[i] = 0;
-    #endif
-    }
-
-    FE_Element *elePtr = 0;
-
-    FE_EleIter &theEles = theAnalysisModel->getFEs();
-
-    while ((elePtr = theEles()) != 0) {
-        const ID& elenodedofs = elePtr->getID();
-
-        for (int i = 0; i < elenodedofs.Size(); ++i)
-        {
-            int dof = elenodedofs(i);
-            if (dof > numEqn)
-            {
-                std::cout << "i = " << i << std::endl;
-                std::cout << "numEqn = " << numEqn << std::endl;
-                std::cout << "elenodedofs(i) = " << dof << std::endl;
-                exit(-1);
-            }
-            // std::cout << "i = " << i << " numEqn = " << numEqn << " dof = " << dof << std::endl;
-            if (dof >= 0 && elePtr->isActive())
-            {
-
-                nodedofs[dof] = (int) 1;
-            }
-            
-        }
-    }
-
-
-    #ifdef _PARALLEL_PROCESSING
-    MPI_Allreduce(nodedofs, allnodedofs, numEqn, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
-    #endif
-
-
-    for (int i = 0; i < numEqn; ++i)
-    {
-        #ifdef _PARALLEL_PROCESSING
-        bool is_lonely_dof = allnodedofs[i] == 0;
-        #else
-        bool is_lonely_dof = nodedofs[i] == 0;
-        #endif
-
-        if (is_lonely_dof)
-        {
-            // opserr << "i = " << i << " nodedofs(i) = " << nodedofs[i] << endln;
-            double uno = 1.0;
-            static ID dofid(1);
-            static Matrix one(1, 1);
-            one(0, 0) = uno;
-            dofid(0) = i;
-            theSOE->addA(one, dofid);
-        }
-    }
-
-    delete [] nodedofs;
+    // Now add 1 to the tangent diagonal at the dofs of inactive elements only
+    return this->formInactiveTangent();
+}
 
-    #ifdef _PARALLEL_PROCESSING
-    delete [] allnodedofs;
-    #endif
 
-    return errflag;
+int StagedNewmark::domainChanged(void)
+{
+    // the equation numbers may have changed
+    this->clearInactiveTangent();
+    return this->Newmark::domainChanged();
 }
@@ -34,6 +34,7 @@ public:
     StagedNewmark(double gamma, double beta, bool disp = true, bool aflag=false);
 
     int  formTangent(int statusFlag = CURRENT_TANGENT);
+    int  domainChanged(void);
 
 
 private:
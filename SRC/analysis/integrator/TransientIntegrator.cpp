@@ -39,21 +39,27 @@
 #include <TransientIntegrator.h>
 #include <FE_Element.h>
 #include <LinearSOE.h>
+#include <Profiler.h>
 #include <AnalysisModel.h>
 #include <Vector.h>
+#include <Matrix.h>
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Domain.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
-:IncrementalIntegrator(clasTag)
+:IncrementalIntegrator(clasTag),
+ lumpedMass(0), lumpedEles(), lumpedEleStamps(), numLumpedEles(0), lumpedMassFormed(false),
+ lumpedStamp(-1)
 {
 
 }
 
 TransientIntegrator::~TransientIntegrator()
 {
-
+  if (lumpedMass != 0)
+    delete lumpedMass;
 }
 
 int 
@@ -67,6 +73,7 @@ TransientIntegrator::formTangent(int statFlag, double iFact, double cFact)
 int 
 TransientIntegrator::formTangent(int statFlag)
 {
+    OPS_PROFILE_SCOPE("formTangent");
     int result = 0;
     statusFlag = statFlag;
 
@@ -83,6 +90,18 @@ TransientIntegrator::formTangent(int statFlag)
     
     theLinSOE->zeroA();
 
+    // add the lumped element masses straight to the diagonal
+    double massFactor = 0.0;
+    bool lumped = this->getLumpedMassFactor(massFactor);
+    if (lumped == true && this->lumpedMassChanged() == true)
+      this->formLumpedMass();
+    lumped = lumped && numLumpedEles > 0;
+
+    if (lumped == true && theLinSOE->addDiagA(*lumpedMass, massFactor) < 0) {
+	opserr << "TransientIntegrator::formTangent() - failed to addDiagA\n";
+	result = -3;
+    }
+
     // do modal damping
     bool inclModalMatrix=theModel->inclModalDampingMatrix();
     if (inclModalMatrix == true) {
@@ -107,19 +126,125 @@ TransientIntegrator::formTangent(int statFlag)
     // loop through the FE_Elements getting them to add the tangent    
     FE_EleIter &theEles2 = theModel->getFEs();    
     FE_Element *elePtr;    
+    double cK = 0.0, cC = 0.0, cM = 0.0;
+    bool linear = this->getTangentFactors(cK, cC, cM);
+    int numEle = lumpedEles.Size();
+    int eleCount = 0;
     while((elePtr = theEles2()) != 0)     {
-	if (theLinSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
+	bool skipMass = lumped == true && eleCount < numEle && lumpedEles(eleCount) != 0;
+	eleCount++;
+
+	// inactive elements add nothing, A keeps its structure
+	if (elePtr->isActive() == false)
+	    continue;
+
+	if (skipMass == true)
+	    elePtr->setLumpedMass(true);
+	const Matrix &theTangent = (linear == true) ?
+	    elePtr->getLinearTangent(this, cK, cC, cM) : elePtr->getTangent(this);
+	if (theLinSOE->addA(theTangent,elePtr->getID()) < 0) {
 	    opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
 	    result = -2;
 	}
+	if (skipMass == true)
+	    elePtr->setLumpedMass(false);
     }
     return result;
 }
 
 
+// getLumpedMassFactor(double &factor):
+//      integrators that add c times the element mass to every element
+//      tangent set factor to c and return true; the default leaves the
+//      mass with the elements.
+bool
+TransientIntegrator::getLumpedMassFactor(double &factor)
+{
+  return false;
+}
+
+// getTangentFactors(double &cK, double &cC, double &cM):
+//      integrators whose element tangent, for the current tangent flag,
+//      is cK K + cC C + cM M set the factors and return true.
+bool
+TransientIntegrator::getTangentFactors(double &cK, double &cC, double &cM)
+{
+  return false;
+}
+
+void
+TransientIntegrator::clearLumpedMass(void)
+{
+  lumpedMassFormed = false;
+  numLumpedEles = 0;
+}
+
+// lumpedMassChanged():
+//      returns true if lumpedMass has not been formed, or if the active
+//      stamp of the Domain or the matrix stamp of any element has changed
+//      since, e.g. on an updateParameter() of an element mass.
+bool
+TransientIntegrator::lumpedMassChanged(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (lumpedMassFormed == false ||
+      lumpedStamp != theModel->getDomainPtr()->getActiveStamp())
+    return true;
+
+  int numEle = lumpedEleStamps.Size();
+  int eleCount = 0;
+  FE_EleIter &theEles = theModel->getFEs();
+  FE_Element *elePtr;
+  while((elePtr = theEles()) != 0) {
+    if (eleCount >= numEle || lumpedEleStamps(eleCount) != elePtr->getMatrixStamp())
+      return true;
+    eleCount++;
+  }
+
+  return eleCount != numEle;
+}
+
+int
+TransientIntegrator::formLumpedMass(void)
+{
+  LinearSOE *theLinSOE = this->getLinearSOE();
+  AnalysisModel *theModel = this->getAnalysisModel();
+
+  int numEqn = theLinSOE->getNumEqn();
+  if (lumpedMass == 0 || lumpedMass->Size() != numEqn) {
+    if (lumpedMass != 0)
+      delete lumpedMass;
+    lumpedMass = new Vector(numEqn);
+  } else
+    lumpedMass->Zero();
+
+  // elements whose mass matrix is not diagonal keep adding it themselves
+  numLumpedEles = 0;
+  int numEle = 0;
+  FE_EleIter &theEles = theModel->getFEs();    
+  FE_Element *elePtr;    
+  while((elePtr = theEles()) != 0) {
+    lumpedEles[numEle] = 0;
+    lumpedEleStamps[numEle] = elePtr->getMatrixStamp();
+    if (elePtr->addLumpedMass(*lumpedMass) == 0) {
+      lumpedEles[numEle] = 1;
+      numLumpedEles++;
+    }
+    numEle++;
+  }
+  lumpedEles.resize(numEle);
+  lumpedEleStamps.resize(numEle);
+
+  lumpedMassFormed = true;
+  lumpedStamp = theModel->getDomainPtr()->getActiveStamp();
+  return numLumpedEles;
+}
+
+
     
 int
 TransientIntegrator::formUnbalance(void) {
+    OPS_PROFILE_SCOPE("formUnbalance");
     LinearSOE *theLinSOE = this->getLinearSOE();
     AnalysisModel *theModel = this->getAnalysisModel();
 
@@ -34,12 +34,27 @@
 // equations for a static analysis and for Incrementing the nodal displacements
 // with the values in the soln vector to the LinearSOE object. 
 //
+// Integrators that add the mass to the element tangents with a single
+// factor can return it from getLumpedMassFactor(). formTangent() then
+// assembles the diagonal masses of the elements once, in equation
+// numbering, and adds them to the diagonal of the LinearSOE directly;
+// those elements skip getMass() when forming their tangent. The masses
+// are assembled again when the active stamp of the Domain or the matrix
+// stamp of an element changes (e.g. on updateParameter()), or when
+// clearLumpedMass() is invoked, which the integrators do in domainChanged().
+//
+// Integrators that form the element tangent as cK K + cC C + cM M can
+// return the factors from getTangentFactors(); the tangents of linear
+// elements are then kept by the FE_Elements between iterations and
+// steps as long as the factors do not change.
+//
 // What: "@(#) TransientIntegrator.h, revA"
 
 #ifndef TransientIntegrator_h
 #define TransientIntegrator_h
 
 #include <IncrementalIntegrator.h>
+#include <ID.h>
 class Information;
 class LinearSOE;
 class AnalysisModel;
@@ -66,9 +81,25 @@ class TransientIntegrator : public IncrementalIntegrator
     
     virtual int initialize(void) {return 0;};
 
+    // true if newStep() sets the response of the step by itself, in
+    // which case the analysis does not call the algorithm
+    virtual bool setsStepResponse(void) {return false;};
+
   protected:
+    virtual bool getLumpedMassFactor(double &factor);
+    virtual bool getTangentFactors(double &cK, double &cC, double &cM);
+    void clearLumpedMass(void);
     
   private:
+    int formLumpedMass(void);
+    bool lumpedMassChanged(void);
+
+    Vector *lumpedMass;      // diagonal element masses in equation numbering
+    ID lumpedEles;           // 1 if the mass of the i'th FE_Element is in lumpedMass
+    ID lumpedEleStamps;      // matrix stamps of the FE_Elements lumpedMass was formed at
+    int numLumpedEles;
+    bool lumpedMassFormed;
+    int lumpedStamp;         // Domain::getActiveStamp() lumpedMass was formed at
 };
 
 #endif
@@ -45,6 +45,7 @@
 #include <DOF_GrpIter.h>
 #include <FE_EleIter.h>
 #include <Graph.h>
+#include <MemoryReport.h>
 #include <Vertex.h>
 #include <Node.h>
 #include <NodeIter.h>
@@ -747,3 +748,25 @@ AnalysisModel::recvSelf(int cTag, Channel &theChannel,
     return 0;
 }
 
+
+void
+AnalysisModel::reportMemory(MemoryReport &theReport)
+{
+  theReport.add("analysis model", "AnalysisModel", sizeof(AnalysisModel));
+
+  FE_Element *fePtr;
+  FE_EleIter &theEles = this->getFEs();
+  while ((fePtr = theEles()) != 0)
+    fePtr->reportMemory(theReport);
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = this->getDOFs();
+  while ((dofPtr = theDofs()) != 0)
+    dofPtr->reportMemory(theReport);
+
+  // the graphs are only there once the system has been sized
+  if (myDOFGraph != 0)
+    myDOFGraph->reportMemory(theReport, "analysis model");
+  if (myGroupGraph != 0)
+    myGroupGraph->reportMemory(theReport, "analysis model");
+}
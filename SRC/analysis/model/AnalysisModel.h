@@ -51,6 +51,7 @@ class DOF_Group;
 class Vector;
 class FEM_ObjectBroker;
 class ConstraintHandler;
+class MemoryReport;
 
 class AnalysisModel: public MovableObject
 {
@@ -121,6 +122,10 @@ class AnalysisModel: public MovableObject
 
     Domain *getDomainPtr(void) const;
 
+    // method to add the bytes held by the FE_Elements, DOF_Groups and
+    // graphs to a memory report
+    virtual void reportMemory(MemoryReport &theReport);
+
   protected:
 
     
@@ -893,6 +893,7 @@
 #define ELE_TAG_ShellNLDKGTThermal		   268 // Giovanni Rinaldin
 #define ELE_TAG_Pipe                      269
 #define ELE_TAG_CurvedPipe                      270
+#define ELE_TAG_CondensedSubstructure     271
 
 
 #define FRN_TAG_Coulomb            1
@@ -1095,6 +1096,7 @@
 #define INTEGRATOR_TAGS_StagedLoadControl               58
 #define INTEGRATOR_TAGS_StagedNewmark                   59
 #define INTEGRATOR_TAGS_HarmonicSteadyState             60
+#define INTEGRATOR_TAGS_ModalSuperposition              61
 
 
 #define LinSOE_TAGS_FullGenLinSOE		1
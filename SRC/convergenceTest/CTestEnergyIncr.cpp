@@ -36,6 +36,7 @@
 
 #include <CTestEnergyIncr.h>
 #include <Vector.h>
+#include <Profiler.h>
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
@@ -129,6 +130,7 @@ int CTestEnergyIncr::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestEnergyIncr::test(void)
 {
+    OPS_PROFILE_SCOPE("test");
     // check to ensure the SOE has been set - this should not happen if the 
     // return from start() is checked
     if (theSOE == 0) {
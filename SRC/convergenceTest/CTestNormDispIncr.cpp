@@ -25,6 +25,7 @@
 
 #include <CTestNormDispIncr.h>
 #include <Vector.h>
+#include <Profiler.h>
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
@@ -119,6 +120,7 @@ int CTestNormDispIncr::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestNormDispIncr::test(void)
 {
+    OPS_PROFILE_SCOPE("test");
     // check to ensure the SOE has been set - this should not happen if the 
     // return from start() is checked
     if (theSOE == 0) {
@@ -25,6 +25,7 @@
 
 #include <CTestNormUnbalance.h>
 #include <Vector.h>
+#include <Profiler.h>
 #include <Channel.h>
 #include <EquiSolnAlgo.h>
 #include <LinearSOE.h>
@@ -122,6 +123,7 @@ int CTestNormUnbalance::setEquiSolnAlgo(EquiSolnAlgo &theAlgo)
 
 int CTestNormUnbalance::test(void)
 {
+    OPS_PROFILE_SCOPE("test");
     // check to ensure the SOE has been set - this should not happen if the 
     // return from start() is checked
     if (theSOE == 0) {
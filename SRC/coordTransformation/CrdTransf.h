@@ -62,6 +62,7 @@ public:
   
     virtual int    initialize(Node *node1Pointer, Node *node2Pointer) = 0;
     virtual int    update(void) = 0;
+    virtual bool   isReentrant(void) {return false;}  // update() writes no statics
     virtual double getInitialLength(void) = 0;
     virtual double getDeformedLength(void) = 0;
     
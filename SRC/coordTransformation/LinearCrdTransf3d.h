@@ -55,6 +55,7 @@ public:
     
     int initialize(Node *node1Pointer, Node *node2Pointer);
     int update(void);
+    bool isReentrant(void) {return true;}
     double getInitialLength(void);
     double getDeformedLength(void);
     
@@ -0,0 +1,603 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for LogDatastore.
+//
+// The layout of the file is:
+//
+//   data data ... index trailer data data ... index trailer ...
+//
+// where an index is
+//
+//   int magic, int numEntries, int64 previousIndex,
+//   numEntries x {int type, numRows, numCols, dbTag, commitTag, flags,
+//                 length, int64 offset, uint64 hash}
+//
+// and a trailer is {int64 indexOffset, int magic}. Data written after the
+// last trailer, e.g. by a run that did not finish its commit, is ignored.
+
+#include "LogDatastore.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#include <FEM_ObjectBroker.h>
+#include <Domain.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+#ifdef _WIN32
+#define LOG_FSEEK _fseeki64
+#define LOG_FTELL _ftelli64
+#else
+#include <sys/mman.h>
+#define LOG_FSEEK fseeko
+#define LOG_FTELL ftello
+#endif
+
+#ifdef _ZLIB
+#include <zlib.h>
+#endif
+
+#define LOG_ID     1
+#define LOG_VECTOR 2
+#define LOG_MATRIX 3
+
+static const int indexMagic   = 0x4f50534c;  // "OPSL"
+static const int trailerMagic = 0x4f505354;  // "OPST"
+static const int headerSize   = 2*sizeof(int) + sizeof(long long);
+static const int entrySize    = 7*sizeof(int) + sizeof(long long) + sizeof(unsigned long long);
+static const int trailerSize  = sizeof(long long) + sizeof(int);
+
+// FNV-1a hash of the data, used to find objects that did not change
+static unsigned long long
+hashData(const char *theData, int numBytes)
+{
+  unsigned long long hash = 14695981039346656037ULL;
+  for (int i = 0; i < numBytes; i++) {
+    hash ^= (unsigned char)theData[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+template <class T> static void
+pack(char *&loc, T value)
+{
+  memcpy(loc, &value, sizeof(T));
+  loc += sizeof(T);
+}
+
+template <class T> static T
+unpack(const char *&loc)
+{
+  T value;
+  memcpy(&value, loc, sizeof(T));
+  loc += sizeof(T);
+  return value;
+}
+
+
+bool
+LogDatastore::Key::operator<(const Key &other) const
+{
+  if (type != other.type) return type < other.type;
+  if (numRows != other.numRows) return numRows < other.numRows;
+  if (numCols != other.numCols) return numCols < other.numCols;
+  if (dbTag != other.dbTag) return dbTag < other.dbTag;
+  return commitTag < other.commitTag;
+}
+
+
+LogDatastore::LogDatastore(const char *dataBaseName,
+			   Domain &theDomain,
+			   FEM_ObjectBroker &theObjBroker,
+			   bool compressData,
+			   int sizeBuffer)
+  :FE_Datastore(theDomain, theObjBroker),
+   fileName(0), theFile(0), fileEnd(0), flushedEnd(0), lastIndex(-1),
+   bufferSize(sizeBuffer), compress(compressData), mapData(0), mapSize(0)
+{
+  fileName = new char [strlen(dataBaseName)+1];
+  strcpy(fileName, dataBaseName);
+
+  if (bufferSize < 0)
+    bufferSize = 0;
+
+#ifndef _ZLIB
+  if (compress == true) {
+    opserr << "WARNING LogDatastore::LogDatastore() - not built with zlib, ";
+    opserr << "the data will not be compressed\n";
+    compress = false;
+  }
+#endif
+
+  theFile = fopen(fileName, "a+b");
+  if (theFile == 0) {
+    opserr << "LogDatastore::LogDatastore() - could not open file: " << fileName << endln;
+    return;
+  }
+
+  LOG_FSEEK(theFile, 0, SEEK_END);
+  fileEnd = LOG_FTELL(theFile);
+  flushedEnd = fileEnd;
+
+  if (fileEnd > 0 && this->readIndex() < 0)
+    opserr << "WARNING LogDatastore::LogDatastore() - no index found in file: " << fileName << endln;
+}
+
+
+LogDatastore::~LogDatastore()
+{
+  if (theFile != 0) {
+    // objects sent since the last commitState() are not indexed, the
+    // file ends with the last complete checkpoint
+    newEntries.clear();
+    this->flush();
+    this->unmapFile();
+    fclose(theFile);
+  }
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+
+int
+LogDatastore::commitState(int commitTag)
+{
+  int result = FE_Datastore::commitState(commitTag);
+
+  // an incomplete checkpoint is not indexed
+  if (result < 0) {
+    opserr << "LogDatastore::commitState() - failed to send the domain, ";
+    opserr << "commitTag " << commitTag << " is not written to file: " << fileName << endln;
+    newEntries.clear();
+    return result;
+  }
+
+  // the checkpoint is only complete once its index is in the file
+  if (this->writeIndex() < 0 || this->flush() < 0) {
+    opserr << "LogDatastore::commitState() - failed to write the index to file: " << fileName << endln;
+    return -1;
+  }
+
+  return result;
+}
+
+
+int
+LogDatastore::sendMsg(int dataTag, int commitTag,
+		      const Message &,
+		      ChannelAddress *theAddress)
+{
+  opserr << "LogDatastore::sendMsg() - not yet implemented\n";
+  return -1;
+}
+
+int
+LogDatastore::recvMsg(int dataTag, int commitTag,
+		      Message &,
+		      ChannelAddress *theAddress)
+{
+  opserr << "LogDatastore::recvMsg() - not yet implemented\n";
+  return -1;
+}
+
+int
+LogDatastore::recvMsgUnknownSize(int dataTag, int commitTag,
+				 Message &,
+				 ChannelAddress *theAddress)
+{
+  opserr << "LogDatastore::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}
+
+
+int
+LogDatastore::sendMatrix(int dataTag, int commitTag,
+			 const Matrix &theMatrix,
+			 ChannelAddress *theAddress)
+{
+  int numRows = theMatrix.noRows();
+  int numCols = theMatrix.noCols();
+  return this->sendData(LOG_MATRIX, dataTag, commitTag, numRows, numCols,
+			(const char *)theMatrix.data, numRows*numCols*sizeof(double));
+}
+
+int
+LogDatastore::recvMatrix(int dataTag, int commitTag,
+			 Matrix &theMatrix,
+			 ChannelAddress *theAddress)
+{
+  int numRows = theMatrix.noRows();
+  int numCols = theMatrix.noCols();
+  return this->recvData(LOG_MATRIX, dataTag, commitTag, numRows, numCols,
+			(char *)theMatrix.data, numRows*numCols*sizeof(double));
+}
+
+
+int
+LogDatastore::sendVector(int dataTag, int commitTag,
+			 const Vector &theVector,
+			 ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  return this->sendData(LOG_VECTOR, dataTag, commitTag, size, 1,
+			(const char *)theVector.theData, size*sizeof(double));
+}
+
+int
+LogDatastore::recvVector(int dataTag, int commitTag,
+			 Vector &theVector,
+			 ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  return this->recvData(LOG_VECTOR, dataTag, commitTag, size, 1,
+			(char *)theVector.theData, size*sizeof(double));
+}
+
+
+int
+LogDatastore::sendID(int dataTag, int commitTag,
+		     const ID &theID,
+		     ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  return this->sendData(LOG_ID, dataTag, commitTag, size, 1,
+			(const char *)theID.data, size*sizeof(int));
+}
+
+int
+LogDatastore::recvID(int dataTag, int commitTag,
+		     ID &theID,
+		     ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  return this->recvData(LOG_ID, dataTag, commitTag, size, 1,
+			(char *)theID.data, size*sizeof(int));
+}
+
+
+int
+LogDatastore::sendData(int type, int dbTag, int commitTag, int numRows, int numCols,
+		       const char *theData, int numBytes)
+{
+  if (theFile == 0) {
+    opserr << "LogDatastore::send() - no file open\n";
+    return -1;
+  }
+
+  Key key = {type, numRows, numCols, dbTag, commitTag};
+  Key last = {type, numRows, numCols, dbTag, 0};
+
+  unsigned long long hash = hashData(theData, numBytes);
+
+  // if the object has not changed since it was last sent, the new entry
+  // refers to the data already written
+  Entry entry;
+  std::map<Key, Entry>::iterator lastIter = lastSent.find(last);
+  if (lastIter != lastSent.end() && lastIter->second.hash == hash) {
+    entry = lastIter->second;
+
+  } else {
+    const char *out = theData;
+    int length = numBytes;
+    int flags = 0;
+
+#ifdef _ZLIB
+    if (compress == true && numBytes > 64) {
+      uLongf sizeOut = compressBound(numBytes);
+      if (work.size() < sizeOut)
+	work.resize(sizeOut);
+      if (compress2((Bytef *)&work[0], &sizeOut, (const Bytef *)theData, numBytes,
+		    Z_BEST_SPEED) == Z_OK && sizeOut < (uLongf)numBytes) {
+	out = &work[0];
+	length = sizeOut;
+	flags = 1;
+      }
+    }
+#endif
+
+    entry.offset = fileEnd;
+    entry.length = length;
+    entry.flags = flags;
+    entry.hash = hash;
+
+    if (this->write(out, length) < 0) {
+      opserr << "LogDatastore::send() - failed to write to file: " << fileName << endln;
+      return -1;
+    }
+    lastSent[last] = entry;
+  }
+
+  theIndex[key] = entry;
+  newEntries.push_back(std::pair<Key, Entry>(key, entry));
+
+  return 0;
+}
+
+
+int
+LogDatastore::recvData(int type, int dbTag, int commitTag, int numRows, int numCols,
+		       char *theData, int numBytes)
+{
+  Key key = {type, numRows, numCols, dbTag, commitTag};
+  std::map<Key, Entry>::iterator theIter = theIndex.find(key);
+  if (theIter == theIndex.end()) {
+    opserr << "LogDatastore::recv() - failed to find data for dbTag: " << dbTag;
+    opserr << " commitTag: " << commitTag << " size: " << numRows << " x " << numCols << endln;
+    return -1;
+  }
+
+  const Entry &entry = theIter->second;
+  if (numBytes == 0)
+    return 0;
+
+  const char *stored = this->getBytes(entry.offset, entry.length);
+  if (stored == 0) {
+    opserr << "LogDatastore::recv() - failed to read from file: " << fileName << endln;
+    return -1;
+  }
+
+  if (entry.flags & 1) {
+#ifdef _ZLIB
+    uLongf sizeOut = numBytes;
+    if (uncompress((Bytef *)theData, &sizeOut, (const Bytef *)stored, entry.length) != Z_OK
+	|| sizeOut != (uLongf)numBytes) {
+      opserr << "LogDatastore::recv() - failed to uncompress data for dbTag: " << dbTag << endln;
+      return -1;
+    }
+#else
+    opserr << "LogDatastore::recv() - data is compressed and not built with zlib\n";
+    return -1;
+#endif
+  } else {
+    if (entry.length != numBytes) {
+      opserr << "LogDatastore::recv() - wrong size of data for dbTag: " << dbTag << endln;
+      return -1;
+    }
+    memcpy(theData, stored, numBytes);
+  }
+
+  return 0;
+}
+
+
+// write():
+//      appends the data to the write buffer, the buffer is written to the
+//      file when full. Data larger than the buffer is written directly.
+int
+LogDatastore::write(const char *theData, int numBytes)
+{
+  if ((int)writeBuffer.size() + numBytes > bufferSize)
+    if (this->flush() < 0)
+      return -1;
+
+  if (numBytes > bufferSize) {
+    if (fwrite(theData, 1, numBytes, theFile) != (size_t)numBytes)
+      return -1;
+    fileEnd += numBytes;
+    flushedEnd = fileEnd;
+    return 0;
+  }
+
+  writeBuffer.insert(writeBuffer.end(), theData, theData + numBytes);
+  fileEnd += numBytes;
+
+  return 0;
+}
+
+
+int
+LogDatastore::flush(void)
+{
+  if (!writeBuffer.empty()) {
+    size_t numBytes = writeBuffer.size();
+    if (fwrite(&writeBuffer[0], 1, numBytes, theFile) != numBytes)
+      return -1;
+    writeBuffer.clear();
+  }
+
+  if (fflush(theFile) != 0)
+    return -1;
+
+  flushedEnd = fileEnd;
+  return 0;
+}
+
+
+int
+LogDatastore::writeIndex(void)
+{
+  if (newEntries.empty())
+    return 0;
+
+  int numEntries = (int)newEntries.size();
+  std::vector<char> block(headerSize + numEntries*entrySize + trailerSize);
+  long long indexOffset = fileEnd;
+
+  char *loc = &block[0];
+  pack(loc, indexMagic);
+  pack(loc, numEntries);
+  pack(loc, lastIndex);
+  for (int i = 0; i < numEntries; i++) {
+    const Key &key = newEntries[i].first;
+    const Entry &entry = newEntries[i].second;
+    pack(loc, key.type);
+    pack(loc, key.numRows);
+    pack(loc, key.numCols);
+    pack(loc, key.dbTag);
+    pack(loc, key.commitTag);
+    pack(loc, entry.flags);
+    pack(loc, entry.length);
+    pack(loc, entry.offset);
+    pack(loc, entry.hash);
+  }
+  pack(loc, indexOffset);
+  pack(loc, trailerMagic);
+
+  if (this->write(&block[0], (int)block.size()) < 0)
+    return -1;
+
+  lastIndex = indexOffset;
+  newEntries.clear();
+
+  return 0;
+}
+
+
+// readIndex():
+//      finds the last complete trailer in the file and reads the chain of
+//      indices, newest first. The newest entry for a key is kept.
+int
+LogDatastore::readIndex(void)
+{
+  long long indexOffset = -1;
+  int numEntries = 0;
+
+  for (long long pos = fileEnd - trailerSize; pos >= headerSize; pos--) {
+    const char *loc = this->getBytes(pos, trailerSize);
+    if (loc == 0)
+      return -1;
+    long long offset = unpack<long long>(loc);
+    if (unpack<int>(loc) != trailerMagic || offset < 0 || offset + headerSize > pos)
+      continue;
+
+    loc = this->getBytes(offset, headerSize);
+    if (loc == 0 || unpack<int>(loc) != indexMagic)
+      continue;
+    numEntries = unpack<int>(loc);
+    if (numEntries <= 0 || offset + headerSize + (long long)numEntries*entrySize != pos)
+      continue;
+
+    indexOffset = offset;
+    break;
+  }
+
+  if (indexOffset < 0)
+    return -1;
+
+  lastIndex = indexOffset;
+
+  while (indexOffset >= 0) {
+    const char *loc = this->getBytes(indexOffset, headerSize);
+    if (loc == 0 || unpack<int>(loc) != indexMagic) {
+      opserr << "WARNING LogDatastore::readIndex() - corrupt index in file: " << fileName << endln;
+      return -1;
+    }
+    numEntries = unpack<int>(loc);
+    long long previous = unpack<long long>(loc);
+
+    loc = this->getBytes(indexOffset + headerSize, numEntries*entrySize);
+    if (loc == 0)
+      return -1;
+
+    // entries later in an index are newer
+    for (int i = numEntries-1; i >= 0; i--) {
+      const char *entryLoc = loc + i*entrySize;
+      Key key;
+      Entry entry;
+      key.type = unpack<int>(entryLoc);
+      key.numRows = unpack<int>(entryLoc);
+      key.numCols = unpack<int>(entryLoc);
+      key.dbTag = unpack<int>(entryLoc);
+      key.commitTag = unpack<int>(entryLoc);
+      entry.flags = unpack<int>(entryLoc);
+      entry.length = unpack<int>(entryLoc);
+      entry.offset = unpack<long long>(entryLoc);
+      entry.hash = unpack<unsigned long long>(entryLoc);
+
+      if (theIndex.find(key) == theIndex.end())
+	theIndex[key] = entry;
+
+      Key last = key;
+      last.commitTag = 0;
+      if (lastSent.find(last) == lastSent.end())
+	lastSent[last] = entry;
+    }
+
+    if (previous >= indexOffset)
+      break;
+    indexOffset = previous;
+  }
+
+  return 0;
+}
+
+
+// getBytes():
+//      returns a pointer to numBytes of the file at offset. Data still in
+//      the write buffer is returned from there, the rest from a memory
+//      mapping of the file that is extended when the file has grown.
+const char *
+LogDatastore::getBytes(long long offset, int numBytes)
+{
+  if (offset < 0 || offset + numBytes > fileEnd)
+    return 0;
+
+  if (offset >= flushedEnd)
+    return &writeBuffer[0] + (offset - flushedEnd);
+
+  if (offset + numBytes > flushedEnd)
+    if (this->flush() < 0)
+      return 0;
+
+#ifndef _WIN32
+  if (offset + numBytes > mapSize) {
+    this->unmapFile();
+    if (fflush(theFile) != 0)
+      return 0;
+    void *theMap = mmap(0, flushedEnd, PROT_READ, MAP_SHARED, fileno(theFile), 0);
+    if (theMap != MAP_FAILED) {
+      mapData = (const char *)theMap;
+      mapSize = flushedEnd;
+    }
+  }
+
+  if (mapData != 0)
+    return mapData + offset;
+#endif
+
+  // no mapping, read the data into the work array
+  if (work.size() < (size_t)numBytes)
+    work.resize(numBytes);
+  bool ok = LOG_FSEEK(theFile, offset, SEEK_SET) == 0
+    && fread(&work[0], 1, numBytes, theFile) == (size_t)numBytes;
+
+  // a stream must be positioned between a read and the next write
+  if (LOG_FSEEK(theFile, 0, SEEK_CUR) != 0 || ok == false)
+    return 0;
+
+  return &work[0];
+}
+
+
+void
+LogDatastore::unmapFile(void)
+{
+#ifndef _WIN32
+  if (mapData != 0)
+    munmap((void *)mapData, mapSize);
+#endif
+  mapData = 0;
+  mapSize = 0;
+}
@@ -0,0 +1,133 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef LogDatastore_h
+#define LogDatastore_h
+
+// Description: This file contains the class definition for LogDatastore.
+// LogDatastore is a concrete subclass of FE_Datastore that keeps all the
+// data of the domain in a single binary file to which it only appends.
+// The IDs, Vectors and Matrices sent are written one after the other
+// through a write buffer; on each commitState() an index of the objects
+// sent since the last commit is appended, followed by a trailer pointing
+// to it, and each index points back to the previous one. An object whose
+// data did not change since it was last sent only adds an index entry
+// referring to the data already in the file, so a checkpoint only writes
+// the objects that changed. If the program was built with zlib (_ZLIB)
+// the data can be compressed. On opening an existing file the indices are
+// read back starting from the last complete trailer, and the data is read
+// from a memory mapping of the file.
+
+#include <FE_Datastore.h>
+#include <stdio.h>
+#include <map>
+#include <vector>
+
+class FEM_ObjectBroker;
+
+class LogDatastore: public FE_Datastore
+{
+  public:
+    LogDatastore(const char *fileName,
+		 Domain &theDomain,
+		 FEM_ObjectBroker &theBroker,
+		 bool compress = false,
+		 int bufferSize = 4*1024*1024);
+    ~LogDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag,
+		const Message &,
+		ChannelAddress *theAddress =0);
+    int recvMsg(int dbTag, int commitTag,
+		Message &,
+		ChannelAddress *theAddress =0);
+    int recvMsgUnknownSize(int dbTag, int commitTag,
+		Message &,
+		ChannelAddress *theAddress =0);
+
+    int sendMatrix(int dbTag, int commitTag,
+		   const Matrix &theMatrix,
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag,
+		   Matrix &theMatrix,
+		   ChannelAddress *theAddress =0);
+
+    int sendVector(int dbTag, int commitTag,
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag,
+		   Vector &theVector,
+		   ChannelAddress *theAddress =0);
+
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    // the commitState method
+    int commitState(int commitTag);
+
+  private:
+    struct Key {
+      int type, numRows, numCols, dbTag, commitTag;
+      bool operator<(const Key &other) const;
+    };
+    struct Entry {
+      long long offset;     // location of the data in the file
+      int length;           // number of bytes stored
+      int flags;            // 1 if compressed
+      unsigned long long hash;
+    };
+
+    int sendData(int type, int dbTag, int commitTag, int numRows, int numCols,
+		 const char *theData, int numBytes);
+    int recvData(int type, int dbTag, int commitTag, int numRows, int numCols,
+		 char *theData, int numBytes);
+
+    int write(const char *theData, int numBytes);
+    int flush(void);
+    int writeIndex(void);
+    int readIndex(void);
+    const char *getBytes(long long offset, int numBytes);
+    void unmapFile(void);
+
+    char *fileName;
+    FILE *theFile;
+    long long fileEnd;        // end of the file including the write buffer
+    long long flushedEnd;     // end of the data in the file
+    long long lastIndex;      // location of the last index, -1 if none
+
+    std::map<Key, Entry> theIndex;
+    std::map<Key, Entry> lastSent;  // last data of each object, commitTag 0
+    std::vector<std::pair<Key, Entry> > newEntries;
+
+    std::vector<char> writeBuffer;
+    int bufferSize;
+    std::vector<char> work;
+    bool compress;
+
+    const char *mapData;
+    long long mapSize;
+};
+
+#endif
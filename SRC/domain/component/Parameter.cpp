@@ -25,6 +25,7 @@
 #include <classTags.h>
 #include <Parameter.h>
 #include <DomainComponent.h>
+#include <Element.h>
 
 Parameter::Parameter(int passedTag,
 		     DomainComponent *parentObject,
@@ -185,6 +186,8 @@ Parameter::update(int newValue)
   for (int i = 0; i < numObjects; i++)
     ok += theObjects[i]->updateParameter(parameterID[i], theInfo);
 
+  this->clearMatrixCaches();
+
   return ok;
 }
 
@@ -197,10 +200,25 @@ Parameter::update(double newValue)
 
   for (int i = 0; i < numObjects; i++)
     ok += theObjects[i]->updateParameter(parameterID[i], theInfo);
-  
+
+  this->clearMatrixCaches();
+
   return ok;
 }
 
+// clearMatrixCaches():
+//      the matrices the analysis keeps for the elements the parameter
+//      belongs to, e.g. linear tangents and lumped masses, are stale.
+void
+Parameter::clearMatrixCaches(void)
+{
+  for (int i = 0; i < numComponents; i++) {
+    Element *theEle = dynamic_cast<Element *>(theComponents[i]);
+    if (theEle != 0)
+      theEle->clearMatrixCache();
+  }
+}
+
 int
 Parameter::activate(bool active)
 {
@@ -76,6 +76,8 @@ class Parameter : public TaggedObject, public MovableObject
   virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
 
  protected:
+  void clearMatrixCaches(void);
+
   int *parameterID;
 
   MovableObject **theObjects;
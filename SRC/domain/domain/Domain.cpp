@@ -37,6 +37,10 @@
 
 #include <OPS_Globals.h>
 #include <Domain.h>
+#include <Profiler.h>
+#include <MemoryReport.h>
+#include <ShapeFunctionCache.h>
+#include <ElementCostModel.h>
 #include <DummyStream.h>
 
 #include <ElementIter.h>
@@ -73,6 +77,7 @@
 
 #include <Vertex.h>
 #include <Matrix.h>
+#include <ID.h>
 #include <Graph.h>
 #include <Recorder.h>
 #include <MeshRegion.h>
@@ -92,7 +97,7 @@ bool          ops_InitialStateAnalysis = false;
 int           ops_Creep = 0;
 
 Domain::Domain()
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), recording(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -101,7 +106,10 @@ Domain::Domain()
  theRegions(0), numRegions(0), commitTag(0), initBounds(true), resetBounds(false),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
- theModalDampingFactors(0), inclModalMatrix(false),
+ theModalDampingFactors(0), inclModalMatrix(false), theCostModel(0),
+ activeElements(0), numActiveElements(0), sizeActiveElements(0),
+ activeElementsBuilt(false), activeStamp(0),
+ theLoadCases(0), currentLoadCase(0),
  lastChannel(0),
  paramIndex(0), paramSize(0), numParameters(0)
 {
@@ -148,7 +156,7 @@ Domain::Domain()
 
 Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
 	       int numLoadPatterns)
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), recording(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -157,7 +165,10 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  theRegions(0), numRegions(0), commitTag(0), initBounds(true), resetBounds(false),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
- theModalDampingFactors(0), inclModalMatrix(false),
+ theModalDampingFactors(0), inclModalMatrix(false), theCostModel(0),
+ activeElements(0), numActiveElements(0), sizeActiveElements(0),
+ activeElementsBuilt(false), activeStamp(0),
+ theLoadCases(0), currentLoadCase(0),
  lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
 {
     // init the arrays for storing the domain components
@@ -204,7 +215,7 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 	       TaggedObjectStorage &theMPsStorage,
 	       TaggedObjectStorage &theSPsStorage,
 	       TaggedObjectStorage &theLoadPatternsStorage)
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), recording(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -218,7 +229,10 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theRegions(0), numRegions(0), commitTag(0), initBounds(true), resetBounds(false),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
- theModalDampingFactors(0), inclModalMatrix(false),
+ theModalDampingFactors(0), inclModalMatrix(false), theCostModel(0),
+ activeElements(0), numActiveElements(0), sizeActiveElements(0),
+ activeElementsBuilt(false), activeStamp(0),
+ theLoadCases(0), currentLoadCase(0),
  lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
 {
     // init the arrays for storing the domain components
@@ -268,7 +282,7 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 
 
 Domain::Domain(TaggedObjectStorage &theStorage)
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), recording(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -277,7 +291,10 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  theRegions(0), numRegions(0), commitTag(0),initBounds(true), resetBounds(false),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
- theModalDampingFactors(0), inclModalMatrix(false),
+ theModalDampingFactors(0), inclModalMatrix(false), theCostModel(0),
+ activeElements(0), numActiveElements(0), sizeActiveElements(0),
+ activeElementsBuilt(false), activeStamp(0),
+ theLoadCases(0), currentLoadCase(0),
  lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
 {
     // init the arrays for storing the domain components
@@ -389,6 +406,15 @@ Domain::~Domain()
   if (theModalProperties != 0)
     delete theModalProperties;
 
+  if (theCostModel != 0)
+    delete theCostModel;
+
+  if (activeElements != 0)
+    delete [] activeElements;
+
+  if (theLoadCases != 0)
+    delete theLoadCases;
+
   if (theLoadPatternIter != 0)
       delete theLoadPatternIter;
 
@@ -983,6 +1009,7 @@ Domain::clearAll(void) {
 
   // clean out the containers
   theElements->clearAll();
+  this->clearActiveElements();
   theNodes->clearAll();
   theSPs->clearAll();
   thePCs->clearAll();
@@ -1878,6 +1905,7 @@ Domain::getCreep(void) const
 void
 Domain::applyLoad(double timeStep)
 {
+    OPS_PROFILE_SCOPE("applyLoad");
 
     // set the current pseudo time in the domai to be newTime
     currentTime = timeStep;
@@ -1902,7 +1930,9 @@ Domain::applyLoad(double timeStep)
     LoadPattern *thePattern;
     LoadPatternIter &thePatterns = this->getLoadPatterns();
     while((thePattern = thePatterns()) != 0)
-      thePattern->applyLoad(timeStep);
+      if (theLoadCases == 0 || thePattern->getTag() == currentLoadCase
+	  || theLoadCases->getLocation(thePattern->getTag()) < 0)
+	thePattern->applyLoad(timeStep);
 
     //
     // finally loop over the MP_Constraints and SP_Constraints of the domain
@@ -1989,10 +2019,11 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
 int
 Domain::record(bool fromAnalysis)
 {
+  OPS_PROFILE_SCOPE("record");
   int res = 0;
 
   // invoke record on all recorders
-  for (int i=0; i<numRecorders; i++)
+  for (int i=0; i<numRecorders && recording == true; i++)
     if (theRecorders[i] != 0)
       res += theRecorders[i]->record(commitTag, currentTime);
   
@@ -2002,9 +2033,16 @@ Domain::record(bool fromAnalysis)
   return res;
 }
 
+void
+Domain::setRecording(bool onOff)
+{
+  recording = onOff;
+}
+
 int
 Domain::commit(void)
 {
+    OPS_PROFILE_SCOPE("commit");
     // 
     // first invoke commit on all nodes and elements in the domain
     //
@@ -2014,20 +2052,23 @@ Domain::commit(void)
       nodePtr->commitState();
     }
 
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != 0) {
-      elePtr->commitState();
-    }
+    // inactive elements keep their committed state
+    int numActive;
+    Element **theActive = this->getActiveElements(numActive);
+    for (int i=0; i<numActive; i++)
+      theActive[i]->commitState();
 
     // set the new committed time in the domain
     committedTime = currentTime;
     dT = 0.0;
 
     // invoke record on all recorders
-    for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
-	theRecorders[i]->record(commitTag, currentTime);
+    {
+      OPS_PROFILE_SCOPE("record");
+      for (int i=0; i<numRecorders; i++)
+	if (theRecorders[i] != 0)
+	  theRecorders[i]->record(commitTag, currentTime);
+    }
 
     // update the commitTag
     commitTag++;
@@ -2046,11 +2087,10 @@ Domain::revertToLastCommit(void)
     while ((nodePtr = theNodeIter()) != 0)
 	nodePtr->revertToLastCommit();
     
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != 0) {
-	elePtr->revertToLastCommit();
-    }
+    int numActive;
+    Element **theActive = this->getActiveElements(numActive);
+    for (int i=0; i<numActive; i++)
+	theActive[i]->revertToLastCommit();
 
     // set the current time and load factor in the domain to last committed
     currentTime = committedTime;
@@ -2101,6 +2141,8 @@ Domain::revertToStart(void)
 int
 Domain::update(void)
 {
+  OPS_PROFILE_SCOPE("update");
+
   // set the global constants
   ops_Dt = dT;
   ops_TheActiveDomain = this;
@@ -2108,12 +2150,18 @@ Domain::update(void)
   int ok = 0;
 
   // invoke update on all the ele's
-  ElementIter &theEles = this->getElements();
-  Element *theEle;
+  if (theCostModel != 0)
+    ok = theCostModel->update(*this);
+  else {
+    int numActive;
+    Element **theActive = this->getActiveElements(numActive);
 
-  while ((theEle = theEles()) != 0) {
-    ops_TheActiveElement = theEle;
-    ok += theEle->update();
+    for (int i=0; i<numActive; i++) {
+      Element *theEle = theActive[i];
+      OPS_PROFILE_SCOPE(theEle->getClassType());
+      ops_TheActiveElement = theEle;
+      ok += theEle->update();
+    }
   }
 
   if (ok != 0)
@@ -2304,6 +2352,147 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+
+    // elements may have been added or removed
+    this->clearActiveElements();
+}
+
+
+void
+Domain::setElementCostModel(ElementCostModel *theModel)
+{
+    if (theCostModel != 0)
+      delete theCostModel;
+    theCostModel = theModel;
+}
+
+
+ElementCostModel *
+Domain::getElementCostModel(void)
+{
+    return theCostModel;
+}
+
+
+void
+Domain::reportMemory(MemoryReport &theReport)
+{
+    Node *nodePtr;
+    NodeIter &theNodeIter = this->getNodes();
+    while ((nodePtr = theNodeIter()) != 0)
+      nodePtr->reportMemory(theReport);
+
+    Element *elePtr;
+    ElementIter &theEleIter = this->getElements();
+    while ((elePtr = theEleIter()) != 0)
+      elePtr->reportMemory(theReport);
+
+    // the shape functions shared by the continuum elements
+    ShapeFunctionCache::reportMemory(theReport);
+
+    SP_Constraint *spPtr;
+    SP_ConstraintIter &theSPs = this->getSPs();
+    while ((spPtr = theSPs()) != 0)
+      theReport.add("constraint", spPtr->getClassType(), sizeof(SP_Constraint));
+
+    MP_Constraint *mpPtr;
+    MP_ConstraintIter &theMPs = this->getMPs();
+    while ((mpPtr = theMPs()) != 0) {
+      const Matrix &C = mpPtr->getConstraint();
+      double bytes = sizeof(MP_Constraint) + sizeof(Matrix) + C.noRows()*C.noCols()*sizeof(double)
+        + MemoryReport::getBytes(mpPtr->getConstrainedDOFs())
+        + MemoryReport::getBytes(mpPtr->getRetainedDOFs());
+      theReport.add("constraint", mpPtr->getClassType(), bytes);
+    }
+
+    theReport.add("domain", "Domain", sizeof(Domain) + MemoryReport::getBytes(theEigenvalues)
+                  + sizeActiveElements*sizeof(Element *));
+    if (eleGraphBuiltFlag == true && theElementGraph != 0)
+      theElementGraph->reportMemory(theReport, "domain");
+    if (nodeGraphBuiltFlag == true && theNodeGraph != 0)
+      theNodeGraph->reportMemory(theReport, "domain");
+}
+
+
+Element **
+Domain::getActiveElements(int &numActive)
+{
+    if (activeElementsBuilt == false) {
+      int numEle = this->getNumElements();
+      if (numEle > sizeActiveElements) {
+	if (activeElements != 0)
+	  delete [] activeElements;
+	activeElements = new Element *[numEle];
+	sizeActiveElements = numEle;
+      }
+
+      numActiveElements = 0;
+      Element *elePtr;
+      ElementIter &theEles = this->getElements();
+      while ((elePtr = theEles()) != 0) {
+	if (elePtr->isActive() == false)
+	  continue;
+	if (numActiveElements == sizeActiveElements) {
+	  sizeActiveElements = 2*sizeActiveElements + 16;
+	  Element **newArray = new Element *[sizeActiveElements];
+	  for (int i=0; i<numActiveElements; i++)
+	    newArray[i] = activeElements[i];
+	  if (activeElements != 0)
+	    delete [] activeElements;
+	  activeElements = newArray;
+	}
+	activeElements[numActiveElements++] = elePtr;
+      }
+
+      activeElementsBuilt = true;
+    }
+
+    numActive = numActiveElements;
+    return activeElements;
+}
+
+
+int
+Domain::getActiveStamp(void) const
+{
+    return activeStamp;
+}
+
+
+void
+Domain::setLoadCases(const ID &patternTags)
+{
+    if (theLoadCases != 0)
+      delete theLoadCases;
+    theLoadCases = new ID(patternTags);
+    currentLoadCase = (patternTags.Size() > 0) ? patternTags(0) : 0;
+}
+
+
+void
+Domain::setCurrentLoadCase(int patternTag)
+{
+    currentLoadCase = patternTag;
+}
+
+
+void
+Domain::clearLoadCases(void)
+{
+    if (theLoadCases != 0)
+      delete theLoadCases;
+    theLoadCases = 0;
+}
+
+
+void
+Domain::clearActiveElements(void)
+{
+    activeElementsBuilt = false;
+    activeStamp++;
+
+    if (theCostModel != 0)
+      theCostModel->reset();
 }
 
 
@@ -3683,7 +3872,6 @@ Domain::getRecorder(int tag)
 
 int Domain::activateElements(const ID& elementList)
 {
-    ElementIter& iter = getElements();
     Element* theElement;
     for (int i = 0; i < elementList.Size(); ++i)
     {
@@ -3694,6 +3882,9 @@ int Domain::activateElements(const ID& elementList)
             theElement->activate();
         }
     }
+
+    // the equations are kept, only the element loops change
+    this->clearActiveElements();
     return 0;
 }
 
@@ -3712,5 +3903,7 @@ int Domain::deactivateElements(const ID& elementList)
             theElement->deactivate();
         }
     }
+
+    this->clearActiveElements();
     return 0;
 }
@@ -76,6 +76,9 @@ class FEM_ObjectBroker;
 class TaggedObjectStorage;
 
 class DomainModalProperties;
+class ElementCostModel;
+class MemoryReport;
+class ID;
 
 class Domain
 {
@@ -220,6 +223,7 @@ class Domain
     virtual int  removeRecorder(int tag);
     virtual int  record(bool fromAnalysis=true);
     virtual int flushRecorders();
+    void setRecording(bool onOff);   // record() does nothing while off
 
     virtual int  addRegion(MeshRegion &theRegion);    	
     virtual MeshRegion *getRegion(int region);    	
@@ -241,9 +245,28 @@ class Domain
     virtual int calculateNodalReactions(int flag);
 	Recorder* getRecorder(int tag);	//by SAJalali
 
+    // method to have the element state determination done on threads
+    void setElementCostModel(ElementCostModel *theModel);
+    ElementCostModel *getElementCostModel(void);
+
+    // method to add the bytes held by the nodes, elements and
+    // constraints to a memory report
+    virtual void reportMemory(MemoryReport &theReport);
+
     virtual int activateElements(const ID& elementList);
     virtual int deactivateElements(const ID& elementList);
 
+    // methods to obtain the compact list of active elements used in the
+    // element loops; the stamp changes whenever the active set changes
+    Element **getActiveElements(int &numActive);
+    int getActiveStamp(void) const;
+
+    // methods to apply only one of a set of load patterns, the load
+    // cases, in applyLoad(); the patterns not in the set are applied
+    void setLoadCases(const ID &patternTags);
+    void setCurrentLoadCase(int patternTag);
+    void clearLoadCases(void);
+
   protected:    
 
     virtual int buildEleGraph(Graph *theEleGraph);
@@ -251,6 +274,7 @@ class Domain
 
     Recorder **theRecorders;
     int numRecorders;    
+    bool recording;
 
   private:
     double currentTime;               // current pseudo time
@@ -299,6 +323,17 @@ class Domain
     DomainModalProperties* theModalProperties;
     Vector *theModalDampingFactors;
     bool inclModalMatrix;
+    ElementCostModel *theCostModel;
+
+    void clearActiveElements(void);
+    Element **activeElements;         // elements that are active, in domain order
+    int numActiveElements;
+    int sizeActiveElements;
+    bool activeElementsBuilt;
+    int activeStamp;
+
+    ID *theLoadCases;                 // pattern tags of the load cases, 0 if none
+    int currentLoadCase;
 
     int lastChannel;
 
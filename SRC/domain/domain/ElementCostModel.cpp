@@ -0,0 +1,258 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of
+// ElementCostModel.
+
+#include <ElementCostModel.h>
+#include <Domain.h>
+#include <Element.h>
+#include <Profiler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <stdio.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+typedef std::chrono::steady_clock CostClock;
+
+extern Element *ops_TheActiveElement;
+
+static double
+elapsed(const CostClock::time_point &start)
+{
+  return std::chrono::duration<double>(CostClock::now() - start).count();
+}
+
+
+ElementCostModel::ElementCostModel(int nThreads, int nSamples, double factor)
+  :numThreads(nThreads), numSamples(nSamples), factorGreater(factor),
+   gathered(false), numSampled(0), numPartitions(0)
+{
+  if (numThreads < 1)
+    numThreads = 1;
+  if (numSamples < 1)
+    numSamples = 1;
+  if (factorGreater < 1.0)
+    factorGreater = 1.0;
+}
+
+
+ElementCostModel::~ElementCostModel()
+{
+
+}
+
+
+void
+ElementCostModel::reset(void)
+{
+  gathered = false;
+}
+
+
+int
+ElementCostModel::update(Domain &theDomain)
+{
+  if (gathered == false)
+    if (this->gatherElements(theDomain) < 0)
+      return -1;
+
+  // time the elements serially until the costs are known
+  if (numThreads == 1 || numSampled < numSamples) {
+    int ok = this->updateSerial();
+    numSampled++;
+    if (numThreads > 1 && numSampled == numSamples)
+      this->partition();
+    return ok;
+  }
+
+  int ok = this->updateParallel();
+
+  // split again if the parts have drifted apart
+  double maxLoad = 0.0;
+  double sumLoad = 0.0;
+  for (int t = 0; t < numThreads; t++) {
+    sumLoad += partLoad[t];
+    if (partLoad[t] > maxLoad)
+      maxLoad = partLoad[t];
+  }
+  if (maxLoad > factorGreater*sumLoad/numThreads)
+    this->partition();
+
+  return ok;
+}
+
+
+int
+ElementCostModel::gatherElements(Domain &theDomain)
+{
+  theElements.clear();
+
+  // only the active elements are updated
+  int numActive;
+  Element **theActive = theDomain.getActiveElements(numActive);
+  theElements.assign(theActive, theActive + numActive);
+
+  cost.assign(theElements.size(), 0.0);
+  parts.clear();
+  serial.clear();
+  partLoad.assign(numThreads, 0.0);
+
+  gathered = true;
+  numSampled = 0;
+  return 0;
+}
+
+
+int
+ElementCostModel::updateSerial(void)
+{
+  int ok = 0;
+  int numEle = (int)theElements.size();
+
+  for (int i = 0; i < numEle; i++) {
+    Element *theEle = theElements[i];
+    OPS_PROFILE_SCOPE(theEle->getClassType());
+    ops_TheActiveElement = theEle;
+
+    CostClock::time_point start = CostClock::now();
+    ok += theEle->update();
+
+    // running average over the samples
+    cost[i] = (cost[i]*numSampled + elapsed(start))/(numSampled + 1);
+  }
+
+  return ok;
+}
+
+
+int
+ElementCostModel::updateParallel(void)
+{
+  int ok = 0;
+
+  for (size_t j = 0; j < serial.size(); j++) {
+    int i = serial[j];
+    ops_TheActiveElement = theElements[i];
+    CostClock::time_point start = CostClock::now();
+    ok += theElements[i]->update();
+    cost[i] = 0.5*(cost[i] + elapsed(start));
+  }
+  ops_TheActiveElement = 0;
+
+  // one part per iteration, so every part is done even on a smaller team;
+  // without OpenMP the parts run in turn and are still timed
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static,1) num_threads(numThreads) reduction(+:ok)
+#endif
+  for (int t = 0; t < numThreads; t++) {
+    const std::vector<int> &myPart = parts[t];
+    int numEle = (int)myPart.size();
+    CostClock::time_point partStart = CostClock::now();
+
+    for (int j = 0; j < numEle; j++) {
+      int i = myPart[j];
+      CostClock::time_point start = CostClock::now();
+      ok += theElements[i]->update();
+      cost[i] = 0.5*(cost[i] + elapsed(start));
+    }
+
+    partLoad[t] = elapsed(partStart);
+  }
+
+  return ok;
+}
+
+
+void
+ElementCostModel::partition(void)
+{
+  int numEle = (int)theElements.size();
+
+  // heaviest reentrant element first, each to the currently lightest part
+  std::vector<int> order;
+  serial.clear();
+  for (int i = 0; i < numEle; i++)
+    if (theElements[i]->isReentrant())
+      order.push_back(i);
+    else
+      serial.push_back(i);
+  std::stable_sort(order.begin(), order.end(),
+		   [this](int a, int b) {return cost[a] > cost[b];});
+
+  parts.assign(numThreads, std::vector<int>());
+  std::vector<double> load(numThreads, 0.0);
+  for (size_t k = 0; k < order.size(); k++) {
+    int i = order[k];
+    int lightest = (int)(std::min_element(load.begin(), load.end()) - load.begin());
+    parts[lightest].push_back(i);
+    load[lightest] += cost[i];
+  }
+
+  // keep the elements of a part in domain order
+  for (int t = 0; t < numThreads; t++)
+    std::sort(parts[t].begin(), parts[t].end());
+
+  partLoad = load;
+  numPartitions++;
+}
+
+
+void
+ElementCostModel::Print(OPS_Stream &s, int flag)
+{
+  s << "ElementCostModel - threads: " << numThreads
+    << "  elements: " << (int)theElements.size()
+    << "  splits: " << numPartitions << endln;
+
+  // cost per element class
+  std::map<std::string, std::pair<int, double> > classCost;
+  for (size_t i = 0; i < theElements.size(); i++) {
+    std::pair<int, double> &entry = classCost[theElements[i]->getClassType()];
+    entry.first++;
+    entry.second += cost[i];
+  }
+
+  char line[256];
+  snprintf(line, 256, "  %-30s %10s %14s %14s\n", "class", "elements", "total (s)", "mean (s)");
+  s << line;
+  std::map<std::string, std::pair<int, double> >::iterator it;
+  for (it = classCost.begin(); it != classCost.end(); it++) {
+    snprintf(line, 256, "  %-30s %10d %14.6e %14.6e\n", it->first.c_str(),
+	     it->second.first, it->second.second, it->second.second/it->second.first);
+    s << line;
+  }
+
+  if (parts.empty() == false) {
+    snprintf(line, 256, "  serial      %10d elements\n", (int)serial.size());
+    s << line;
+    for (int t = 0; t < numThreads; t++) {
+      snprintf(line, 256, "  thread %4d %10d elements %14.6e s\n", t,
+	       (int)parts[t].size(), partLoad[t]);
+      s << line;
+    }
+  }
+}
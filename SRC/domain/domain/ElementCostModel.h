@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ElementCostModel_h
+#define ElementCostModel_h
+
+// Description: This file contains the class definition for
+// ElementCostModel. An ElementCostModel performs the element state
+// determination of a Domain (the loop over Element::update() in
+// Domain::update()) on a number of threads. The time each element
+// takes to update is measured over the first few calls, which are done
+// serially, and the elements are then split into one part per thread
+// so that the parts carry about the same measured cost (heaviest
+// element to lightest part). The times keep being measured while the
+// parts are updated in parallel; when the heaviest part becomes
+// slower than factorGreater times the average, the elements are split
+// again, in the spirit of the ShedHeaviest load balancer.
+//
+// Only the elements whose isReentrant() is true, i.e. whose update()
+// modifies nothing but the state of the element itself (and of its own
+// materials, sections and transformations), are updated concurrently;
+// the others, which write class wide work areas, are updated serially
+// before the parallel parts. ops_TheActiveElement is not set for the
+// elements updated in parallel.
+//
+// At present only ElasticBeam2d and ElasticBeam3d with a linear
+// transformation are reentrant. The force based beams and continuum
+// elements such as SSPbrickUP go through the work area shared by all
+// Matrix objects (Solve/Invert) and static section and material data, so
+// they are updated serially. The tangent and residual assembly in
+// IncrementalIntegrator is not threaded either.
+
+#include <OPS_Globals.h>
+#include <vector>
+
+class Domain;
+class Element;
+
+class ElementCostModel
+{
+  public:
+    ElementCostModel(int numThreads, int numSamples = 2, double factorGreater = 1.2);
+    ~ElementCostModel();
+
+    int update(Domain &theDomain);
+    void reset(void);
+
+    int getNumThreads(void) const {return numThreads;};
+    void Print(OPS_Stream &s, int flag = 0);
+
+  private:
+    int gatherElements(Domain &theDomain);
+    int updateSerial(void);
+    int updateParallel(void);
+    void partition(void);
+
+    int numThreads;          // number of threads used for the update
+    int numSamples;          // number of serial updates timed before splitting
+    double factorGreater;    // imbalance that triggers a new split
+
+    bool gathered;           // elements gathered since the domain changed
+    int numSampled;          // number of serial updates timed so far
+    int numPartitions;       // number of times the elements were split
+
+    std::vector<Element *> theElements;
+    std::vector<double> cost;            // time of the last update of each element
+    std::vector<std::vector<int> > parts;
+    std::vector<int> serial;             // elements that are not reentrant
+    std::vector<double> partLoad;        // time of the last update of each part
+};
+
+#endif
@@ -0,0 +1,236 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of
+// ResponseHandle.
+
+#include <ResponseHandle.h>
+#include <Domain.h>
+#include <Element.h>
+#include <Node.h>
+#include <Response.h>
+#include <Information.h>
+#include <DummyStream.h>
+#include <string.h>
+
+
+ResponseHandle::ResponseHandle(Domain &domain, const ID &eleTags,
+			       const char **argv, int argc)
+  :theDomain(&domain), theTags(eleTags), nodal(false), nodeType(Disp),
+   theResponses(0), theNodes(0), numMissing(0), stamp(-1),
+   numColumns(0), data(0)
+{
+  for (int i = 0; i < argc; i++)
+    args.push_back(argv[i]);
+}
+
+
+ResponseHandle::ResponseHandle(Domain &domain, const ID &nodeTags,
+			       NodeResponseType type)
+  :theDomain(&domain), theTags(nodeTags), nodal(true), nodeType(type),
+   theResponses(0), theNodes(0), numMissing(0), stamp(-1),
+   numColumns(0), data(0)
+{
+
+}
+
+
+ResponseHandle::~ResponseHandle()
+{
+  this->clearResponses();
+}
+
+
+void
+ResponseHandle::clearResponses(void)
+{
+  int numTags = theTags.Size();
+
+  if (theResponses != 0) {
+    for (int i = 0; i < numTags; i++)
+      if (theResponses[i] != 0)
+	delete theResponses[i];
+    delete [] theResponses;
+    theResponses = 0;
+  }
+
+  if (theNodes != 0) {
+    delete [] theNodes;
+    theNodes = 0;
+  }
+}
+
+
+int
+ResponseHandle::setUp(void)
+{
+  this->clearResponses();
+
+  int numTags = theTags.Size();
+  numMissing = 0;
+
+  if (nodal == true) {
+    theNodes = new Node *[numTags];
+    for (int i = 0; i < numTags; i++) {
+      theNodes[i] = theDomain->getNode(theTags(i));
+      if (theNodes[i] == 0)
+	numMissing++;
+    }
+
+  } else {
+    std::vector<const char *> argv(args.size());
+    for (size_t j = 0; j < args.size(); j++)
+      argv[j] = args[j].c_str();
+    const char **theArgv = argv.empty() ? 0 : &argv[0];
+
+    DummyStream dummy;
+    theResponses = new Response *[numTags];
+    for (int i = 0; i < numTags; i++) {
+      theResponses[i] = 0;
+      Element *theEle = theDomain->getElement(theTags(i));
+      if (theEle != 0)
+	theResponses[i] = theEle->setResponse(theArgv, (int)args.size(), dummy);
+      if (theResponses[i] == 0)
+	numMissing++;
+    }
+  }
+
+  stamp = theDomain->getActiveStamp();
+
+  if (numMissing != 0) {
+    opserr << "WARNING ResponseHandle::setUp() - " << numMissing;
+    opserr << " of the " << numTags << (nodal ? " nodes" : " elements");
+    opserr << " do not exist or have no such response\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+// evaluate():
+//      gathers the current values of the responses into the data array.
+//      The rows of tags without the response are zero and -1 is returned.
+int
+ResponseHandle::evaluate(void)
+{
+  int result = 0;
+  if (stamp != theDomain->getActiveStamp())
+    result = this->setUp();
+  else if (numMissing != 0)
+    result = -1;
+
+  int numTags = theTags.Size();
+
+  // the number of columns is the size of the largest response
+  int width = 0;
+  for (int i = 0; i < numTags; i++) {
+    int size = 0;
+    if (nodal == true) {
+      if (theNodes[i] != 0) {
+	const Vector *theVector = theNodes[i]->getResponse(nodeType);
+	if (theVector != 0)
+	  size = theVector->Size();
+      }
+    } else if (theResponses[i] != 0) {
+      if (theResponses[i]->getResponse() < 0)
+	result = -1;
+      size = theResponses[i]->getInformation().getData().Size();
+    }
+    if (size > width)
+      width = size;
+  }
+
+  if (data.Size() != numTags*width)
+    data.resize(numTags*width);
+  data.Zero();
+  numColumns = width;
+
+  for (int i = 0; i < numTags; i++) {
+    const Vector *theVector = 0;
+    if (nodal == true) {
+      if (theNodes[i] != 0)
+	theVector = theNodes[i]->getResponse(nodeType);
+    } else if (theResponses[i] != 0)
+      theVector = &(theResponses[i]->getInformation().getData());
+
+    if (theVector != 0) {
+      int size = theVector->Size();
+      for (int j = 0; j < size; j++)
+	data(i*width + j) = (*theVector)(j);
+    }
+  }
+
+  return result;
+}
+
+
+const Vector &
+ResponseHandle::getData(void) const
+{
+  return data;
+}
+
+
+int
+ResponseHandle::getNumRows(void) const
+{
+  return theTags.Size();
+}
+
+
+int
+ResponseHandle::getNumColumns(void) const
+{
+  return numColumns;
+}
+
+
+const ID &
+ResponseHandle::getTags(void) const
+{
+  return theTags;
+}
+
+
+int
+ResponseHandle::getNodeResponseType(const char *type, NodeResponseType &result)
+{
+  if (strcmp(type, "disp") == 0 || strcmp(type, "displ") == 0)
+    result = Disp;
+  else if (strcmp(type, "vel") == 0 || strcmp(type, "veloc") == 0)
+    result = Vel;
+  else if (strcmp(type, "accel") == 0)
+    result = Accel;
+  else if (strcmp(type, "incrDisp") == 0 || strcmp(type, "incrDispl") == 0)
+    result = IncrDisp;
+  else if (strcmp(type, "incrDeltaDisp") == 0)
+    result = IncrDeltaDisp;
+  else if (strcmp(type, "reaction") == 0 || strcmp(type, "react") == 0)
+    result = Reaction;
+  else if (strcmp(type, "unbalance") == 0 || strcmp(type, "unbalancedLoad") == 0)
+    result = Unbalance;
+  else if (strcmp(type, "rayleighForces") == 0)
+    result = RayleighForces;
+  else
+    return -1;
+
+  return 0;
+}
@@ -0,0 +1,83 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ResponseHandle_h
+#define ResponseHandle_h
+
+// Description: This file contains the class definition for
+// ResponseHandle. A ResponseHandle is used to obtain the same response
+// of a group of elements, or of their sections and fibers through the
+// element arguments, or of a group of nodes many times. Unlike
+// Domain::getElementResponse(), which parses the arguments and creates
+// a Response object on every query, the Response objects are set up
+// once when the handle is created and evaluate() only asks them for
+// the current values. The values of all the tags are gathered into one
+// contiguous row major array, a row for each tag padded with zeros to
+// the largest response. The responses are set up again whenever the
+// elements of the domain change.
+
+#include <OPS_Globals.h>
+#include <ID.h>
+#include <Vector.h>
+#include <string>
+#include <vector>
+
+class Domain;
+class Node;
+class Response;
+
+class ResponseHandle
+{
+  public:
+    // element, section and fiber responses
+    ResponseHandle(Domain &theDomain, const ID &eleTags, const char **argv, int argc);
+    // nodal responses
+    ResponseHandle(Domain &theDomain, const ID &nodeTags, NodeResponseType type);
+    ~ResponseHandle();
+
+    int evaluate(void);
+
+    const Vector &getData(void) const;
+    int getNumRows(void) const;
+    int getNumColumns(void) const;
+    const ID &getTags(void) const;
+
+    static int getNodeResponseType(const char *type, NodeResponseType &result);
+
+  private:
+    int setUp(void);
+    void clearResponses(void);
+
+    Domain *theDomain;
+    ID theTags;
+    bool nodal;
+    NodeResponseType nodeType;
+    std::vector<std::string> args;   // the element arguments
+
+    Response **theResponses;  // one for each element tag, 0 if none
+    Node **theNodes;          // one for each node tag, 0 if none
+    int numMissing;           // tags without the response
+    int stamp;                // Domain::getActiveStamp() at setUp
+
+    int numColumns;
+    Vector data;              // numRows x numColumns, row major
+};
+
+#endif
@@ -85,7 +85,8 @@ GroundMotion::GroundMotion(TimeSeries *dispSeries,
 :MovableObject(GROUND_MOTION_TAG_GroundMotion), 
  theAccelSeries(accelSeries), theVelSeries(velSeries), 
  theDispSeries(dispSeries), theIntegrator(theIntegratr),
- data(3), delta(dTintegration), fact(factor)
+ data(3), delta(dTintegration), fact(factor),
+ lastTime(-1.0), useCache(true)
 {
 
   if (theAccelSeries != 0 && theVelSeries == 0 ) 
@@ -100,7 +101,8 @@ GroundMotion::GroundMotion(TimeSeries *dispSeries,
 GroundMotion::GroundMotion(int theClassTag)
 :MovableObject(theClassTag), 
  theAccelSeries(0), theVelSeries(0), theDispSeries(0), theIntegrator(0),
- data(3), delta(0.0), fact(1.0)
+ data(3), delta(0.0), fact(1.0),
+ lastTime(-1.0), useCache(true)
 {
 
 }
@@ -319,6 +321,12 @@ GroundMotion::getDispVelAccel(double time)
     return data;
   }
 
+  // the same motion is typically imposed at many supports and dofs,
+  // so the response is only evaluated once for each time; any other
+  // time, e.g. after a reset, is evaluated again
+  if (time == lastTime && this->canCacheResponse() == true)
+    return data;
+
   if (theAccelSeries != 0 && theVelSeries != 0 && theDispSeries != 0) {
     data(0) = fact*(theDispSeries->getFactor(time));
     data(1) = fact*(theVelSeries->getFactor(time));
@@ -329,10 +337,18 @@ GroundMotion::getDispVelAccel(double time)
     data(0) = this->getDisp(time);
   }
 
+  lastTime = time;
   return data;
 }
 
 
+bool
+GroundMotion::canCacheResponse(void)
+{
+  return useCache;
+}
+
+
 int 
 GroundMotion::sendSelf(int commitTag, Channel &theChannel)
 {
@@ -537,6 +553,10 @@ GroundMotion::recvSelf(int commitTag, Channel &theChannel,
 int
 GroundMotion::setParameter(const char **argv, int argc, Parameter &param)
 {
+  // parameter updates go directly to the series, so the cached
+  // response can no longer be trusted
+  useCache = false;
+  lastTime = -1.0;
   return theAccelSeries->setParameter(argv, argc, param);
 }
 
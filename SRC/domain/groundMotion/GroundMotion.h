@@ -75,6 +75,10 @@ class GroundMotion : public MovableObject
 		 FEM_ObjectBroker &theBroker);    
     
     const TimeSeries *getAccelSeries(void) const {return theAccelSeries;}
+
+    // true while the response for a time can be reused, i.e. until the
+    // motion is parameterized
+    virtual bool canCacheResponse(void);
 	
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     virtual double getAccelSensitivity(double time);
@@ -94,6 +98,9 @@ class GroundMotion : public MovableObject
     Vector data;
     double delta;
     double fact;
+
+    double lastTime;     // time of the response held in data
+    bool useCache;       // false once the motion is parameterized
 };
 
 #endif
@@ -44,7 +44,7 @@
 InterpolatedGroundMotion::InterpolatedGroundMotion()
 :GroundMotion(GROUND_MOTION_TAG_InterpolatedGroundMotion),
  theMotions(0), factors(0),
- destroyMotions(0), data(3), deltaPeak(0.0)
+ destroyMotions(0), data(3), deltaPeak(0.0), lastTime(-1.0)
 {
     
 }
@@ -55,7 +55,7 @@ InterpolatedGroundMotion::InterpolatedGroundMotion(GroundMotion **groundMotions,
 						   double dT)
 :GroundMotion(GROUND_MOTION_TAG_InterpolatedGroundMotion),
  theMotions(0), factors(0),
- destroyMotions(0), data(3), deltaPeak(dT)
+ destroyMotions(0), data(3), deltaPeak(dT), lastTime(-1.0)
 {
   factors = new Vector(fact);
   theMotions = new GroundMotion *[fact.Size()];
@@ -196,6 +196,11 @@ InterpolatedGroundMotion::getDispVelAccel(double time)
     return data;
   }
 
+  // reuse the response only for the same time, and only while none of
+  // the motions has been parameterized
+  if (time == lastTime && this->canCacheResponse() == true)
+    return data;
+
   data.Zero();
   static Vector motionData(3);
 
@@ -205,11 +210,44 @@ InterpolatedGroundMotion::getDispVelAccel(double time)
       motionData *= (*factors)(i);
       data += motionData;
   }
-  
+
+  lastTime = time;
   return data;
 }
 
 
+bool
+InterpolatedGroundMotion::canCacheResponse(void)
+{
+  if (this->GroundMotion::canCacheResponse() == false)
+    return false;
+
+  int numMotions = (factors != 0) ? factors->Size() : 0;
+  for (int i=0; i<numMotions; i++)
+    if (theMotions[i]->canCacheResponse() == false)
+      return false;
+
+  return true;
+}
+
+
+int
+InterpolatedGroundMotion::setParameter(const char **argv, int argc, Parameter &param)
+{
+  // there is no series of its own, the parameter goes to every motion
+  lastTime = -1.0;
+  int result = -1;
+  int numMotions = (factors != 0) ? factors->Size() : 0;
+  for (int i=0; i<numMotions; i++) {
+    int ok = theMotions[i]->setParameter(argv, argc, param);
+    if (ok >= 0)
+      result = ok;
+  }
+
+  return result;
+}
+
+
 int 
 InterpolatedGroundMotion::sendSelf(int commitTag, Channel &theChannel)
 {
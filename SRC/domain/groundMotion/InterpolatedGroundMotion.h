@@ -62,6 +62,9 @@ class InterpolatedGroundMotion : public GroundMotion
     virtual double getVel(double time);    
     virtual double getDisp(double time);        
     virtual const  Vector &getDispVelAccel(double time);
+
+    virtual bool canCacheResponse(void);
+    virtual int setParameter(const char **argv, int argc, Parameter &param);
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -76,6 +79,7 @@ class InterpolatedGroundMotion : public GroundMotion
     
     Vector data;
     double deltaPeak;  // increment for determining a peak response
+    double lastTime;   // time of the response held in data
 };
 
 #endif
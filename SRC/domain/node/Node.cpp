@@ -44,6 +44,7 @@
 #include <string.h>
 #include <Information.h>
 #include <Parameter.h>
+#include <MemoryReport.h>
 
 // AddingSensitivity:BEGIN //////////////////////////
 #include <Domain.h>
@@ -61,6 +62,7 @@
 
 Matrix **Node::theMatrices = 0;
 int Node::numMatrices = 0;
+int Node::crdsStamp = 0;
 
 int OPS_Node()
 {
@@ -1411,6 +1413,17 @@ Node::getEigenvectors(void)
 }
 
 
+int
+Node::getNumEigenvectors(void) const
+{
+  // number of eigenvectors stored, 0 if none have been set
+  if (theEigenvectors == 0)
+    return 0;
+
+  return theEigenvectors->noCols();
+}
+
+
 int 
 Node::sendSelf(int cTag, Channel &theChannel)
 {
@@ -1692,6 +1705,26 @@ Node::recvSelf(int cTag, Channel &theChannel,
 }
 
 
+void
+Node::reportMemory(MemoryReport &theReport)
+{
+  // the response Vectors wrap the disp, vel and accel arrays
+  double bytes = sizeof(Node) + MemoryReport::getBytes(Crd);
+  if (disp != 0)
+    bytes += 4*numberDOF*sizeof(double) + 4*sizeof(Vector);
+  if (vel != 0)
+    bytes += 2*numberDOF*sizeof(double) + 2*sizeof(Vector);
+  if (accel != 0)
+    bytes += 2*numberDOF*sizeof(double) + 2*sizeof(Vector);
+
+  bytes += MemoryReport::getBytes(unbalLoad) + MemoryReport::getBytes(unbalLoadWithInertia)
+    + MemoryReport::getBytes(reaction) + MemoryReport::getBytes(displayLocation)
+    + MemoryReport::getBytes(R) + MemoryReport::getBytes(mass)
+    + MemoryReport::getBytes(theEigenvectors) + MemoryReport::getBytes(dispSensitivity)
+    + MemoryReport::getBytes(velSensitivity) + MemoryReport::getBytes(accSensitivity);
+
+  theReport.add("node", "Node", bytes);
+}
 
 void
 Node::Print(OPS_Stream &s, int flag)
@@ -1980,6 +2013,7 @@ Node::updateParameter(int pparameterID, Information &info)
 
       // Set the new coordinate value
       (*Crd)(pparameterID-4) = info.theDouble;
+      crdsStamp++;
       
       // Need to "setDomain" to make the change take effect. 
       Domain *theDomain = this->getDomain();
@@ -2198,6 +2232,7 @@ Node::setCrds(double Crd1)
 {
   if (Crd != 0 && Crd->Size() >= 1)
     (*Crd)(0) = Crd1;
+  crdsStamp++;
 
   // Need to "setDomain" to make the change take effect. 
   Domain *theDomain = this->getDomain();
@@ -2214,6 +2249,7 @@ Node::setCrds(double Crd1, double Crd2)
   if (Crd != 0 && Crd->Size() >= 2) {
     (*Crd)(0) = Crd1;
     (*Crd)(1) = Crd2;
+    crdsStamp++;
 
     // Need to "setDomain" to make the change take effect. 
     Domain *theDomain = this->getDomain();
@@ -2232,6 +2268,7 @@ Node::setCrds(double Crd1, double Crd2, double Crd3)
     (*Crd)(0) = Crd1;
     (*Crd)(1) = Crd2;
     (*Crd)(2) = Crd3;
+    crdsStamp++;
 
     // Need to "setDomain" to make the change take effect. 
     Domain *theDomain = this->getDomain();
@@ -2248,6 +2285,7 @@ Node::setCrds(const Vector &newCrds)
 {
   if (Crd != 0 && Crd->Size() == newCrds.Size()) {
     (*Crd) = newCrds;
+    crdsStamp++;
 
 	return;
 
@@ -49,6 +49,7 @@ class Renderer;
 
 class DOF_Group;
 class NodalThermalAction; //L.Jiang [ SIF ]
+class MemoryReport;
 
 class Node : public DomainComponent
 {
@@ -123,6 +124,7 @@ class Node : public DomainComponent
     virtual int setNumEigenvectors(int numVectorsToStore);
     virtual int setEigenvector(int mode, const Vector &eigenVector);
     virtual const Matrix &getEigenvectors(void);
+    int getNumEigenvectors(void) const;
     
     // public methods for output
     virtual int sendSelf(int commitTag, Channel &theChannel);
@@ -130,6 +132,7 @@ class Node : public DomainComponent
 			 FEM_ObjectBroker &theBroker);
     virtual void Print(OPS_Stream &s, int flag = 0);
     virtual int displaySelf(Renderer &theRenderer, int theEleMode, int theNodeMode, float fact);
+    virtual void reportMemory(MemoryReport &theReport);
 
     // AddingSensitivity:BEGIN /////////////////////////////////////////
     int addInertiaLoadSensitivityToUnbalance(const Vector &accel, 
@@ -165,6 +168,8 @@ class Node : public DomainComponent
     virtual void setCrds(double Crd1, double Crd2);
     virtual void setCrds(double Crd1, double Crd2, double Crd3);
     virtual void setCrds(const Vector &);
+    // incremented whenever the coordinates of any node change
+    static int getCrdsStamp(void) {return crdsStamp;};
 
     void setTemp(double t) { temperature = t; }
     double getTemp() const { return temperature; }
@@ -214,6 +219,7 @@ class Node : public DomainComponent
     static int numMatrices;
     static Matrix **theVectors;
     static int numVectors;
+    static int crdsStamp;
     int index;
 
     Vector *reaction;
@@ -39,6 +39,7 @@
 #include <Vector.h>
 #include <Channel.h>
 #include <math.h>
+#include <algorithm>
 
 #include <fstream>
 using std::ifstream;
@@ -49,7 +50,7 @@ using std::ios;
 PathTimeSeries::PathTimeSeries()	
   :TimeSeries(TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(0.0),
-   dbTag1(0), dbTag2(0), useLast(false)
+   dbTag1(0), dbTag2(0), useLast(false), timeIncr(0.0)
 {
   // does nothing
 }
@@ -61,7 +62,7 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       bool last)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
-   dbTag1(0), dbTag2(0), useLast(last)
+   dbTag1(0), dbTag2(0), useLast(last), timeIncr(0.0)
 {
   // check vectors are of same size
   if (theLoadPath.Size() != theTimePath.Size()) {
@@ -86,6 +87,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       time = 0;
     }
   }
+
+  this->setTimeIncr();
 }
 
 PathTimeSeries::PathTimeSeries(int tag,
@@ -95,7 +98,7 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       bool last)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
-   dbTag1(0), dbTag2(0), useLast(last)
+   dbTag1(0), dbTag2(0), useLast(last), timeIncr(0.0)
 {
   // determine the number of data points
   int numDataPoints1 =0;
@@ -194,6 +197,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       }   // read in the path data and then do the time
     }
   }
+
+  this->setTimeIncr();
 }
 
 PathTimeSeries::PathTimeSeries(int tag,
@@ -202,7 +207,7 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       bool last)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
-   dbTag1(0), dbTag2(0), useLast(last)
+   dbTag1(0), dbTag2(0), useLast(last), timeIncr(0.0)
 {
   // determine the number of data points
   int numDataPoints = 0;
@@ -276,6 +281,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       theFile1.close();
     } 
   }
+
+  this->setTimeIncr();
 }
 
 PathTimeSeries::~PathTimeSeries()
@@ -309,54 +316,54 @@ PathTimeSeries::getFactor(double pseudoTime)
   if (thePath == 0)
     return 0.0;
 
-  // determine indexes into the data array whose boundary holds the time
-  double time1 = (*time)(currentTimeLoc);
+  int size = time->Size();
+  int sizem1 = size - 1;
+  int sizem2 = size - 2;
 
   // check for another quick return
-  if (pseudoTime < time1 && currentTimeLoc == 0)
+  if (pseudoTime < (*time)(0))
     return 0.0;
-  if (pseudoTime == time1)
-    return cFactor * (*thePath)[currentTimeLoc];
 
-  int size = time->Size();
-  int sizem1 = size - 1;
-  int sizem2 = size - 2;
-  
   // check we are not at the end
-  if (pseudoTime > time1 && currentTimeLoc == sizem1) {
+  if (pseudoTime > (*time)(sizem1)) {
     if (useLast == false)
       return 0.0;
     else
       return cFactor*(*thePath)[sizem1];
   }
 
+  if (size == 1)
+    return cFactor * (*thePath)[0];
+
+  if (currentTimeLoc > sizem2)
+    currentTimeLoc = sizem2;
+
   // otherwise go find the current interval
-  double time2 = (*time)(currentTimeLoc+1);
-  if (pseudoTime > time2) {
-    while ((pseudoTime > time2) && (currentTimeLoc < sizem2)) {
+  if (timeIncr > 0.0) {
+    // equally spaced time points, index directly and correct for round off
+    currentTimeLoc = (int)((pseudoTime - (*time)(0))/timeIncr);
+    if (currentTimeLoc > sizem2)
+      currentTimeLoc = sizem2;
+    while (currentTimeLoc > 0 && pseudoTime <= (*time)(currentTimeLoc))
+      currentTimeLoc--;
+    while (currentTimeLoc < sizem2 && pseudoTime > (*time)(currentTimeLoc+1))
       currentTimeLoc++;
-      time1 = time2;
-      time2 = (*time)(currentTimeLoc+1);
-    }
-    // if pseudo time greater than ending time return 0
-    if (pseudoTime > time2) {
-      if (useLast == false)
-        return 0.0;
-      else
-        return cFactor*(*thePath)[sizem1];
-    }
 
-  } else if (pseudoTime < time1) {
-    while ((pseudoTime < time1) && (currentTimeLoc > 0)) {
-      currentTimeLoc--;
-      time2 = time1;	
-      time1 = (*time)(currentTimeLoc);
-    }
-    // if starting time less than initial starting time return 0
-    if (pseudoTime < time1)
-      return 0.0;
+  } else if (pseudoTime > (*time)(currentTimeLoc+1) ||
+             (pseudoTime <= (*time)(currentTimeLoc) && currentTimeLoc > 0)) {
+    // bisection for the first time point not before pseudoTime
+    const double *times = &(*time)(0);
+    int loc = (int)(std::lower_bound(times, times + size, pseudoTime) - times);
+    currentTimeLoc = loc > 0 ? loc - 1 : 0;
+    if (currentTimeLoc > sizem2)
+      currentTimeLoc = sizem2;
   }
 
+  double time1 = (*time)(currentTimeLoc);
+  double time2 = (*time)(currentTimeLoc+1);
+  if (pseudoTime == time1)
+    return cFactor * (*thePath)[currentTimeLoc];
+
   double value1 = (*thePath)[currentTimeLoc];
   double value2 = (*thePath)[currentTimeLoc+1];
   return cFactor*(value1 + (value2-value1)*(pseudoTime-time1)/(time2 - time1));
@@ -506,9 +513,33 @@ PathTimeSeries::recvSelf(int commitTag, Channel &theChannel,
     return result;  
   }
 
+  this->setTimeIncr();
+
   return 0;    
 }
 
+void
+PathTimeSeries::setTimeIncr(void)
+{
+  // record the time increment if the time points are equally spaced so
+  // that getFactor() can locate the current interval directly
+  timeIncr = 0.0;
+  if (time == 0 || time->Size() < 2)
+    return;
+
+  int size = time->Size();
+  double incr = ((*time)(size-1) - (*time)(0))/(size-1);
+  if (incr <= 0.0)
+    return;
+
+  double tol = 1.0e-8*incr;
+  for (int i=1; i<size; i++)
+    if (fabs((*time)(i) - (*time)(0) - i*incr) > tol)
+      return;
+
+  timeIncr = incr;
+}
+
 void
 PathTimeSeries::Print(OPS_Stream &s, int flag)
 {
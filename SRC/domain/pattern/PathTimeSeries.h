@@ -86,12 +86,15 @@ class PathTimeSeries : public TimeSeries
   protected:
     
   private:
+    void setTimeIncr(void);
+
     Vector *thePath;      // vector containing the data points
     Vector *time;		  // vector containing the time values of data points
     int currentTimeLoc;   // current location in time
     double cFactor;       // additional factor on the returned load factor
     int dbTag1, dbTag2;   // additional database tags needed for vector objects
     bool useLast;
+    double timeIncr;      // time increment if time points are equally spaced, 0 otherwise
 };
 
 #endif
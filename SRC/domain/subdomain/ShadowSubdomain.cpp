@@ -91,7 +91,8 @@ ShadowSubdomain::ShadowSubdomain(int tag,
    numDOF(0),numElements(0),numNodes(0),numExternalNodes(0),
    numSPs(0),numMPs(0), buildRemote(false), gotRemoteData(false), 
    theFEele(0),
-   theVector(0), theMatrix(0)
+   theVector(0), theMatrix(0),
+   tangPosted(false), residPosted(false), tangRequest(-1), residRequest(-1)
 {
   
   numShadowSubdomains++;
@@ -138,7 +139,8 @@ ShadowSubdomain::ShadowSubdomain(int tag,
    numDOF(0),numElements(0),numNodes(0),numExternalNodes(0),
    numSPs(0),numMPs(0), buildRemote(false), gotRemoteData(false), 
    theFEele(0),
-   theVector(0), theMatrix(0)
+   theVector(0), theMatrix(0),
+   tangPosted(false), residPosted(false), tangRequest(-1), residRequest(-1)
 {
 
   numShadowSubdomains++;
@@ -165,6 +167,12 @@ ShadowSubdomain::ShadowSubdomain(int tag,
 
 ShadowSubdomain::~ShadowSubdomain()    
 {
+  // complete any outstanding requests
+  if (tangPosted == true && tangRequest >= 0)
+    this->wait(tangRequest);
+  if (residPosted == true && residRequest >= 0)
+    this->wait(residRequest);
+
   // send a message to the remote actor telling it to shut sown
   msgData(0) = ShadowActorSubdomain_DIE;
   this->sendID(msgData);
@@ -1274,6 +1282,14 @@ ShadowSubdomain::getTang(void)
   if (gotRemoteData == false && buildRemote == true)
     this->getRemoteData();
 
+    // the tangent may already be on its way
+    if (tangPosted == true) {
+      tangPosted = false;
+      if (tangRequest >= 0 && this->wait(tangRequest) < 0)
+	opserr << "ShadowSubdomain::getTang() - failed to recv the tangent\n";
+      return *theMatrix;
+    }
+
     msgData(0) =  ShadowActorSubdomain_getTang;
     this->sendID(msgData);
     
@@ -1297,6 +1313,14 @@ ShadowSubdomain::getResistingForce(void)
   if (gotRemoteData == false && buildRemote == true)
     this->getRemoteData();
 
+    // the residual may already be on its way
+    if (residPosted == true) {
+      residPosted = false;
+      if (residRequest >= 0 && this->wait(residRequest) < 0)
+	opserr << "ShadowSubdomain::getResistingForce() - failed to recv the residual\n";
+      return *theVector;
+    }
+
     msgData(0) = ShadowActorSubdomain_getResistingForce;
     this->sendID(msgData);
     
@@ -1327,6 +1351,11 @@ ShadowSubdomain::computeTang(void)
 	if (theShadow != this)
 	  theShadow->computeTang();
       }
+
+      // with all the actors busy, request their tangents so they are
+      // received while the local work goes on
+      for (int i = 0; i < numShadowSubdomains; i++)
+	theShadowSubdomains[i]->postTang();
     }
     else if (count <= numShadowSubdomains) {
       msgData(0) = ShadowActorSubdomain_computeTang;
@@ -1353,6 +1382,9 @@ ShadowSubdomain::computeResidual(void)
 	if (theShadow != this)
 	  theShadow->computeResidual();
       }
+
+      for (int i = 0; i < numShadowSubdomains; i++)
+	theShadowSubdomains[i]->postResidual();
     }
     else if (count <= numShadowSubdomains) {
       msgData(0) = ShadowActorSubdomain_computeResidual;
@@ -1366,6 +1398,60 @@ ShadowSubdomain::computeResidual(void)
 
 
 
+void
+ShadowSubdomain::postTang(void)
+{
+    // a tangent that was never asked for is received first
+    if (tangPosted == true && tangRequest >= 0)
+      this->wait(tangRequest);
+
+    if (gotRemoteData == false && buildRemote == true)
+      this->getRemoteData();
+
+    msgData(0) =  ShadowActorSubdomain_getTang;
+    this->sendID(msgData);
+
+    if (theMatrix == 0)
+	theMatrix = new Matrix(numDOF,numDOF);
+    else if (theMatrix->noRows() != numDOF) {
+	delete theMatrix;
+	theMatrix = new Matrix(numDOF,numDOF);
+    }    
+
+    // channels without non-blocking communication receive it here
+    tangRequest = this->irecvMatrix(*theMatrix);
+    if (tangRequest < 0)
+      this->recvMatrix(*theMatrix);
+    tangPosted = true;
+}
+
+
+void
+ShadowSubdomain::postResidual(void)
+{
+    if (residPosted == true && residRequest >= 0)
+      this->wait(residRequest);
+
+    if (gotRemoteData == false && buildRemote == true)
+      this->getRemoteData();
+
+    msgData(0) = ShadowActorSubdomain_getResistingForce;
+    this->sendID(msgData);
+
+    if (theVector == 0)
+	theVector = new Vector(numDOF);
+    else if (theVector->Size() != numDOF) {
+	delete theVector;
+	theVector = new Vector(numDOF);
+    }    
+
+    residRequest = this->irecvVector(*theVector);
+    if (residRequest < 0)
+      this->recvVector(*theVector);
+    residPosted = true;
+}
+
+
 const Vector &
 ShadowSubdomain::getLastExternalSysResponse(void)
 {
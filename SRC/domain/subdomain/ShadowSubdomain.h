@@ -186,6 +186,9 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual int buildNodeGraph(Graph *theNodeGraph);    
     
   private:
+    void postTang(void);
+    void postResidual(void);
+
     ID msgData;
     ID theElements;
     ID theNodes;
@@ -211,6 +214,12 @@ class ShadowSubdomain: public Shadow, public Subdomain
 
     Vector *theVector; // for storing residual info
     Matrix *theMatrix; // for storing tangent info
+
+    // the tangent and residual are requested from the actor when it is
+    // told to compute them; getTang() and getResistingForce() then only
+    // wait for them to arrive
+    bool tangPosted, residPosted;
+    int tangRequest, residRequest;
     
     static char *shadowSubdomainProgram;
 
@@ -42,6 +42,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <Node.h>
+#include <MemoryReport.h>
 #include <Domain.h>
 
 Element  *ops_TheActiveElement = 0;
@@ -59,7 +60,7 @@ Element::Element(int tag, int cTag)
   :DomainComponent(tag, cTag), alphaM(0.0), 
   betaK(0.0), betaK0(0.0), betaKc(0.0), 
       Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1),
-      is_this_element_active(true)
+      is_this_element_active(true), theDamp(0), matrixStamp(0)
 {
   // does nothing
   ops_TheActiveElement = this;
@@ -70,6 +71,9 @@ Element::~Element()
   if (Kc != 0)
     delete Kc;
 
+  if (theDamp != 0)
+    delete theDamp;
+
   if (previousK != 0) {
     for (int i=0; i<numPreviousK; i++)
       delete previousK[i];
@@ -92,6 +96,32 @@ Element::update(void)
     return 0;
 }
 
+bool
+Element::isLinear(void)
+{
+  return false;
+}
+
+bool
+Element::isReentrant(void)
+{
+  return false;
+}
+
+// clearMatrixCache():
+//      to be invoked by linear elements when their matrices change, e.g.
+//      in updateParameter(); drops the damping matrix kept here and tells
+//      the FE_Elements their copies of the tangent are stale.
+void
+Element::clearMatrixCache(void)
+{
+  if (theDamp != 0) {
+    delete theDamp;
+    theDamp = 0;
+  }
+  matrixStamp++;
+}
+
 int
 Element::revertToStart(void)
 {
@@ -120,6 +150,9 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   betaK0 = betak0;
   betaKc = betakc;
 
+  // the damping matrix and the tangents formed with it are stale
+  this->clearMatrixCache();
+
   // check that memory has been allocated to store compute/return
   // damping matrix & residual force calculations
   if (index == -1) {
@@ -214,6 +247,23 @@ Element::getDamp(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
+  return this->getRayleighDamping();
+}
+
+
+// getRayleighDamping():
+//      forms alphaM M + betaK K + betaK0 K0 + betaKc Kc; for a linear
+//      element the matrix is kept and formed again only when the factors
+//      or the element matrices change.
+const Matrix &
+Element::getRayleighDamping(void)
+{
+  bool linear = this->isLinear();
+  if (linear == true && theDamp != 0 &&
+      dampFactors[0] == alphaM && dampFactors[1] == betaK &&
+      dampFactors[2] == betaK0 && dampFactors[3] == betaKc)
+    return *theDamp;
+
   // now compute the damping matrix
   Matrix *theMatrix = theMatrices[index]; 
   theMatrix->Zero();
@@ -226,8 +276,19 @@ Element::getDamp(void)
   if (betaKc != 0.0)
     theMatrix->addMatrix(1.0, *Kc, betaKc);      
 
-  // return the computed matrix
-  return *theMatrix;
+  if (linear == false)
+    return *theMatrix;
+
+  if (theDamp == 0)
+    theDamp = new Matrix(*theMatrix);
+  else
+    *theDamp = *theMatrix;
+  dampFactors[0] = alphaM;
+  dampFactors[1] = betaK;
+  dampFactors[2] = betaK0;
+  dampFactors[3] = betaKc;
+
+  return *theDamp;
 }
 
 
@@ -252,7 +313,6 @@ Element::getResistingForceIncInertia(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
   Vector *theVector = theVectors2[index];
   Vector *theVector2 = theVectors1[index];
 
@@ -293,19 +353,8 @@ Element::getResistingForceIncInertia(void)
     }
   }
 
-  // now compute the damping matrix
-  theMatrix->Zero();
-  if (alphaM != 0.0)
-    theMatrix->addMatrix(0.0, this->getMass(), alphaM);
-  if (betaK != 0.0)
-    theMatrix->addMatrix(1.0, this->getTangentStiff(), betaK);      
-  if (betaK0 != 0.0)
-    theMatrix->addMatrix(1.0, this->getInitialStiff(), betaK0);      
-  if (betaKc != 0.0)
-    theMatrix->addMatrix(1.0, *Kc, betaKc);      
-
   // finally the D * v
-  theVector->addMatrixVector(1.0, *theMatrix, *theVector2, 1.0);
+  theVector->addMatrixVector(1.0, this->getRayleighDamping(), *theVector2, 1.0);
 
   return *theVector;
 }
@@ -319,7 +368,6 @@ Element::getRayleighDampingForces(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
   Vector *theVector = theVectors2[index];
   Vector *theVector2 = theVectors1[index];
 
@@ -339,19 +387,8 @@ Element::getRayleighDampingForces(void)
     }
   }
 
-  // now compute the damping matrix
-  theMatrix->Zero();
-  if (alphaM != 0.0)
-    theMatrix->addMatrix(0.0, this->getMass(), alphaM);
-  if (betaK != 0.0)
-    theMatrix->addMatrix(1.0, this->getTangentStiff(), betaK);      
-  if (betaK0 != 0.0)
-    theMatrix->addMatrix(1.0, this->getInitialStiff(), betaK0);      
-  if (betaKc != 0.0)
-    theMatrix->addMatrix(1.0, *Kc, betaKc);      
-
   // finally the D * v
-  theVector->addMatrixVector(0.0, *theMatrix, *theVector2, 1.0);
+  theVector->addMatrixVector(0.0, this->getRayleighDamping(), *theVector2, 1.0);
 
   return *theVector;
 }
@@ -759,6 +796,23 @@ Element::getPreviousK(int num) {
     return 0;
 }
 
+void
+Element::reportMemory(MemoryReport &theReport)
+{
+  // the size of a subclass is unknown here, the element is only counted
+  theReport.add("element", this->getClassType(), 0.0);
+}
+
+double
+Element::getBaseMemory(void)
+{
+  double bytes = MemoryReport::getBytes(Kc) + MemoryReport::getBytes(theDamp);
+  for (int i = 0; i < numPreviousK; i++)
+    bytes += MemoryReport::getBytes(previousK[i]);
+
+  return bytes;
+}
+
 int 
 Element::displaySelf(Renderer &, int mode, float fact, const char **displayModes, int numModes)
 {
@@ -47,6 +47,7 @@ class Response;
 class ElementalLoad;
 class Node;
 class Damping;
+class MemoryReport;
 
 class Element : public DomainComponent
 {
@@ -67,6 +68,17 @@ class Element : public DomainComponent
     virtual int revertToStart(void);                
     virtual int update(void);
     virtual bool isSubdomain(void);
+
+    // linear elements, whose matrices do not depend on the state, return
+    // true; the matrices formed from them may then be kept until the
+    // matrix stamp changes
+    virtual bool isLinear(void);
+    int getMatrixStamp(void) const {return matrixStamp;};
+    void clearMatrixCache(void);
+
+    // elements whose update() only writes their own state, and no class
+    // wide work areas, return true; only those are updated on threads
+    virtual bool isReentrant(void);
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -114,6 +126,11 @@ class Element : public DomainComponent
     virtual int storePreviousK(int numK);
     virtual const Matrix *getPreviousK(int num);
 
+    // method to add the bytes held by the element, and by its sections
+    // and materials, to a memory report; the default only counts the
+    // element and does not reach its sections and materials
+    virtual void reportMemory(MemoryReport &theReport);
+
     virtual void onActivate();
     virtual void onDeactivate();
 
@@ -126,6 +143,7 @@ class Element : public DomainComponent
 
 protected:
 	const Vector& getRayleighDampingForces(void);
+    double getBaseMemory(void);  // bytes of the matrices kept by Element
 
     double alphaM, betaK, betaK0, betaKc;
     Matrix *Kc; // pointer to hold last committed matrix if needed for rayleigh damping
@@ -143,6 +161,11 @@ protected:
     bool is_this_element_active;
 
   private:
+    const Matrix &getRayleighDamping(void);
+
+    Matrix *theDamp;          // Rayleigh damping of a linear element
+    double dampFactors[4];    // alphaM, betaK, betaK0, betaKc theDamp was formed with
+    int matrixStamp;          // changed when the element matrices are changed
 };
 
 
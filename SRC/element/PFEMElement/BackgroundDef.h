@@ -33,6 +33,7 @@
 #include <Vector.h>
 #include <math.h>
 
+#include <cstddef>
 #include <iostream>
 #include <map>
 #include <set>
@@ -51,6 +52,19 @@ typedef std::vector<VDouble> VVDouble;
 typedef std::vector<Particle*> VParticle;
 typedef std::vector<VParticle> VVParticle;
 
+// hash of a grid index, for keeping cells and nodes in hashed containers
+struct VIntHash {
+    std::size_t operator()(const VInt& v) const {
+        unsigned long long h = 0x9E3779B97F4A7C15ULL;
+        for (int i = 0; i < (int)v.size(); ++i) {
+            h ^= (unsigned long long)(unsigned int)v[i];
+            h *= 0xBF58476D1CE4E5B9ULL;
+            h ^= h >> 31;
+        }
+        return (std::size_t)h;
+    }
+};
+
 // functions for VDouble
 const VDouble& operator+=(VDouble& v1, const VDouble& v2);
 const VDouble& operator-=(VDouble& v1, const VDouble& v2);
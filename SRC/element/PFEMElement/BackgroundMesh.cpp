@@ -501,7 +501,7 @@ void BackgroundMesh::gatherParticles(const VInt& minind,
             index[0] = i;
             for (int j = minind[1]; j < maxind[1]; ++j) {
                 index[1] = j;
-                std::map<VInt, BCell>::iterator it =
+                BCellMap::iterator it =
                     bcells.find(index);
                 if (it != bcells.end()) {
                     BCell& cell = it->second;
@@ -521,7 +521,7 @@ void BackgroundMesh::gatherParticles(const VInt& minind,
                 index[1] = j;
                 for (int k = minind[2]; k < maxind[2]; ++k) {
                     index[2] = k;
-                    std::map<VInt, BCell>::iterator it =
+                    BCellMap::iterator it =
                         bcells.find(index);
                     if (it != bcells.end()) {
                         BCell& cell = it->second;
@@ -787,7 +787,7 @@ void BackgroundMesh::clearGrid() {
     if (domain == 0) return;
 
     // remove cells
-    for (std::map<VInt, BNode>::iterator it = bnodes.begin();
+    for (BNodeMap::iterator it = bnodes.begin();
          it != bnodes.end(); ++it) {
         BNode& bnode = it->second;
         const VInt& tags = bnode.getTags();
@@ -1270,9 +1270,9 @@ int BackgroundMesh::gridNodes() {
     if (domain == 0) return 0;
 
     // vector of iterators
-    std::vector<std::map<VInt, BNode>::iterator> iters;
+    std::vector<BNodeMap::iterator> iters;
     iters.reserve(bnodes.size());
-    for (std::map<VInt, BNode>::iterator it = bnodes.begin();
+    for (BNodeMap::iterator it = bnodes.begin();
          it != bnodes.end(); ++it) {
         iters.push_back(it);
     }
@@ -1288,7 +1288,7 @@ int BackgroundMesh::gridNodes() {
 #pragma omp parallel for
     for (int j = 0; j < (int)iters.size(); ++j) {
         // get iterator
-        std::map<VInt, BNode>::iterator it = iters[j];
+        BNodeMap::iterator it = iters[j];
 
         // get cell
         const VInt& index = it->first;
@@ -1511,11 +1511,19 @@ int BackgroundMesh::gridNodes() {
 int BackgroundMesh::moveFixedParticles() {
     int ndm = OPS_GetNDM();
 
-    // check each cell
+    // cells may be added below, which would invalidate iterators
+    // of the hashed container, so walk a snapshot of the cells
+    std::vector<BCellMap::value_type*> items;
+    items.reserve(bcells.size());
     for (auto it = bcells.begin(); it != bcells.end(); ++it) {
+        items.push_back(&(*it));
+    }
+
+    // check each cell
+    for (int j = 0; j < (int)items.size(); ++j) {
         // get cell
-        const VInt& index = it->first;
-        BCell& cell = it->second;
+        const VInt& index = items[j]->first;
+        BCell& cell = items[j]->second;
 
         // empty cell
         if (cell.getPts().empty()) {
@@ -1790,7 +1798,7 @@ int BackgroundMesh::gridFluid() {
     VVInt indices;
     cells.reserve(bcells.size());
     indices.reserve(bcells.size());
-    for (std::map<VInt, BCell>::iterator it = bcells.begin();
+    for (BCellMap::iterator it = bcells.begin();
          it != bcells.end(); ++it) {
         indices.push_back(it->first);
         cells.push_back(&(it->second));
@@ -2506,7 +2514,7 @@ int BackgroundMesh::gridFSI() {
 
     // gather bnodes
     std::map<VInt, BNode*> fsibnodes;
-    for (std::map<VInt, BCell>::iterator it = bcells.begin();
+    for (BCellMap::iterator it = bcells.begin();
          it != bcells.end(); ++it) {
         // only for structural cells
         BCell& bcell = it->second;
@@ -2703,7 +2711,7 @@ int BackgroundMesh::gridFSI() {
                     for (int k = minind[1]; k < maxind[1]; ++k) {
                         currind[0] = j;
                         currind[1] = k;
-                        std::map<VInt, BCell>::iterator it =
+                        BCellMap::iterator it =
                             bcells.find(currind);
                         if (it == bcells.end()) {
                             outside = true;
@@ -2725,7 +2733,7 @@ int BackgroundMesh::gridFSI() {
                             currind[0] = j;
                             currind[1] = k;
                             currind[2] = l;
-                            std::map<VInt, BCell>::iterator it =
+                            BCellMap::iterator it =
                                 bcells.find(currind);
                             if (it == bcells.end()) {
                                 outside = true;
@@ -2767,7 +2775,7 @@ int BackgroundMesh::gridFSI() {
             VVInt indices;
             getCorners(ind, 1, indices);
             for (int k = 0; k < (int)indices.size(); ++k) {
-                std::map<VInt, BCell>::iterator cellit =
+                BCellMap::iterator cellit =
                     bcells.find(indices[k]);
                 if (cellit == bcells.end()) continue;
                 if (cellit->second.getType() == BACKGROUND_STRUCTURE)
@@ -3110,7 +3118,7 @@ int BackgroundMesh::moveParticles() {
     double dt = domain->getCurrentTime() - currentTime;
 
     // get current disp and velocity
-    for (std::map<VInt, BNode>::iterator it = bnodes.begin();
+    for (BNodeMap::iterator it = bnodes.begin();
          it != bnodes.end(); ++it) {
         BNode& bnode = it->second;
         VInt& tags = bnode.getTags();
@@ -3144,7 +3152,7 @@ int BackgroundMesh::moveParticles() {
     VVInt indices;
     cells.reserve(bcells.size());
     indices.reserve(bcells.size());
-    for (std::map<VInt, BCell>::iterator it = bcells.begin();
+    for (BCellMap::iterator it = bcells.begin();
          it != bcells.end(); ++it) {
         indices.push_back(it->first);
         cells.push_back(&(it->second));
@@ -36,12 +36,18 @@
 
 #include <fstream>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "BCell.h"
 #include "BNode.h"
 #include "BackgroundDef.h"
 
+// sparse grid of cells and nodes; BNode addresses stay valid as the
+// containers grow, which the cells rely on
+typedef std::unordered_map<VInt, BCell, VIntHash> BCellMap;
+typedef std::unordered_map<VInt, BNode, VIntHash> BNodeMap;
+
 class BackgroundMesh {
    public:
     BackgroundMesh();
@@ -153,8 +159,8 @@ class BackgroundMesh {
 
    private:
     VInt lower, upper;
-    std::map<VInt, BCell> bcells;
-    std::map<VInt, BNode> bnodes;
+    BCellMap bcells;
+    BNodeMap bnodes;
     double tol;
     double bsize;
     int numave, numsub;
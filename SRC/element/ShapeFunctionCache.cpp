@@ -0,0 +1,115 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of
+// ShapeFunctionCache.
+
+#include <ShapeFunctionCache.h>
+#include <Node.h>
+#include <Vector.h>
+#include <MemoryReport.h>
+#include <math.h>
+
+ShapeFunctionCache::Pool ShapeFunctionCache::thePool;
+
+
+ShapeFunctionCache::ShapeFunctionCache(int nodes, int points, int nShape)
+  :numUsers(1), numNodes(nodes), numShape(nShape), formed(false),
+   shape(points*nShape*nodes), weight(points)
+{
+
+}
+
+
+// getCache():
+//      the key is made of the class, the sizes and the coordinates of
+//      the nodes relative to the first node, rounded to about 1e-12 of
+//      the size of the element, so elements whose coordinates only
+//      differ by roundoff share a cache.
+ShapeFunctionCache *
+ShapeFunctionCache::getCache(int classTag, Node **theNodes, int numNodes,
+			     int numPoints, int numShape)
+{
+  const Vector &crd0 = theNodes[0]->getCrds();
+  int ndm = crd0.Size();
+
+  std::vector<double> relative(numNodes*ndm);
+  double size = 0.0;
+  for (int i = 0; i < numNodes; i++) {
+    const Vector &crds = theNodes[i]->getCrds();
+    for (int j = 0; j < ndm; j++) {
+      double x = crds(j) - crd0(j);
+      relative[i*ndm+j] = x;
+      if (fabs(x) > size)
+	size = fabs(x);
+    }
+  }
+
+  int exponent = 0;
+  frexp(size, &exponent);
+  double quantum = ldexp(1.0, exponent-40);
+
+  std::vector<long long> key;
+  key.reserve(6 + numNodes*ndm);
+  key.push_back(classTag);
+  key.push_back(numNodes);
+  key.push_back(ndm);
+  key.push_back(numPoints);
+  key.push_back(numShape);
+  key.push_back(exponent);
+  for (int i = 0; i < numNodes*ndm; i++)
+    key.push_back(llround(relative[i]/quantum));
+
+  Pool::iterator theEntry = thePool.find(key);
+  if (theEntry != thePool.end()) {
+    theEntry->second->numUsers++;
+    return theEntry->second;
+  }
+
+  ShapeFunctionCache *theCache = new ShapeFunctionCache(numNodes, numPoints, numShape);
+  theCache->theEntry = thePool.insert(Pool::value_type(key, theCache)).first;
+
+  return theCache;
+}
+
+
+void
+ShapeFunctionCache::releaseCache(ShapeFunctionCache *theCache)
+{
+  if (theCache == 0)
+    return;
+
+  if (--theCache->numUsers == 0) {
+    thePool.erase(theCache->theEntry);
+    delete theCache;
+  }
+}
+
+
+void
+ShapeFunctionCache::reportMemory(MemoryReport &theReport)
+{
+  for (Pool::iterator it = thePool.begin(); it != thePool.end(); it++) {
+    ShapeFunctionCache *theCache = it->second;
+    double bytes = sizeof(ShapeFunctionCache) + it->first.size()*sizeof(long long)
+      + (theCache->shape.size() + theCache->weight.size())*sizeof(double);
+    theReport.add("element", "ShapeFunctionCache", bytes);
+  }
+}
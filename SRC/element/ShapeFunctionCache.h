@@ -0,0 +1,75 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ShapeFunctionCache_h
+#define ShapeFunctionCache_h
+
+// Description: This file contains the class definition for
+// ShapeFunctionCache. A ShapeFunctionCache holds the shape functions
+// and their global derivatives at the integration points of an
+// element, as numShape x numNodes row major arrays, together with the
+// weight of each point times the jacobian. As these only depend on the
+// nodal coordinates, a small strain element forms them once rather
+// than on every call to update(), getTangentStiff() and
+// getResistingForce(). The caches are shared by the elements of a
+// class whose nodes are the same up to a translation, as in a regular
+// mesh: getCache() returns the cache of such an element, or a new one
+// for which isFormed() is false and which the element fills in. The pool
+// of caches is not locked, so elements get and fill their cache in
+// setDomain(), which is invoked serially, not in update(). As nodes can
+// be moved without setDomain() being invoked, the elements look their
+// cache up again when Node::getCrdsStamp() has changed since.
+
+#include <map>
+#include <vector>
+
+class Node;
+class MemoryReport;
+
+class ShapeFunctionCache
+{
+  public:
+    static ShapeFunctionCache *getCache(int classTag, Node **theNodes, int numNodes,
+					int numPoints, int numShape);
+    static void releaseCache(ShapeFunctionCache *theCache);
+    static void reportMemory(MemoryReport &theReport);
+
+    bool isFormed(void) const {return formed;};
+    void setFormed(void) {formed = true;};
+
+    double *getShape(int point) {return &shape[point*numShape*numNodes];};
+    double &getWeight(int point) {return weight[point];};
+
+  private:
+    typedef std::map<std::vector<long long>, ShapeFunctionCache *> Pool;
+
+    ShapeFunctionCache(int numNodes, int numPoints, int numShape);
+
+    static Pool thePool;
+    Pool::iterator theEntry;
+    int numUsers;
+
+    int numNodes, numShape;
+    bool formed;
+    std::vector<double> shape;
+    std::vector<double> weight;
+};
+
+#endif
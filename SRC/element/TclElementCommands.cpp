@@ -121,6 +121,7 @@ extern void *OPS_SSPquadUP(void);
 extern void *OPS_SSPbrick(void);
 extern void *OPS_SSPbrickUP(void);
 extern void *OPS_ShellMITC4(void);
+extern void *OPS_CondensedSubstructure(void);
 extern void *OPS_ShellMITC9(void);
 extern void *OPS_ShellDKGQ(void);     //Added by Lisha Wang, Xinzheng Lu, Linlin Xie, Song Cen & Quan Gu
 extern void *OPS_ShellNLDKGQ(void);   //Added by Lisha Wang, Xinzheng Lu, Linlin Xie, Song Cen & Quan Gu
@@ -998,6 +999,16 @@ TclModelBuilderElementCommand(ClientData clientData, Tcl_Interp *interp,
       return TCL_ERROR;
     }    
 
+  } else if (strcmp(argv[1],"condensedSubstructure") == 0) {
+    
+    void *theEle = OPS_CondensedSubstructure();
+    if (theEle != 0) 
+      theElement = (Element *)theEle;
+    else {
+      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
+      return TCL_ERROR;
+    }    
+
     //Added by L.Jiang [SIF]
   } else if ((strcmp(argv[1], "shellMITC4Thermal") == 0) 
 	     || (strcmp(argv[1], "ShellMITC4Thermal") == 0)) {
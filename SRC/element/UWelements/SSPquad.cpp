@@ -411,7 +411,8 @@ SSPquad::update(void)
 	const Vector &mDisp_4 = theNodes[3]->getTrialDisp();
 	
 	// assemble displacement vector
-	Vector u(8);
+	double uData[8];
+	Vector u(uData, 8);
 	u(0) = mDisp_1(0);
 	u(1) = mDisp_1(1);
 	u(2) = mDisp_2(0);
@@ -421,8 +422,10 @@ SSPquad::update(void)
 	u(6) = mDisp_4(0);
 	u(7) = mDisp_4(1);
 
-	Vector strain(3);
-	strain = Mmem*u;
+	// strain from the mapping matrix formed in setDomain()
+	double strainData[3];
+	Vector strain(strainData, 3);
+	strain.addMatrixVector(0.0, Mmem, u, 1.0);
 	theMaterial->setTrialStrain(strain);
 
 	return 0;
@@ -557,7 +560,7 @@ SSPquad::getResistingForce(void)
 // this function computes the resisting force vector for the element
 {
 	// get stress from the material
-	Vector mStress = theMaterial->getStress();
+	const Vector &mStress = theMaterial->getStress();
 
 	// get trial displacement
 	const Vector &mDisp_1 = theNodes[0]->getTrialDisp();
@@ -565,7 +568,8 @@ SSPquad::getResistingForce(void)
 	const Vector &mDisp_3 = theNodes[2]->getTrialDisp();
 	const Vector &mDisp_4 = theNodes[3]->getTrialDisp();
 
-	Vector d(8);
+	double dData[8];
+	Vector d(dData, 8);
 	d(0) = mDisp_1(0);
 	d(1) = mDisp_1(1);
 	d(2) = mDisp_2(0);
@@ -576,7 +580,7 @@ SSPquad::getResistingForce(void)
 	d(7) = mDisp_4(1);
 	
 	// add stabilization force to internal force vector
-	mInternalForces = Kstab*d;
+	mInternalForces.addMatrixVector(0.0, Kstab, d, 1.0);
 
 	// add internal force from the stress  ->  fint = Kstab*d + 4*t*Jo*Mmem'*stress
 	mInternalForces.addMatrixTransposeVector(1.0, Mmem, mStress, 4.0*mThickness*J0);
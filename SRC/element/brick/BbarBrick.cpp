@@ -40,6 +40,7 @@
 #include <ErrorHandler.h>
 #include <BbarBrick.h>
 #include <shp3d.h>
+#include <ShapeFunctionCache.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
 #include <Parameter.h>
@@ -111,7 +112,7 @@ const double  BbarBrick::wg[] = { 1.0, 1.0, 1.0, 1.0,
 //null constructor
 BbarBrick::BbarBrick( ) :
 Element( 0, ELE_TAG_BbarBrick ),
-connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), theShapes(0), shapesStamp(0)
 {
   for (int i=0; i<8; i++ ) {
     materialPointers[i] = 0;
@@ -137,7 +138,7 @@ BbarBrick::BbarBrick(  int tag,
 			 NDMaterial &theMaterial,
 			 double b1, double b2, double b3) :
 Element( tag, ELE_TAG_BbarBrick ),
-connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), theShapes(0), shapesStamp(0)
 {
   connectedExternalNodes(0) = node1 ;
   connectedExternalNodes(1) = node2 ;
@@ -187,6 +188,8 @@ BbarBrick::~BbarBrick( )
 
   if (Ki != 0)
     delete Ki;
+
+  ShapeFunctionCache::releaseCache(theShapes);
 }
 
 
@@ -200,6 +203,16 @@ void  BbarBrick::setDomain( Domain *theDomain )
   for ( i=0; i<8; i++ )
      nodePointers[i] = theDomain->getNode( connectedExternalNodes(i) ) ;
 
+  //the nodes or their coordinates may have changed
+  ShapeFunctionCache::releaseCache(theShapes);
+  theShapes = 0;
+
+  //form the shared shape functions here, as the pool of caches is not
+  //safe to use from elements updated on threads
+  for ( i=0; i<8 && nodePointers[i] != 0; i++ ) ;
+  if ( i == 8 )
+    getShapes( ) ;
+
   this->DomainComponent::setDomain(theDomain);
 
 }
@@ -330,167 +343,37 @@ const Matrix&  BbarBrick::getInitialStiff( )
     return *Ki;
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31
-
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ;
-
   static const int nstress = 6 ;
-
   static const int numberNodes = 8 ;
-
   static const int numberGauss = 8 ;
 
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
-  int jj, kk ;
-
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
-  static Vector strain(nstress) ;  //strain
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
-
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-
-  static Matrix dd(nstress,nstress) ;  //material tangent
-
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
+  //Bbar matrix of all the nodes
+  double Bdata[nstress*ndf*numberNodes] ;
+  Matrix B( Bdata, nstress, ndf*numberNodes ) ;
+  B.Zero( ) ;
 
   //zero stiffness and residual
   stiff.Zero( ) ;
 
+  //shape functions at the gauss points and their mean values
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //zero mean shape functions
-  for ( p = 0; p < nShape; p++ ) {
-    for ( q = 0; q < numberNodes; q++ )
-      shpBar[p][q] = 0.0 ;
-  } // end for p
-
-  //zero volume
-  volume = 0.0 ;
-
-
-  //gauss loop to compute and save shape functions
-  int count = 0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;
-	gaussPoint[1] = sg[j] ;
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;
-
-        //add to volume
-	volume += dvol[count] ;
-
-	//add to mean shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    shpBar[p][q] += ( dvol[count] * shp[p][q] ) ;
-	} // end for p
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i
-
-
-  //mean value of shape functions
-  for ( p = 0; p < nShape; p++ ) {
-    for ( q = 0; q < numberNodes; q++ )
-      shpBar[p][q] /= volume ;
-  } // end for p
-
+  const double (*shpBar)[numberNodes] =
+    reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(numberGauss) ) ;
 
   //gauss loop
-  for ( i = 0; i < numberGauss; i++ ) {
-
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
-
-    dd = materialPointers[i]->getInitialTangent( ) ;
-    dd *= dvol[i] ;
+  for ( int i = 0; i < numberGauss; i++ ) {
 
-    //residual and tangent calculations node loops
-
-    jj = 0 ;
-    for ( j = 0; j < numberNodes; j++ ) {
-
-      BJ = computeBbar( j, shp, shpBar ) ;
-
-      //transpose
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) {
-	for (q=0; q<nstress; q++)
-	  BJtran(p,q) = BJ(q,p) ;
-      }//end for p
-
-      //BJtranD = BJtran * dd ;
-      BJtranD.addMatrixProduct(0.0,  BJtran,dd,1.0);
-
-      kk = 0 ;
-      for ( k = 0; k < numberNodes; k++ ) {
+    const double (*shp)[numberNodes] =
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
-	BK = computeBbar( k, shp, shpBar ) ;
+    computeBbar( shp, shpBar, B ) ;
 
-	//stiffJK =  BJtranD * BK  ;
-	stiffJK.addMatrixProduct(0.0,  BJtranD,BK,1.0) ;
+    //stiff += Bbar' * dd * Bbar * dvol
+    const Matrix &dd = materialPointers[i]->getInitialTangent( ) ;
+    stiff.addMatrixTripleProduct( 1.0, B, dd, shapes->getWeight(i) ) ;
 
-	for ( p = 0; p < ndf; p++ )  {
-	  for ( q = 0; q < ndf; q++ )
-	    stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-	} //end for p
-
-	kk += ndf ;
-      } // end for k loop
-
-      jj += ndf ;
-
-    } // end for j loop
   } //end for i gauss loop
 
   Ki = new Matrix(stiff);
@@ -639,8 +522,6 @@ const Vector&  BbarBrick::getResistingForceIncInertia( )
 void   BbarBrick::formInertiaTerms( int tangFlag )
 {
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ;
 
   static const int numberNodes = 8 ;
@@ -651,19 +532,9 @@ void   BbarBrick::formInertiaTerms( int tangFlag )
 
   static const int massIndex = nShape - 1 ;
 
-  double xsj ;  // determinant jacaobian matrix
-
-  double dvol[numberGauss] ; //volume element
+  double momentum[ndf] ;
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static double gaussPoint[ndm] ;
-
-  static Vector momentum(ndf) ;
-
-  int i, j, k, p, q ;
+  int i, j, k, p ;
   int jj, kk ;
 
   double temp, rho, massJK ;
@@ -672,75 +543,45 @@ void   BbarBrick::formInertiaTerms( int tangFlag )
   //zero mass
   mass.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions
-
-  int count = 0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;
-	gaussPoint[1] = sg[j] ;
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i
-
-
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop
   for ( i = 0; i < numberGauss; i++ ) {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
+    const double (*shp)[numberNodes] =
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
+    double dvol = shapes->getWeight(i) ;
 
     //node loop to compute acceleration
-    momentum.Zero( ) ;
-    for ( j = 0; j < numberNodes; j++ )
+    for ( p = 0; p < ndf; p++ )
+      momentum[p] = 0.0 ;
+    for ( j = 0; j < numberNodes; j++ ) {
       //momentum += shp[massIndex][j] * ( nodePointers[j]->getTrialAccel()  ) ;
-      momentum.addVector( 1.0,
-			  nodePointers[j]->getTrialAccel(),
-			  shp[massIndex][j] ) ;
+      const Vector &accel = nodePointers[j]->getTrialAccel() ;
+      for ( p = 0; p < ndf; p++ )
+	momentum[p] += shp[massIndex][j] * accel(p) ;
+    }
 
 
     //density
     rho = materialPointers[i]->getRho() ;
 
+
     //multiply acceleration by density to form momentum
-    momentum *= rho ;
+    for ( p = 0; p < ndf; p++ )
+      momentum[p] *= rho ;
 
 
     //residual and tangent calculations node loops
     jj = 0 ;
     for ( j = 0; j < numberNodes; j++ ) {
 
-      temp = shp[massIndex][j] * dvol[i] ;
+      temp = shp[massIndex][j] * dvol ;
 
       for ( p = 0; p < ndf; p++ )
-        resid( jj+p ) += ( temp * momentum(p) )  ;
+        resid( jj+p ) += ( temp * momentum[p] )  ;
 
 
       if ( tangFlag == 1 ) {
@@ -777,8 +618,6 @@ void  BbarBrick::formResidAndTangent( int tang_flag )
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ;
 
   static const int nstress = 6 ;
@@ -787,99 +626,165 @@ void  BbarBrick::formResidAndTangent( int tang_flag )
 
   static const int numberGauss = 8 ;
 
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
-  int jj, kk ;
+  int i, j, p ;
 
   int success ;
 
-  static double volume ;
+  double strainData[nstress] ;
+  Vector strain( strainData, nstress ) ;  //strain
+
+  //nodal displacements
+  double ulData[ndf*numberNodes] ;
+  Vector ul( ulData, ndf*numberNodes ) ;
 
-  static double xsj ;  // determinant jacaobian matrix
+  //Bbar matrix of all the nodes
+  double Bdata[nstress*ndf*numberNodes] ;
+  Matrix B( Bdata, nstress, ndf*numberNodes ) ;
+  B.Zero( ) ;
 
-  static double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  //zero stiffness and residual
+  stiff.Zero( ) ;
+  resid.Zero( ) ;
+
+  //shape functions at the gauss points and their mean values
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
-  static Vector strain(nstress) ;  //strain
+  const double (*shpBar)[numberNodes] =
+    reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(numberGauss) ) ;
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  for ( j = 0; j < numberNodes; j++ ) {
+    const Vector &disp = nodePointers[j]->getTrialDisp( ) ;
+    for ( p = 0; p < ndf; p++ )
+      ul( j*ndf + p ) = disp(p) ;
+  }
+
+
+  //gauss loop
+  for ( i = 0; i < numberGauss; i++ ) {
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+    const double (*shp)[numberNodes] =
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+    double dvol = shapes->getWeight(i) ;
 
-  static Vector residJ(ndf) ; //nodeJ residual
+    computeBbar( shp, shpBar, B ) ;
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+    //compute the strain
+    //strain = (B*ul) ;
+    strain.addMatrixVector(0.0,  B,ul,1.0 ) ;
 
-  static Vector stress(nstress) ;  //stress
+    //send the strain to the material
+    success = materialPointers[i]->setTrialStrain( strain ) ;
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+    //compute the stress
+    const Vector &stress = materialPointers[i]->getStress( ) ;
 
 
-  //---------B-matrices------------------------------------
+    //residual
+    //resid += B' * stress * dvol ;
+    resid.addMatrixTransposeVector(1.0,  B,stress,dvol) ;
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    for ( j = 0; j < numberNodes; j++ ) {
+      for ( p = 0; p < ndf; p++ ) {
+	if (applyLoad == 0) {
+	  resid( j*ndf + p ) -= dvol*b[p]*shp[3][j];
+	} else {
+	  resid( j*ndf + p ) -= dvol*appliedB[p]*shp[3][j];
+	}
+      }
+    } // end for j
 
-    static Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    if ( tang_flag == 1 ) {
 
-    static Matrix BJtranD(ndf,nstress) ;
+      //stiff += B' * dd * B * dvol
+      const Matrix &dd = materialPointers[i]->getTangent( ) ;
+      stiff.addMatrixTripleProduct( 1.0, B, dd, dvol ) ;
 
-  //-------------------------------------------------------
+    } // end if tang_flag
 
 
-  //zero stiffness and residual
-  stiff.Zero( ) ;
-  resid.Zero( ) ;
+  } //end for i gauss loop
+
+
+  return ;
+}
+
+
+//************************************************************************
+//shape functions at the gauss points, followed by their mean values over
+//the element with the volume as weight
+
+ShapeFunctionCache *
+BbarBrick::getShapes( )
+{
+  if (theShapes != 0) {
+    if (shapesStamp == Node::getCrdsStamp())
+      return theShapes ;
+
+    //a node may have been moved without setDomain(), e.g. by
+    //setNodeCoord, look the cache up again for the new shape
+    ShapeFunctionCache::releaseCache(theShapes) ;
+    theShapes = 0 ;
+  }
+
+  static const int numberNodes = 8 ;
+  static const int numberGauss = 8 ;
+  static const int nShape = 4 ;
+
+  shapesStamp = Node::getCrdsStamp( ) ;
+  theShapes = ShapeFunctionCache::getCache( ELE_TAG_BbarBrick, nodePointers,
+					    numberNodes, numberGauss+1, nShape ) ;
+
+  if ( theShapes->isFormed( ) )
+    return theShapes ;
 
   //compute basis vectors and local nodal coordinates
   computeBasis( ) ;
 
+  double gaussPoint[3] ;
+  double xsj ;  // determinant jacaobian matrix
+
+  double (*shpBar)[numberNodes] =
+    reinterpret_cast<double (*)[numberNodes]>( theShapes->getShape(numberGauss) ) ;
 
   //zero mean shape functions
+  int p, q ;
   for ( p = 0; p < nShape; p++ ) {
     for ( q = 0; q < numberNodes; q++ )
       shpBar[p][q] = 0.0 ;
   } // end for p
 
   //zero volume
-  volume = 0.0 ;
+  double volume = 0.0 ;
 
-
-  //gauss loop to compute and save shape functions
   int count = 0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
+  for ( int i = 0; i < 2; i++ ) {
+    for ( int j = 0; j < 2; j++ ) {
+      for ( int k = 0; k < 2; k++ ) {
 
         gaussPoint[0] = sg[i] ;
 	gaussPoint[1] = sg[j] ;
 	gaussPoint[2] = sg[k] ;
 
+	double (*shp)[numberNodes] =
+	  reinterpret_cast<double (*)[numberNodes]>( theShapes->getShape(count) ) ;
+
 	//get shape functions
 	shp3d( gaussPoint, xsj, shp, xl ) ;
 
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
 	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;
+	double dvol = wg[count] * xsj ;
+	theShapes->getWeight(count) = dvol ;
 
         //add to volume
-	volume += dvol[count] ;
+	volume += dvol ;
 
 	//add to mean shape functions
 	for ( p = 0; p < nShape; p++ ) {
 	  for ( q = 0; q < numberNodes; q++ )
-	    shpBar[p][q] += ( dvol[count] * shp[p][q] ) ;
+	    shpBar[p][q] += ( dvol * shp[p][q] ) ;
 	} // end for p
 
 	count++ ;
@@ -895,116 +800,11 @@ void  BbarBrick::formResidAndTangent( int tang_flag )
       shpBar[p][q] /= volume ;
   } // end for p
 
+  theShapes->getWeight(numberGauss) = volume ;
 
-  //gauss loop
-  for ( i = 0; i < numberGauss; i++ ) {
-
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
-
-
-    //zero the strains
-    strain.Zero( ) ;
-
-
-    // j-node loop to compute strain
-    for ( j = 0; j < numberNodes; j++ )  {
+  theShapes->setFormed( ) ;
 
-      //compute B matrix
-
-      BJ = computeBbar( j, shp, shpBar ) ;
-
-      //nodal displacements
-      const Vector &ul = nodePointers[j]->getTrialDisp( ) ;
-
-      //compute the strain
-      //strain += (BJ*ul) ;
-      strain.addMatrixVector(1.0,  BJ,ul,1.0 ) ;
-
-    } // end for j
-
-
-
-    //send the strain to the material
-    success = materialPointers[i]->setTrialStrain( strain ) ;
-
-    //compute the stress
-    stress = materialPointers[i]->getStress( ) ;
-
-
-    //multiply by volume element
-    stress  *= dvol[i] ;
-
-    if ( tang_flag == 1 ) {
-      dd = materialPointers[i]->getTangent( ) ;
-      dd *= dvol[i] ;
-    } //end if tang_flag
-
-
-    //residual and tangent calculations node loops
-
-    jj = 0 ;
-    for ( j = 0; j < numberNodes; j++ ) {
-
-      BJ = computeBbar( j, shp, shpBar ) ;
-
-      //transpose
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) {
-	for (q=0; q<nstress; q++)
-	  BJtran(p,q) = BJ(q,p) ;
-      }//end for p
-
-
-      //residual
-      //residJ = BJtran * stress ;
-      residJ.addMatrixVector(0.0,  BJtran,stress,1.0);
-
-      //residual
-      for ( p = 0; p < ndf; p++ ) {
-        resid( jj + p ) += residJ(p)  ;
-	if (applyLoad == 0) {
-	  resid( jj + p ) -= dvol[i]*b[p]*shp[3][j];
-	} else {
-	  resid( jj + p ) -= dvol[i]*appliedB[p]*shp[3][j];
-	}
-      }
-      
-      if ( tang_flag == 1 ) {
-
-	//BJtranD = BJtran * dd ;
-	BJtranD.addMatrixProduct(0.0,  BJtran,dd,1.0);
-
-         kk = 0 ;
-         for ( k = 0; k < numberNodes; k++ ) {
-
-            BK = computeBbar( k, shp, shpBar ) ;
-
-
-            //stiffJK =  BJtranD * BK  ;
-	    stiffJK.addMatrixProduct(0.0,  BJtranD,BK,1.0) ;
-
-            for ( p = 0; p < ndf; p++ )  {
-               for ( q = 0; q < ndf; q++ )
-                  stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-            } //end for p
-
-            kk += ndf ;
-          } // end for k loop
-
-      } // end if tang_flag
-
-      jj += ndf ;
-    } // end for j loop
-
-
-  } //end for i gauss loop
-
-
-  return ;
+  return theShapes ;
 }
 
 
@@ -1032,20 +832,12 @@ void   BbarBrick::computeBasis( )
 //*************************************************************************
 //compute B
 
-const Matrix&
-BbarBrick::computeBbar( int node,
-				 const double shp[4][8],
-				 const double shpBar[4][8] )
+void
+BbarBrick::computeBbar( const double shp[4][8],
+			const double shpBar[4][8],
+			Matrix &Bbar )
 {
 
-  static Matrix Bbar(6,3) ;
-
-  //static Matrix Bdev(3,3) ;
-  static double Bdev[3][3] ;
-
-  //static Matrix BbarVol(3,3) ;
-  static double BbarVol[3][3] ;
-
   static const double one3 = 1.0/3.0 ;
 
 
@@ -1067,63 +859,50 @@ BbarBrick::computeBbar( int node,
 //               |                     |
 //               |    Bdev + Bvol      |
 //   B       =   |                     |
-//               |---------------------|   (6x3)
+//               |---------------------|   (6x3) for each node
 //               | N,2     N,1     0   |
 //               |   0     N,3    N,2  |
 //               | N,3      0     N,1  |
 //                -                   -
 //
+// only the nonzero terms are set, Bbar is zeroed by the caller
 //---------------------------------------------------------------
 
+  for ( int node = 0, col = 0; node < 8; node++, col += 3 ) {
 
-  Bbar.Zero( ) ;
-
-  //deviatoric
-  Bdev[0][0] = 2.0*shp[0][node] ;
-  Bdev[0][1] =    -shp[1][node] ;
-  Bdev[0][2] =    -shp[2][node] ;
-
-  Bdev[1][0] =    -shp[0][node] ;
-  Bdev[1][1] = 2.0*shp[1][node] ;
-  Bdev[1][2] =    -shp[2][node] ;
+    //deviatoric
+    double Bdev[3][3] ;
 
-  Bdev[2][0] =    -shp[0][node] ;
-  Bdev[2][1] =    -shp[1][node] ;
-  Bdev[2][2] = 2.0*shp[2][node] ;
+    Bdev[0][0] = 2.0*shp[0][node] ;
+    Bdev[0][1] =    -shp[1][node] ;
+    Bdev[0][2] =    -shp[2][node] ;
 
-  //volumetric
-  BbarVol[0][0] = shpBar[0][node] ;
-  BbarVol[0][1] = shpBar[1][node] ;
-  BbarVol[0][2] = shpBar[2][node] ;
+    Bdev[1][0] =    -shp[0][node] ;
+    Bdev[1][1] = 2.0*shp[1][node] ;
+    Bdev[1][2] =    -shp[2][node] ;
 
-  BbarVol[1][0] = shpBar[0][node] ;
-  BbarVol[1][1] = shpBar[1][node] ;
-  BbarVol[1][2] = shpBar[2][node] ;
+    Bdev[2][0] =    -shp[0][node] ;
+    Bdev[2][1] =    -shp[1][node] ;
+    Bdev[2][2] = 2.0*shp[2][node] ;
 
-  BbarVol[2][0] = shpBar[0][node] ;
-  BbarVol[2][1] = shpBar[1][node] ;
-  BbarVol[2][2] = shpBar[2][node] ;
+    //extensional terms, volumetric part the same on each row
+    for ( int i=0; i<3; i++ ){
+      for ( int j=0; j<3; j++ )
+	Bbar(i,col+j) = one3*( Bdev[i][j] + shpBar[j][node] ) ;
+    }//end for i
 
 
+    //shear terms
+    Bbar(3,col  ) = shp[1][node] ;
+    Bbar(3,col+1) = shp[0][node] ;
 
-  //extensional terms
-  for ( int i=0; i<3; i++ ){
-    for ( int j=0; j<3; j++ )
-      Bbar(i,j) = one3*( Bdev[i][j] + BbarVol[i][j] ) ;
-  }//end for i
+    Bbar(4,col+1) = shp[2][node] ;
+    Bbar(4,col+2) = shp[1][node] ;
 
+    Bbar(5,col  ) = shp[2][node] ;
+    Bbar(5,col+2) = shp[0][node] ;
 
-  //shear terms
-  Bbar(3,0) = shp[1][node] ;
-  Bbar(3,1) = shp[0][node] ;
-
-  Bbar(4,1) = shp[2][node] ;
-  Bbar(4,2) = shp[1][node] ;
-
-  Bbar(5,0) = shp[2][node] ;
-  Bbar(5,2) = shp[0][node] ;
-
-  return Bbar ;
+  }
 
 }
 
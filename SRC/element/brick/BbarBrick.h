@@ -38,6 +38,8 @@
 #include <Node.h>
 #include <NDMaterial.h>
 
+class ShapeFunctionCache;
+
 class BbarBrick : public Element {
 
   public :
@@ -158,16 +160,22 @@ class BbarBrick : public Element {
     //compute coordinate system
     void computeBasis( ) ;
 
-    //compute Bbar matrix
-    const Matrix& computeBbar( int node, 
-			       const double shp[4][8], 
-			       const double shpBar[4][8] ) ;
+    //shape functions at the gauss points, formed on first use
+    ShapeFunctionCache *getShapes( ) ;
+
+    //compute Bbar matrix of all the nodes
+    void computeBbar( const double shp[4][8], 
+		      const double shpBar[4][8],
+		      Matrix &Bbar ) ;
   
     //Matrix transpose
     Matrix transpose( int dim1, int dim2, const Matrix &M ) ;
 
     Vector *load;
     Matrix *Ki;
+
+    ShapeFunctionCache *theShapes; // shape functions at the gauss points
+    int shapesStamp;               // Node::getCrdsStamp() theShapes was got at
 } ; 
 
 
@@ -40,6 +40,8 @@
 #include <ErrorHandler.h>
 #include <Brick.h>
 #include <shp3d.h>
+#include <ShapeFunctionCache.h>
+#include <MemoryReport.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
 #include <Parameter.h>
@@ -124,16 +126,12 @@ const double  Brick::sg[] = { -one_over_root3,
 const double  Brick::wg[] = { 1.0, 1.0, 1.0, 1.0, 
                               1.0, 1.0, 1.0, 1.0  } ;
 
-  
-static Matrix B(6,3) ;
 
 //null constructor
 Brick::Brick( ) 
 :Element( 0, ELE_TAG_Brick ),
- connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+ connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), theShapes(0), shapesStamp(0)
 {
-  B.Zero();
-
   for (int i=0; i<8; i++ ) {
     materialPointers[i] = 0;
     nodePointers[i] = 0;
@@ -163,10 +161,8 @@ Brick::Brick(int tag,
 	     double b1, double b2, double b3,
        Damping *damping)
   :Element(tag, ELE_TAG_Brick),
-   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), theShapes(0), shapesStamp(0)
 {
-  B.Zero();
-
   connectedExternalNodes(0) = node1 ;
   connectedExternalNodes(1) = node2 ;
   connectedExternalNodes(2) = node3 ;
@@ -225,6 +221,8 @@ Brick::~Brick( )
   if (Ki != 0)
     delete Ki;
 
+  ShapeFunctionCache::releaseCache(theShapes);
+
   for (int i = 0; i < 8; i++)
   {
     if (theDamping[i])
@@ -247,6 +245,15 @@ void  Brick::setDomain( Domain *theDomain )
   for ( i=0; i<8; i++ ) 
      nodePointers[i] = theDomain->getNode( connectedExternalNodes(i) ) ;
 
+  //the nodes or their coordinates may have changed
+  ShapeFunctionCache::releaseCache(theShapes);
+  theShapes = 0;
+
+  //form the shared shape functions here, as the pool of caches is not
+  //safe to use from elements updated on threads
+  for ( i=0; i<8 && nodePointers[i] != 0; i++ ) ;
+  if ( i == 8 )
+    getShapes( ) ;
     
   for (int i = 0; i < 8; i++)
   {
@@ -477,132 +484,36 @@ const Matrix&  Brick::getInitialStiff( )
     return *Ki;
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
-  static const int ndm = 3 ;
-  static const int ndf = 3 ; 
   static const int nstress = 6 ;
   static const int numberNodes = 8 ;
   static const int numberGauss = 8 ;
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
-  int jj, kk ;
-
-  
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-  static Matrix dd(nstress,nstress) ;  //material tangent
-
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+  //B matrix of all the nodes
+  double Bdata[nstress*3*numberNodes] ;
+  Matrix B( Bdata, nstress, 3*numberNodes ) ;
+  B.Zero( ) ;
 
-  //-------------------------------------------------------
-
-  
   //zero stiffness and residual 
   stiff.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop 
-  for ( i = 0; i < numberGauss; i++ ) {
+  for ( int i = 0; i < numberGauss; i++ ) {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
+    const double (*shp)[numberNodes] = 
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
+    double dvol = shapes->getWeight(i) ;
+    if (theDamping[i]) dvol *= theDamping[i]->getStiffnessMultiplier();
 
-    dd = materialPointers[i]->getInitialTangent( ) ;
-    if(theDamping[i]) dd *= theDamping[i]->getStiffnessMultiplier();
-    dd *= dvol[i] ;
-    
-    jj = 0;
-    for ( j = 0; j < numberNodes; j++ ) {
+    computeB( shp, B ) ;
 
-      BJ = computeB( j, shp ) ;
-   
-      //transpose 
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) {
-	for (q=0; q<nstress; q++) 
-	  BJtran(p,q) = BJ(q,p) ;
-      }//end for p
-
-      //BJtranD = BJtran * dd ;
-      BJtranD.addMatrixProduct(0.0,  BJtran, dd, 1.0) ;
-      
-      kk = 0 ;
-      for ( k = 0; k < numberNodes; k++ ) {
-	
-	BK = computeB( k, shp ) ;
-	
-	
-	//stiffJK =  BJtranD * BK  ;
-	stiffJK.addMatrixProduct(0.0,  BJtranD, BK, 1.0) ;
-	
-	for ( p = 0; p < ndf; p++ )  {
-	  for ( q = 0; q < ndf; q++ )
-	    stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-	} //end for p
-
-	kk += ndf ;
-
-      } // end for k loop
+    //stiff += B' * dd * B * dvol
+    const Matrix &dd = materialPointers[i]->getInitialTangent( ) ;
+    stiff.addMatrixTripleProduct( 1.0, B, dd, dvol ) ;
 
-      jj += ndf ;
-
-    } // end for j loop
   } //end for i gauss loop 
 
   Ki = new Matrix(stiff);
@@ -753,8 +664,6 @@ const Vector&  Brick::getResistingForceIncInertia( )
 void   Brick::formInertiaTerms( int tangFlag ) 
 {
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ; 
 
   static const int numberNodes = 8 ;
@@ -765,19 +674,9 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   static const int massIndex = nShape - 1 ;
 
-  double xsj ;  // determinant jacaobian matrix 
-
-  double dvol[numberGauss] ; //volume element
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  double momentum[ndf] ;
 
-  static double gaussPoint[ndm] ;
-
-  static Vector momentum(ndf) ;
-
-  int i, j, k, p, q ;
+  int i, j, k, p ;
   int jj, kk ;
 
   double temp, rho, massJK ;
@@ -786,59 +685,26 @@ void   Brick::formInertiaTerms( int tangFlag )
   //zero mass 
   mass.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
-  
-
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
+    const double (*shp)[numberNodes] = 
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
+    double dvol = shapes->getWeight(i) ;
 
     //node loop to compute acceleration
-    momentum.Zero( ) ;
-    for ( j = 0; j < numberNodes; j++ ) 
+    for ( p = 0; p < ndf; p++ )
+      momentum[p] = 0.0 ;
+    for ( j = 0; j < numberNodes; j++ ) {
       //momentum += shp[massIndex][j] * ( nodePointers[j]->getTrialAccel()  ) ; 
-      momentum.addVector( 1.0,
-			  nodePointers[j]->getTrialAccel(),
-			  shp[massIndex][j] ) ;
+      const Vector &accel = nodePointers[j]->getTrialAccel() ;
+      for ( p = 0; p < ndf; p++ )
+	momentum[p] += shp[massIndex][j] * accel(p) ;
+    }
 
 
     //density
@@ -846,17 +712,18 @@ void   Brick::formInertiaTerms( int tangFlag )
 
 
     //multiply acceleration by density to form momentum
-    momentum *= rho ;
+    for ( p = 0; p < ndf; p++ )
+      momentum[p] *= rho ;
 
 
     //residual and tangent calculations node loops
     jj = 0 ;
     for ( j = 0; j < numberNodes; j++ ) {
 
-      temp = shp[massIndex][j] * dvol[i] ;
+      temp = shp[massIndex][j] * dvol ;
 
       for ( p = 0; p < ndf; p++ )
-        resid( jj+p ) += ( temp * momentum(p) )  ;
+        resid( jj+p ) += ( temp * momentum[p] )  ;
 
       
       if ( tangFlag == 1 ) {
@@ -894,99 +761,31 @@ Brick::update(void)
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
-  static const int ndf = 3 ; 
-
   static const int nstress = 6 ;
  
   static const int numberNodes = 8 ;
 
   static const int numberGauss = 8 ;
 
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
+  int i, j ;
   int success ;
   
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
-  static Vector strain(nstress) ;  //strain
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
-  
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
+  double strainData[nstress] ;
+  Vector strain( strainData, nstress ) ;  //strain
 
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
-
+    const double (*shp)[numberNodes] = 
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
     //zero the strains
     strain.Zero( ) ;
 
+
     // j-node loop to compute strain 
     for ( j = 0; j < numberNodes; j++ )  {
 
@@ -1061,8 +860,6 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ; 
 
   static const int nstress = 6 ;
@@ -1071,127 +868,54 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   static const int numberGauss = 8 ;
 
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
-
-
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static Vector residJ(ndf) ; //nodeJ residual 
-
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  int i, j, p ;
 
-  static Vector stress(nstress) ;  //stress
+  double residJ[ndf] ; //nodeJ residual 
 
-  static Vector dampingStress(nstress) ;  //damping stress
-
-  static Matrix dd(nstress,nstress) ;  //material tangent
-
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
+  //B matrix of all the nodes
+  double Bdata[nstress*ndf*numberNodes] ;
+  Matrix B( Bdata, nstress, ndf*numberNodes ) ;
+  if ( tang_flag == 1 )
+    B.Zero( ) ;
 
   
   //zero stiffness and residual 
   stiff.Zero( ) ;
   resid.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
+    const double (*shp)[numberNodes] = 
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
+    double dvol = shapes->getWeight(i) ;
 
     //compute the stress
-    stress = materialPointers[i]->getStress( ) ;
+    const Vector &stress = materialPointers[i]->getStress( ) ;
 
+    //damping stress
+    double dampingStress[nstress] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 } ;
     if (theDamping[i])
     {
       theDamping[i]->update(stress);
-      dampingStress = theDamping[i]->getDampingForce();
-      dampingStress *= dvol[i];
+      const Vector &force = theDamping[i]->getDampingForce();
+      for ( p = 0; p < nstress; p++ )
+	dampingStress[p] = force(p) * dvol ;
     }
 
     //multiply by volume element
-    stress  *= dvol[i] ;
-
-    if ( tang_flag == 1 ) {
-      dd = materialPointers[i]->getTangent( ) ;
-      if(theDamping[i]) dd *= theDamping[i]->getStiffnessMultiplier();
-      dd *= dvol[i] ;
-    } //end if tang_flag
-
+    double stress0 = stress(0) * dvol ;
+    double stress1 = stress(1) * dvol ;
+    double stress2 = stress(2) * dvol ;
+    double stress3 = stress(3) * dvol ;
+    double stress4 = stress(4) * dvol ;
+    double stress5 = stress(5) * dvol ;
 
-    double stress0 = stress(0);
-    double stress1 = stress(1);
-    double stress2 = stress(2);
-    double stress3 = stress(3);
-    double stress4 = stress(4);
-    double stress5 = stress(5);
-
-    //residual and tangent calculations node loops
+    //residual calculations node loop
 
     int jj = 0 ;
     for ( j = 0; j < numberNodes; j++ ) {
@@ -1206,16 +930,6 @@ void  Brick::formResidAndTangent( int tang_flag )
       //               |   0     N,3    N,2  |
       //               | N,3      0     N,1  |
 
-      //      B(0,0) = shp[0][node] ;
-      //      B(1,1) = shp[1][node] ;
-      //      B(2,2) = shp[2][node] ;
-      //      B(3,0) = shp[1][node] ;
-      //      B(3,1) = shp[0][node] ;
-      //      B(4,1) = shp[2][node] ;
-      //      B(4,2) = shp[1][node] ;
-      //      B(5,0) = shp[2][node] ;
-      //      B(5,2) = shp[0][node] ;
-
       double b00 = shp[0][j];
       double b11 = shp[1][j];
       double b22 = shp[2][j];
@@ -1226,65 +940,105 @@ void  Brick::formResidAndTangent( int tang_flag )
       double b50 = shp[2][j];
       double b52 = shp[0][j];
 
-      residJ(0) = b00 * stress0 + b30 * stress3 + b50 * stress5;
-      residJ(1) = b11 * stress1 + b31 * stress3 + b41 * stress4;
-      residJ(2) = b22 * stress2 + b42 * stress4 + b52 * stress5;
-
-      residJ(0) += b00 * dampingStress[0] + b30 * dampingStress[3] + b50 * dampingStress[5];
-      residJ(1) += b11 * dampingStress[1] + b31 * dampingStress[3] + b41 * dampingStress[4];
-      residJ(2) += b22 * dampingStress[2] + b42 * dampingStress[4] + b52 * dampingStress[5];
-      
-      BJ = computeB( j, shp ) ;
-   
-      //transpose 
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) {
-	for (q=0; q<nstress; q++) 
-	  BJtran(p,q) = BJ(q,p) ;
-      }//end for p
+      residJ[0] = b00 * stress0 + b30 * stress3 + b50 * stress5;
+      residJ[1] = b11 * stress1 + b31 * stress3 + b41 * stress4;
+      residJ[2] = b22 * stress2 + b42 * stress4 + b52 * stress5;
 
+      residJ[0] += b00 * dampingStress[0] + b30 * dampingStress[3] + b50 * dampingStress[5];
+      residJ[1] += b11 * dampingStress[1] + b31 * dampingStress[3] + b41 * dampingStress[4];
+      residJ[2] += b22 * dampingStress[2] + b42 * dampingStress[4] + b52 * dampingStress[5];
 
       //residual 
       for ( p = 0; p < ndf; p++ ) {
-        resid( jj + p ) += residJ(p)  ;
+        resid( jj + p ) += residJ[p]  ;
 	if (applyLoad == 0)
-	  resid( jj + p ) -= dvol[i]*b[p]*shp[3][j];
+	  resid( jj + p ) -= dvol*b[p]*shp[3][j];
 	else
-	  resid( jj + p ) -= dvol[i]*appliedB[p]*shp[3][j];
+	  resid( jj + p ) -= dvol*appliedB[p]*shp[3][j];
       }
 
-      if ( tang_flag == 1 ) {
+      jj += ndf ;
+    } // end for j loop
 
-	//BJtranD = BJtran * dd ;
-	BJtranD.addMatrixProduct(0.0,  BJtran,dd,1.0) ;
+    if ( tang_flag == 1 ) {
 
-	int kk = 0 ;
-         for ( k = 0; k < numberNodes; k++ ) {
+      double fact = dvol ;
+      if(theDamping[i]) fact *= theDamping[i]->getStiffnessMultiplier();
+
+      computeB( shp, B ) ;
+
+      //stiff += B' * dd * B * dvol
+      const Matrix &dd = materialPointers[i]->getTangent( ) ;
+      stiff.addMatrixTripleProduct( 1.0, B, dd, fact ) ;
+
+    } // end if tang_flag 
+
+  } //end for i gauss loop 
 
-            BK = computeB( k, shp ) ;
   
- 
-            //stiffJK =  BJtranD * BK  ;
-	    stiffJK.addMatrixProduct(0.0,  BJtranD,BK,1.0) ;
+  return ;
+}
 
-            for ( p = 0; p < ndf; p++ )  {
-               for ( q = 0; q < ndf; q++ )
-                  stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-            } //end for p
 
-            kk += ndf ;
-          } // end for k loop
+//************************************************************************
+//shape functions at the gauss points
 
-      } // end if tang_flag 
+ShapeFunctionCache *
+Brick::getShapes( )
+{
+  if (theShapes != 0) {
+    if (shapesStamp == Node::getCrdsStamp())
+      return theShapes ;
+
+    //a node may have been moved without setDomain(), e.g. by
+    //setNodeCoord, look the cache up again for the new shape
+    ShapeFunctionCache::releaseCache(theShapes) ;
+    theShapes = 0 ;
+  }
 
-      jj += ndf ;
-    } // end for j loop
+  static const int numberNodes = 8 ;
+  static const int numberGauss = 8 ;
+  static const int nShape = 4 ;
 
+  shapesStamp = Node::getCrdsStamp( ) ;
+  theShapes = ShapeFunctionCache::getCache( ELE_TAG_Brick, nodePointers, 
+					    numberNodes, numberGauss, nShape ) ;
 
-  } //end for i gauss loop 
+  if ( theShapes->isFormed( ) )
+    return theShapes ;
 
-  
-  return ;
+  //compute basis vectors and local nodal coordinates
+  computeBasis( ) ;
+
+  double gaussPoint[3] ;
+  double xsj ;  // determinant jacaobian matrix 
+
+  int count = 0 ;
+  for ( int i = 0; i < 2; i++ ) {
+    for ( int j = 0; j < 2; j++ ) {
+      for ( int k = 0; k < 2; k++ ) {
+
+        gaussPoint[0] = sg[i] ;        
+	gaussPoint[1] = sg[j] ;        
+	gaussPoint[2] = sg[k] ;
+
+	//get shape functions    
+	shp3d( gaussPoint, xsj, 
+	       reinterpret_cast<double (*)[numberNodes]>( theShapes->getShape(count) ), 
+	       xl ) ;
+
+	//volume element to also be saved
+	theShapes->getWeight(count) = wg[count] * xsj ;  
+
+	count++ ;
+
+      } //end for k
+    } //end for j
+  } // end for i 
+
+  theShapes->setFormed( ) ;
+
+  return theShapes ;
 }
 
 
@@ -1312,8 +1066,8 @@ void   Brick::computeBasis( )
 //*************************************************************************
 //compute B
 
-const Matrix&   
-Brick::computeB( int node, const double shp[4][8] )
+void
+Brick::computeB( const double shp[4][8], Matrix &B )
 {
 
 //---B Matrix in standard {1,2,3} mechanics notation---------
@@ -1321,28 +1075,31 @@ Brick::computeB( int node, const double shp[4][8] )
 //                -                   -
 //               | N,1      0     0    | 
 //   B       =   |   0     N,2    0    |
-//               |   0      0     N,3  |   (6x3)
+//               |   0      0     N,3  |   (6x3) for each node
 //               | N,2     N,1     0   |
 //               |   0     N,3    N,2  |
 //               | N,3      0     N,1  |
 //                -                   -       
 //
+// only the nonzero terms are set, B is zeroed by the caller
 //-------------------------------------------------------------------
 
-  B(0,0) = shp[0][node] ;
-  B(1,1) = shp[1][node] ;
-  B(2,2) = shp[2][node] ;
+  for ( int node = 0, col = 0; node < 8; node++, col += 3 ) {
 
-  B(3,0) = shp[1][node] ;
-  B(3,1) = shp[0][node] ;
+    B(0,col  ) = shp[0][node] ;
+    B(1,col+1) = shp[1][node] ;
+    B(2,col+2) = shp[2][node] ;
 
-  B(4,1) = shp[2][node] ;
-  B(4,2) = shp[1][node] ;
+    B(3,col  ) = shp[1][node] ;
+    B(3,col+1) = shp[0][node] ;
 
-  B(5,0) = shp[2][node] ;
-  B(5,2) = shp[0][node] ;
+    B(4,col+1) = shp[2][node] ;
+    B(4,col+2) = shp[1][node] ;
 
-  return B ;
+    B(5,col  ) = shp[2][node] ;
+    B(5,col+2) = shp[0][node] ;
+
+  }
 
 }
 
@@ -1605,6 +1362,20 @@ int  Brick::recvSelf (int commitTag,
 }
 //**************************************************************************
 
+void
+Brick::reportMemory(MemoryReport &theReport)
+{
+  // the shape functions are shared, they are reported with the domain
+  double bytes = sizeof(Brick) + this->getBaseMemory()
+    + MemoryReport::getBytes(load) + MemoryReport::getBytes(Ki);
+  theReport.add("element", "Brick", bytes);
+
+  for (int i = 0; i < 8; i++)
+    materialPointers[i]->reportMemory(theReport);
+}
+
+//**************************************************************************
+
 int
 Brick::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
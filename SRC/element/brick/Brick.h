@@ -43,6 +43,8 @@
 #include <NDMaterial.h>
 #include <Damping.h>
 
+class ShapeFunctionCache;
+
 
 class Brick : public Element {
 
@@ -98,6 +100,7 @@ class Brick : public Element {
 
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
+    void reportMemory(MemoryReport &theReport);
 	
     //return stiffness matrix 
     const Matrix &getTangentStiff();
@@ -147,6 +150,9 @@ class Brick : public Element {
     Vector *load;
     Matrix *Ki;
 
+    ShapeFunctionCache *theShapes; // shape functions at the gauss points
+    int shapesStamp;               // Node::getCrdsStamp() theShapes was got at
+
     //
     // static attributes
     //
@@ -178,8 +184,11 @@ class Brick : public Element {
     //compute coordinate system
     void computeBasis( ) ;
 
-    //compute B matrix
-    const Matrix& computeB( int node, const double shp[4][8] ) ;
+    //shape functions at the gauss points, formed on first use
+    ShapeFunctionCache *getShapes( ) ;
+
+    //compute B matrix of all the nodes
+    void computeB( const double shp[4][8], Matrix &B ) ;
   
     //Matrix transpose
     Matrix transpose( int dim1, int dim2, const Matrix &M ) ;
@@ -43,6 +43,7 @@
 #include <FEM_ObjectBroker.h>
 #include <ElementResponse.h>
 #include <CompositeResponse.h>
+#include <MemoryReport.h>
 #include <math.h>
 #include <ElementalLoad.h>
 #include <elementAPI.h>
@@ -1470,6 +1471,18 @@ DispBeamColumn2d::Print(OPS_Stream &s, int flag)
 }
 
 
+void
+DispBeamColumn2d::reportMemory(MemoryReport &theReport)
+{
+  double bytes = sizeof(DispBeamColumn2d) + this->getBaseMemory()
+    + (Q.Size() + q.Size())*sizeof(double)
+    + numSections*sizeof(SectionForceDeformation *);
+  theReport.add("element", "DispBeamColumn2d", bytes);
+
+  for (int i = 0; i < numSections; i++)
+    theSections[i]->reportMemory(theReport);
+}
+
 int
 DispBeamColumn2d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **displayModes, int numModes)
 {
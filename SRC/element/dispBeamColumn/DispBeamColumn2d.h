@@ -94,6 +94,7 @@ class DispBeamColumn2d : public Element
 		  &theBroker);
     int displaySelf(Renderer &theViewer, int displayMode, float fact, const char **displayModes=0, int numModes=0);
     void Print(OPS_Stream &s, int flag =0);
+    void reportMemory(MemoryReport &theReport);
 
     Response *setResponse(const char **argv, int argc, OPS_Stream &s);
     int getResponse(int responseID, Information &eleInfo);
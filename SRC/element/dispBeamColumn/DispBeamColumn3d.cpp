@@ -42,6 +42,7 @@
 #include <FEM_ObjectBroker.h>
 #include <ElementResponse.h>
 #include <CompositeResponse.h>
+#include <MemoryReport.h>
 #include <ElementalLoad.h>
 #include <BeamIntegration.h>
 #include <Parameter.h>
@@ -1555,6 +1556,18 @@ DispBeamColumn3d::Print(OPS_Stream &s, int flag)
 }
 
 
+void
+DispBeamColumn3d::reportMemory(MemoryReport &theReport)
+{
+  double bytes = sizeof(DispBeamColumn3d) + this->getBaseMemory()
+    + (Q.Size() + q.Size())*sizeof(double)
+    + numSections*sizeof(SectionForceDeformation *);
+  theReport.add("element", "DispBeamColumn3d", bytes);
+
+  for (int i = 0; i < numSections; i++)
+    theSections[i]->reportMemory(theReport);
+}
+
 int
 DispBeamColumn3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numModes)
 {
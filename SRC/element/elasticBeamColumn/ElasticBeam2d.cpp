@@ -586,6 +586,9 @@ ElasticBeam2d::setDomain(Domain *theDomain)
     }
 	
     this->DomainComponent::setDomain(theDomain);
+
+    // the nodes may have moved, e.g. on Node::setCrds()
+    this->clearMatrixCache();
     
     if (theCoordTransf->initialize(theNodes[0], theNodes[1]) != 0) {
 	opserr << "ElasticBeam2d::setDomain -- Error initializing coordinate transformation\n";
@@ -664,6 +667,19 @@ ElasticBeam2d::update(void)
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam2d::isReentrant(void)
+{
+  return theCoordTransf->isReentrant();
+}
+
+bool
+ElasticBeam2d::isLinear(void)
+{
+  // a damping object scales the stiffness with the state
+  return theCoordTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf2d && theDamping == 0;
+}
+
 const Matrix &
 ElasticBeam2d::getTangentStiff(void)
 {
@@ -1642,6 +1658,8 @@ ElasticBeam2d::setParameter(const char **argv, int argc, Parameter &param)
 int
 ElasticBeam2d::updateParameter (int parameterID, Information &info)
 {
+	this->clearMatrixCache();
+
 	switch (parameterID) {
 	case -1:
 		return -1;
@@ -77,6 +77,8 @@ class ElasticBeam2d : public Element
     int revertToStart(void);
     
     int update(void);
+    bool isReentrant(void);
+    bool isLinear(void);
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);    
@@ -580,6 +580,9 @@ ElasticBeam3d::setDomain(Domain *theDomain)
     }
 	
     this->DomainComponent::setDomain(theDomain);
+
+    // the nodes may have moved, e.g. on Node::setCrds()
+    this->clearMatrixCache();
     
     if (theCoordTransf->initialize(theNodes[0], theNodes[1]) != 0) {
 	opserr << "ElasticBeam3d::setDomain  tag: " << this->getTag() << " -- Error initializing coordinate transformation\n";
@@ -658,6 +661,19 @@ ElasticBeam3d::update(void)
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam3d::isReentrant(void)
+{
+  return theCoordTransf->isReentrant();
+}
+
+bool
+ElasticBeam3d::isLinear(void)
+{
+  // a damping object scales the stiffness with the state
+  return theCoordTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf3d && theDamping == 0;
+}
+
 const Matrix &
 ElasticBeam3d::getTangentStiff(void)
 {
@@ -1875,6 +1891,8 @@ ElasticBeam3d::setParameter(const char **argv, int argc, Parameter &param)
 int
 ElasticBeam3d::updateParameter (int parameterID, Information &info)
 {
+	this->clearMatrixCache();
+
 	switch (parameterID) {
 	case -1:
 		return -1;
@@ -78,6 +78,8 @@ class ElasticBeam3d : public Element
     int revertToStart(void);
     
     int update(void);
+    bool isReentrant(void);
+    bool isLinear(void);
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);    
@@ -419,6 +419,9 @@ void ElasticTimoshenkoBeam2d::setDomain(Domain *theDomain)
     
     // call the base class method
     this->DomainComponent::setDomain(theDomain);
+
+    // the nodes may have moved, e.g. on Node::setCrds()
+    this->clearMatrixCache();
     
     // initialize the coordinate transformation
     if (theCoordTransf->initialize(theNodes[0], theNodes[1]) != 0)  {
@@ -465,6 +468,12 @@ int ElasticTimoshenkoBeam2d::update()
 }
 
 
+bool ElasticTimoshenkoBeam2d::isLinear()
+{
+    return nlGeo == 0;
+}
+
+
 const Matrix& ElasticTimoshenkoBeam2d::getTangentStiff()
 {
     // zero the matrix
@@ -949,6 +958,7 @@ int ElasticTimoshenkoBeam2d::updateParameter (int parameterID,
 
     // Re-calculate matrices
     this->setUp();
+    this->clearMatrixCache();
 
     return 0;
 }
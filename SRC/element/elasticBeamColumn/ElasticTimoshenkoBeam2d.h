@@ -70,6 +70,7 @@ public:
     int revertToLastCommit();
     int revertToStart();
     int update();
+    bool isLinear();
     
     // public methods to obtain stiffness, mass, damping and residual information
     const Matrix &getTangentStiff();
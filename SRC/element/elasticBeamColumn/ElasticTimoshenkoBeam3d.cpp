@@ -429,6 +429,9 @@ void ElasticTimoshenkoBeam3d::setDomain(Domain *theDomain)
     
     // call the base class method
     this->DomainComponent::setDomain(theDomain);
+
+    // the nodes may have moved, e.g. on Node::setCrds()
+    this->clearMatrixCache();
     
     // initialize the coordinate transformation
     if (theCoordTransf->initialize(theNodes[0], theNodes[1]) != 0)  {
@@ -475,6 +478,12 @@ int ElasticTimoshenkoBeam3d::update()
 }
 
 
+bool ElasticTimoshenkoBeam3d::isLinear()
+{
+    return nlGeo == 0;
+}
+
+
 const Matrix& ElasticTimoshenkoBeam3d::getTangentStiff()
 {
     // zero the matrix
@@ -1016,6 +1025,7 @@ int ElasticTimoshenkoBeam3d::updateParameter (int parameterID,
 
     // Recalculate matrices
     this->setUp();
+    this->clearMatrixCache();
 
     return 0;
 }
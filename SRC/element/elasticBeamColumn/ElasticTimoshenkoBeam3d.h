@@ -69,6 +69,7 @@ public:
     int revertToLastCommit();
     int revertToStart();
     int update();
+    bool isLinear();
     
     // public methods to obtain stiffness, mass, damping and residual information
     const Matrix &getTangentStiff();
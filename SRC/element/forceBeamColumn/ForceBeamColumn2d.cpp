@@ -62,6 +62,7 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <stdlib.h>
 #include <string.h>
 #include <float.h>
+#include <vector>
 
 #include <Information.h>
 #include <Parameter.h>
@@ -77,6 +78,7 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ElementResponse.h>
 #include <CompositeResponse.h>
 #include <ElementalLoad.h>
+#include <MemoryReport.h>
 #include <ElementIter.h>
 #include <map>
 
@@ -1239,14 +1241,16 @@ ForceBeamColumn2d::update()
   // get basic displacements and increments
   const Vector &v = crdTransf->getBasicTrialDisp();    
 
-  static Vector dv(NEBD);
+  double dvData[NEBD];
+  Vector dv(dvData, NEBD);
 
   dv = crdTransf->getBasicIncrDeltaDisp();    
 
   if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
     return 0;
 
-  static Vector vin(NEBD);
+  double vinData[NEBD];
+  Vector vin(vinData, NEBD);
   vin = v;
   vin -= dv;
 
@@ -1258,11 +1262,33 @@ ForceBeamColumn2d::update()
   
   double wt[maxNumSections];
   beamIntegr->getSectionWeights(numSections, L, wt);
+  
+  // total section forces, kept from the first to the last phase of an
+  // iteration
+  double SsStack[maxNumSections*NEBD];
+  std::vector<double> SsHeap;
+  double *SsData = SsStack;
+  int sizeSs = 0;
+  for (int k=0; k<numSections; k++)
+    sizeSs += sections[k]->getOrder();
+  if (sizeSs > maxNumSections*NEBD) {
+    SsHeap.resize(sizeSs);
+    SsData = &SsHeap[0];
+  }
+  Vector SsSubdivide[maxNumSections];
+  for (int k=0, loc=0; k<numSections; k++) {
+    int order = sections[k]->getOrder();
+    SsSubdivide[k].setData(&SsData[loc], order);
+    loc += order;
+  }
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  double vrData[NEBD];
+  Vector vr(vrData, NEBD);      // element residual displacements
+  double fData[NEBD*NEBD];
+  Matrix f(fData, NEBD, NEBD);  // element flexibility matrix
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+  double IData[NEBD*NEBD];
+  Matrix I(IData, NEBD, NEBD);  // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
   
@@ -1272,11 +1298,13 @@ ForceBeamColumn2d::update()
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector dvToDo(NEBD);
-  static Vector dvTrial(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  double dSeData[NEBD], dvToDoData[NEBD], dvTrialData[NEBD], SeTrialData[NEBD];
+  Vector dSe(dSeData, NEBD);
+  Vector dvToDo(dvToDoData, NEBD);
+  Vector dvTrial(dvTrialData, NEBD);
+  Vector SeTrial(SeTrialData, NEBD);
+  double kvTrialData[NEBD*NEBD];
+  Matrix kvTrial(kvTrialData, NEBD, NEBD);
 
   dvToDo = dv;
   dvTrial = dvToDo;
@@ -1328,24 +1356,19 @@ ForceBeamColumn2d::update()
 	  f.Zero();
 	  vr.Zero();
 
+	  // compute the section deformation increments of all the sections
 	  for (i=0; i<numSections; i++) {
 
 	    int order      = sections[i]->getOrder();
 	    const ID &code = sections[i]->getType();
 
-	    static Vector Ss;
-	    static Vector dSs;
-	    static Vector dvs;
-	    static Matrix fb;
-	    
-	    Ss.setData(workArea, order);
-	    dSs.setData(&workArea[order], order);
-	    dvs.setData(&workArea[2*order], order);
-	    fb.setData(&workArea[3*order], order, NEBD);
+	    Vector &Ss = SsSubdivide[i];
+
+	    Vector dSs(workArea, order);
+	    Vector dvs(&workArea[order], order);
 	    
 	    double xL  = xi[i];
 	    double xL1 = xL-1.0;
-	    double wtL = wt[i]*L;
 
 	    // calculate total section forces
 	    // Ss = b*Se + bp*currDistrLoad;
@@ -1410,17 +1433,31 @@ ForceBeamColumn2d::update()
 	    // set section deformations
 	    if (initialFlag != 0)
 	      vsSubdivide[i] += dvs;
+	  }
 
-	    if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
-	      opserr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
-	      return -1;
-	    }
+	  // set the section deformations and get the section resisting
+	  // forces and flexibility matrices of all the sections at once
+	  if (SectionForceDeformation::setTrialSectionDeformations(numSections, sections,
+								   vsSubdivide, SsrSubdivide,
+								   fsSubdivide) < 0) {
+	    opserr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
+	    return -1;
+	  }
+
+	  // integrate the element flexibility and residual deformations
+	  for (i=0; i<numSections; i++) {
 
-	    // get section resisting forces
-	    SsrSubdivide[i] = sections[i]->getStressResultant();
+	    int order      = sections[i]->getOrder();
+	    const ID &code = sections[i]->getType();
 
-	    // get section flexibility matrix
-	    fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	    const Vector &Ss = SsSubdivide[i];
+	    Vector dSs(workArea, order);
+	    Vector dvs(&workArea[order], order);
+	    Matrix fb(&workArea[2*order], order, NEBD);
+	    
+	    double xL  = xi[i];
+	    double xL1 = xL-1.0;
+	    double wtL = wt[i]*L;
 
 	    // calculate section residual deformations
 	    // dvs = fs * (Ss - Ssr);
@@ -1432,7 +1469,7 @@ ForceBeamColumn2d::update()
 	    // integrate element flexibility matrix
 	    // f = f + (b^ fs * b) * wtL;
 	    //f.addMatrixTripleProduct(1.0, b[i], fs[i], wtL);
-	    int jj;
+	    int ii, jj;
 	    const Matrix &fSec = fsSubdivide[i];
 	    fb.Zero();
 	    double tmp;
@@ -2808,6 +2845,27 @@ OPS_Stream &operator<<(OPS_Stream &s, ForceBeamColumn2d &E)
 }
 
 
+void
+ForceBeamColumn2d::reportMemory(MemoryReport &theReport)
+{
+  double bytes = sizeof(ForceBeamColumn2d) + this->getBaseMemory();
+
+  // basic system matrices, section state and element loads
+  bytes += (2*NEBD*NEBD + 2*NEBD + load.Size())*sizeof(double);
+  bytes += sizeEleLoads*(sizeof(ElementalLoad *) + sizeof(double));
+  bytes += MemoryReport::getBytes(Ki);
+  bytes += numSections*sizeof(SectionForceDeformation *);
+  if (fs != 0) {
+    for (int i = 0; i < numSections; i++)
+      bytes += MemoryReport::getBytes(&fs[i]) + MemoryReport::getBytes(&vs[i])
+	+ MemoryReport::getBytes(&Ssr[i]) + MemoryReport::getBytes(&vscommit[i]);
+  }
+  theReport.add("element", "ForceBeamColumn2d", bytes);
+
+  for (int i = 0; i < numSections; i++)
+    sections[i]->reportMemory(theReport);
+}
+
 void
 ForceBeamColumn2d::setSectionPointers(int numSec, SectionForceDeformation **secPtrs)
 {
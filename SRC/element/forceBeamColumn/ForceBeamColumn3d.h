@@ -121,6 +121,7 @@ class ForceBeamColumn3d: public Element
   
   friend OPS_Stream &operator<<(OPS_Stream &s, ForceBeamColumn3d &E);        
   void Print(OPS_Stream &s, int flag =0);    
+  void reportMemory(MemoryReport &theReport);
   
   Response *setResponse(const char **argv, int argc, OPS_Stream &s);
   int getResponse(int responseID, Information &eleInformation);
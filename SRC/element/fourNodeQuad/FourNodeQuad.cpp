@@ -44,6 +44,8 @@
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 #include <elementAPI.h>
+#include <ShapeFunctionCache.h>
+#include <MemoryReport.h>
 
 void* OPS_FourNodeQuad()
 {
@@ -283,7 +285,6 @@ void *OPS_FourNodeQuad(const ID &info) {
 double FourNodeQuad::matrixData[64];
 Matrix FourNodeQuad::K(matrixData, 8, 8);
 Vector FourNodeQuad::P(8);
-double FourNodeQuad::shp[3][4];
 double FourNodeQuad::pts[4][2];
 double FourNodeQuad::wts[4];
 
@@ -293,7 +294,7 @@ FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
          Damping *damping)
 :Element (tag, ELE_TAG_FourNodeQuad), 
   theMaterial(0), connectedExternalNodes(4), 
- Q(8), pressureLoad(8), thickness(t), applyLoad(0), pressure(p), rho(r), Ki(0)
+ Q(8), pressureLoad(8), thickness(t), applyLoad(0), pressure(p), rho(r), theShapes(0), shapesStamp(0), Ki(0)
 {
 	pts[0][0] = -0.5773502691896258;
 	pts[0][1] = -0.5773502691896258;
@@ -370,7 +371,7 @@ FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
 FourNodeQuad::FourNodeQuad()
 :Element (0,ELE_TAG_FourNodeQuad),
   theMaterial(0), connectedExternalNodes(4), 
- Q(8), pressureLoad(8), thickness(0.0), applyLoad(0), pressure(0.0), Ki(0)
+ Q(8), pressureLoad(8), thickness(0.0), applyLoad(0), pressure(0.0), theShapes(0), shapesStamp(0), Ki(0)
 {
   pts[0][0] = -0.577350269189626;
   pts[0][1] = -0.577350269189626;
@@ -415,6 +416,8 @@ FourNodeQuad::~FourNodeQuad()
 
   if (Ki != 0)
     delete Ki;
+
+  ShapeFunctionCache::releaseCache(theShapes);
 }
 
 int
@@ -445,6 +448,10 @@ FourNodeQuad::getNumDOF()
 void
 FourNodeQuad::setDomain(Domain *theDomain)
 {
+    // The nodes or their coordinates may have changed
+    ShapeFunctionCache::releaseCache(theShapes);
+    theShapes = 0;
+
 	// Check Domain is not null - invoked when object removed from a domain
     if (theDomain == 0) {
 	theNodes[0] = 0;
@@ -484,6 +491,10 @@ FourNodeQuad::setDomain(Domain *theDomain)
     }
     this->DomainComponent::setDomain(theDomain);
 
+    // Form the shared shape functions here, as the pool of caches is not
+    // safe to use from elements updated on threads
+    this->getShapes();
+
     // Compute consistent nodal loads due to pressure
     this->setPressureLoadAtNodes();
     
@@ -580,7 +591,7 @@ FourNodeQuad::update()
 	const Vector &disp3 = theNodes[2]->getTrialDisp();
 	const Vector &disp4 = theNodes[3]->getTrialDisp();
 	
-	static double u[2][4];
+	double u[2][4];
 
 	u[0][0] = disp1(0);
 	u[1][0] = disp1(1);
@@ -591,15 +602,18 @@ FourNodeQuad::update()
 	u[0][3] = disp4(0);
 	u[1][3] = disp4(1);
 
-	static Vector eps(3);
+	double epsData[3];
+	Vector eps(epsData, 3);
 
 	int ret = 0;
 
+	ShapeFunctionCache *shapes = this->getShapes();
+
 	// Loop over the integration points
 	for (int i = 0; i < 4; i++) {
 
-		// Determine Jacobian for this integration point
-		this->shapeFunction(pts[i][0], pts[i][1]);
+		// Shape functions for this integration point
+		const double (*shp)[4] = reinterpret_cast<const double (*)[4]>(shapes->getShape(i));
 
 		// Interpolate strains
 		//eps = B*u;
@@ -622,19 +636,22 @@ FourNodeQuad::update()
 const Matrix&
 FourNodeQuad::getTangentStiff()
 {
-  static Matrix D(3,3);
+	double Ddata[9];
+	Matrix D(Ddata, 3, 3);
 
 	K.Zero();
 
 	double dvol;
 	double DB[3][2];
 
+	ShapeFunctionCache *shapes = this->getShapes();
+
 	// Loop over the integration points
 	for (int i = 0; i < 4; i++) {
 
-	  // Determine Jacobian for this integration point
-	  dvol = this->shapeFunction(pts[i][0], pts[i][1]);
-	  dvol *= (thickness*wts[i]);
+	  // Shape functions and jacobian for this integration point
+	  const double (*shp)[4] = reinterpret_cast<const double (*)[4]>(shapes->getShape(i));
+	  dvol = shapes->getWeight(i)*thickness;
 	  
 	  // Get the material tangent
 	  D = theMaterial[i]->getTangent();
@@ -683,21 +700,25 @@ FourNodeQuad::getTangentStiff()
 const Matrix&
 FourNodeQuad::getInitialStiff()
 {
-  static Matrix D(3,3);
   if (Ki != 0)
     return *Ki;
 
+  double Ddata[9];
+  Matrix D(Ddata, 3, 3);
+
   K.Zero();
   
   double dvol;
   double DB[3][2];
   
+  ShapeFunctionCache *shapes = this->getShapes();
+
   // Loop over the integration points
   for (int i = 0; i < 4; i++) {
     
-    // Determine Jacobian for this integration point
-    dvol = this->shapeFunction(pts[i][0], pts[i][1]);
-    dvol *= (thickness*wts[i]);
+    // Shape functions and jacobian for this integration point
+    const double (*shp)[4] = reinterpret_cast<const double (*)[4]>(shapes->getShape(i));
+    dvol = shapes->getWeight(i)*thickness;
     
     // Get the material tangent
     D = theMaterial[i]->getInitialTangent();
@@ -756,14 +777,17 @@ FourNodeQuad::getMass()
 
 	double rhodvol, Nrho;
 
+	ShapeFunctionCache *shapes = this->getShapes();
+
 	// Compute a lumped mass matrix
 	for (i = 0; i < 4; i++) {
 
-		// Determine Jacobian for this integration point
-		rhodvol = this->shapeFunction(pts[i][0], pts[i][1]);
+		// Shape functions and jacobian for this integration point
+		const double (*shp)[4] = reinterpret_cast<const double (*)[4]>(shapes->getShape(i));
+		rhodvol = shapes->getWeight(i);
 
 		// Element plus material density ... MAY WANT TO REMOVE ELEMENT DENSITY
-		rhodvol *= (rhoi[i]*thickness*wts[i]);
+		rhodvol *= (rhoi[i]*thickness);
 
 		for (int alpha = 0, ia = 0; alpha < 4; alpha++, ia++) {
 			Nrho = shp[2][alpha]*rhodvol;
@@ -863,17 +887,20 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector&
 FourNodeQuad::getResistingForce()
 {
-  static Vector sigma(3);
+	double sigmaData[3];
+	Vector sigma(sigmaData, 3);
 	P.Zero();
 
 	double dvol;
 
+	ShapeFunctionCache *shapes = this->getShapes();
+
 	// Loop over the integration points
 	for (int i = 0; i < 4; i++) {
 
-		// Determine Jacobian for this integration point
-		dvol = this->shapeFunction(pts[i][0], pts[i][1]);
-		dvol *= (thickness*wts[i]);
+		// Shape functions and jacobian for this integration point
+		const double (*shp)[4] = reinterpret_cast<const double (*)[4]>(shapes->getShape(i));
+		dvol = shapes->getWeight(i)*thickness;
 
 		// Get material stress response
 		sigma = theMaterial[i]->getStress();
@@ -1284,6 +1311,19 @@ FourNodeQuad::Print(OPS_Stream &s, int flag)
   }
 }
 
+void
+FourNodeQuad::reportMemory(MemoryReport &theReport)
+{
+  // the shape functions are shared, they are reported with the domain
+  double bytes = sizeof(FourNodeQuad) + this->getBaseMemory()
+    + (Q.Size() + pressureLoad.Size())*sizeof(double)
+    + 4*sizeof(NDMaterial *) + MemoryReport::getBytes(Ki);
+  theReport.add("element", "FourNodeQuad", bytes);
+
+  for (int i = 0; i < 4; i++)
+    theMaterial[i]->reportMemory(theReport);
+}
+
 int
 FourNodeQuad::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
@@ -1635,7 +1675,39 @@ FourNodeQuad::updateParameter(int parameterID, Information &info)
   }
 }
 
-double FourNodeQuad::shapeFunction(double xi, double eta)
+// getShapes():
+//	the shape functions and their derivatives at the quadrature points
+//	only depend on the nodal coordinates, so they are formed once and
+//	shared with the quads of the same shape. The weights hold detJ times
+//	the quadrature weight.
+ShapeFunctionCache *
+FourNodeQuad::getShapes(void)
+{
+	if (theShapes != 0) {
+		if (shapesStamp == Node::getCrdsStamp())
+			return theShapes;
+
+		// a node may have been moved without setDomain(), e.g. by
+		// setNodeCoord, look the cache up again for the new shape
+		ShapeFunctionCache::releaseCache(theShapes);
+		theShapes = 0;
+	}
+
+	shapesStamp = Node::getCrdsStamp();
+	theShapes = ShapeFunctionCache::getCache(ELE_TAG_FourNodeQuad, theNodes, 4, 4, 3);
+
+	if (theShapes->isFormed() == false) {
+		for (int i = 0; i < 4; i++) {
+			double (*shp)[4] = reinterpret_cast<double (*)[4]>(theShapes->getShape(i));
+			theShapes->getWeight(i) = this->shapeFunction(pts[i][0], pts[i][1], shp)*wts[i];
+		}
+		theShapes->setFormed();
+	}
+
+	return theShapes;
+}
+
+double FourNodeQuad::shapeFunction(double xi, double eta, double shp[3][4])
 {
 	const Vector &nd1Crds = theNodes[0]->getCrds();
 	const Vector &nd2Crds = theNodes[1]->getCrds();
@@ -41,6 +41,8 @@
 #include <ID.h>
 #include <Damping.h>
 
+class ShapeFunctionCache;
+
 class Node;
 class NDMaterial;
 class Response;
@@ -92,6 +94,7 @@ class FourNodeQuad : public Element
 
     int displaySelf(Renderer &, int mode, float fact, const char **displayModes=0, int numModes=0);
     void Print(OPS_Stream &s, int flag =0);
+    void reportMemory(MemoryReport &theReport);
 
     Response *setResponse(const char **argv, int argc, 
 			  OPS_Stream &s);
@@ -132,12 +135,14 @@ class FourNodeQuad : public Element
     double pressure;	        // Normal surface traction (pressure) over entire element
 					 // Note: positive for outward normal
     double rho;
-    static double shp[3][4];	// Stores shape functions and derivatives (overwritten)
+    ShapeFunctionCache *theShapes; // Shape functions and derivatives at the quadrature points
+    int shapesStamp;               // Node::getCrdsStamp() theShapes was got at
     static double pts[4][2];	// Stores quadrature points
     static double wts[4];		// Stores quadrature weights
 
     // private member functions - only objects of this class can call these
-    double shapeFunction(double xi, double eta);
+    double shapeFunction(double xi, double eta, double shp[3][4]);
+    ShapeFunctionCache *getShapes(void);
     void setPressureLoadAtNodes(void);
 
     Matrix *Ki;
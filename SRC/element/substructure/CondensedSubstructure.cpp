@@ -0,0 +1,872 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of the
+// CondensedSubstructure class.
+
+#include "CondensedSubstructure.h"
+
+#include <Domain.h>
+#include <Node.h>
+#include <ElementIter.h>
+#include <MeshRegion.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <MP_Constraint.h>
+#include <MP_ConstraintIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <NodalLoad.h>
+#include <NodalLoadIter.h>
+#include <ElementalLoad.h>
+#include <ElementalLoadIter.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <Information.h>
+#include <ElementResponse.h>
+#include <classTags.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <set>
+#include <elementAPI.h>
+
+#ifdef _WIN32
+
+extern "C" int DSYGV(int *ITYPE, char *JOBZ, char *UPLO, int *N,
+                     double *A, int *LDA, double *B, int *LDB,
+                     double *W, double *WORK, int *LWORK, int *INFO);
+
+#else
+
+extern "C" int dsygv_(int *ITYPE, char *JOBZ, char *UPLO, int *N,
+                      double *A, int *LDA, double *B, int *LDB,
+                      double *W, double *WORK, int *LWORK, int *INFO);
+
+#endif
+
+
+void* OPS_CondensedSubstructure()
+{
+    if (OPS_GetNumRemainingInputArgs() < 3) {
+        opserr << "WARNING insufficient arguments\n";
+        opserr << "Want: element condensedSubstructure eleTag -region regTag "
+               << "<-retain Nd1 Nd2 ...> <-modes numModes modalNodeTag> <-tangent>\n";
+        return 0;
+    }
+
+    Domain *theDomain = OPS_GetDomain();
+    if (theDomain == 0) {
+        opserr << "WARNING condensedSubstructure - no domain\n";
+        return 0;
+    }
+
+    // tag
+    int tag;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &tag) < 0) {
+        opserr << "WARNING: invalid tag\n";
+        return 0;
+    }
+
+    // region
+    const char* type = OPS_GetString();
+    if (strcmp(type, "-region") != 0) {
+        opserr << "WARNING expecting -region regTag\n";
+        return 0;
+    }
+    int regTag;
+    if (OPS_GetIntInput(&numdata, &regTag) < 0) {
+        opserr << "WARNING: invalid regTag\n";
+        return 0;
+    }
+    MeshRegion *theRegion = theDomain->getRegion(regTag);
+    if (theRegion == 0) {
+        opserr << "WARNING condensedSubstructure " << tag
+               << " - region " << regTag << " does not exist\n";
+        return 0;
+    }
+
+    // optional arguments
+    std::set<int> boundary;
+    int numModes = 0;
+    int modalTag = -1;
+    bool useTangent = false;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+        type = OPS_GetString();
+        if (strcmp(type, "-retain") == 0) {
+            while (OPS_GetNumRemainingInputArgs() > 0) {
+                int node;
+                if (OPS_GetIntInput(&numdata, &node) < 0)
+                    break;
+                boundary.insert(node);
+            }
+        } else if (strcmp(type, "-modes") == 0) {
+            int idata[2];
+            numdata = 2;
+            if (OPS_GetIntInput(&numdata, idata) < 0) {
+                opserr << "WARNING expecting -modes numModes modalNodeTag\n";
+                return 0;
+            }
+            numdata = 1;
+            numModes = idata[0];
+            modalTag = idata[1];
+        } else if (strcmp(type, "-tangent") == 0) {
+            useTangent = true;
+        } else {
+            opserr << "WARNING condensedSubstructure " << tag
+                   << " - unknown option " << type << endln;
+            return 0;
+        }
+    }
+
+    // collect the elements of the region and the nodes they touch
+    const ID &regionEles = theRegion->getElements();
+    int numEle = regionEles.Size();
+    if (numEle == 0) {
+        opserr << "WARNING condensedSubstructure " << tag
+               << " - region " << regTag << " has no elements\n";
+        return 0;
+    }
+    std::set<int> eleSet, nodeSet;
+    for (int i=0; i<numEle; i++) {
+        Element *theEle = theDomain->getElement(regionEles(i));
+        if (theEle == 0)
+            continue;
+        eleSet.insert(theEle->getTag());
+        const ID &eleNodes = theEle->getExternalNodes();
+        for (int j=0; j<eleNodes.Size(); j++)
+            nodeSet.insert(eleNodes(j));
+    }
+
+    // a node is on the boundary if it is shared with an element outside
+    // the region or takes part in a multi-point constraint
+    ElementIter &theEles = theDomain->getElements();
+    Element *theEle;
+    while ((theEle = theEles()) != 0) {
+        if (eleSet.count(theEle->getTag()) != 0)
+            continue;
+        const ID &eleNodes = theEle->getExternalNodes();
+        for (int j=0; j<eleNodes.Size(); j++)
+            if (nodeSet.count(eleNodes(j)) != 0)
+                boundary.insert(eleNodes(j));
+    }
+    MP_ConstraintIter &theMPs = theDomain->getMPs();
+    MP_Constraint *theMP;
+    while ((theMP = theMPs()) != 0) {
+        if (nodeSet.count(theMP->getNodeRetained()) != 0)
+            boundary.insert(theMP->getNodeRetained());
+        if (nodeSet.count(theMP->getNodeConstrained()) != 0)
+            boundary.insert(theMP->getNodeConstrained());
+    }
+
+    ID boundaryNodes(0, (int)nodeSet.size());
+    int numBoundary = 0;
+    for (int nodeTag : nodeSet)
+        if (boundary.count(nodeTag) != 0)
+            boundaryNodes[numBoundary++] = nodeTag;
+    if (numBoundary == 0) {
+        opserr << "WARNING condensedSubstructure " << tag
+               << " - region " << regTag << " has no boundary nodes\n";
+        return 0;
+    }
+
+    // loads on the interior nodes and the region elements would be left
+    // with the condensed objects and never reach the model, so refuse them
+    LoadPatternIter &thePatterns = theDomain->getLoadPatterns();
+    LoadPattern *thePattern;
+    while ((thePattern = thePatterns()) != 0) {
+        NodalLoadIter &theNodalLoads = thePattern->getNodalLoads();
+        NodalLoad *theNodalLoad;
+        while ((theNodalLoad = theNodalLoads()) != 0) {
+            int nodeTag = theNodalLoad->getNodeTag();
+            if (nodeSet.count(nodeTag) != 0 && boundary.count(nodeTag) == 0) {
+                opserr << "WARNING condensedSubstructure " << tag
+                       << " - pattern " << thePattern->getTag()
+                       << " loads interior node " << nodeTag
+                       << "; retain the node with -retain\n";
+                return 0;
+            }
+        }
+        ElementalLoadIter &theEleLoads = thePattern->getElementalLoads();
+        ElementalLoad *theEleLoad;
+        while ((theEleLoad = theEleLoads()) != 0) {
+            if (eleSet.count(theEleLoad->getElementTag()) != 0) {
+                opserr << "WARNING condensedSubstructure " << tag
+                       << " - pattern " << thePattern->getTag()
+                       << " loads element " << theEleLoad->getElementTag()
+                       << " of the region; element loads are not condensed\n";
+                return 0;
+            }
+        }
+    }
+
+    // homogeneous single-point constraints on interior nodes are
+    // eliminated during condensation, so take them out of the domain
+    ID fixedDOF(0, 32);
+    ID spTags(0, 32);
+    int numFixed = 0, numSP = 0;
+    SP_ConstraintIter &theSPs = theDomain->getSPs();
+    SP_Constraint *theSP;
+    while ((theSP = theSPs()) != 0) {
+        int nodeTag = theSP->getNodeTag();
+        if (nodeSet.count(nodeTag) == 0 || boundary.count(nodeTag) != 0)
+            continue;
+        if (theSP->getValue() != 0.0) {
+            opserr << "WARNING condensedSubstructure " << tag
+                   << " - non-homogeneous constraint at interior node "
+                   << nodeTag << " is treated as fixed\n";
+        }
+        fixedDOF[numFixed++] = nodeTag;
+        fixedDOF[numFixed++] = theSP->getDOF_Number();
+        spTags[numSP++] = theSP->getTag();
+    }
+    for (int i=0; i<numSP; i++) {
+        SP_Constraint *removed = theDomain->removeSP_Constraint(spTags(i));
+        if (removed != 0)
+            delete removed;
+    }
+
+    // take ownership of the region elements and the interior nodes
+    Element **elements = new Element *[eleSet.size()];
+    int numElements = 0;
+    for (int eleTag : eleSet)
+        elements[numElements++] = theDomain->removeElement(eleTag);
+
+    int numInterior = (int)(nodeSet.size() - numBoundary);
+    Node **interior = new Node *[numInterior > 0 ? numInterior : 1];
+    numInterior = 0;
+    for (int nodeTag : nodeSet)
+        if (boundary.count(nodeTag) == 0)
+            interior[numInterior++] = theDomain->removeNode(nodeTag);
+
+    // the generalized coordinates of the retained modes live on their own node
+    if (numModes > 0) {
+        Node *modalNode = 0;
+        int ndm = OPS_GetNDM();
+        if (ndm == 1)
+            modalNode = new Node(modalTag, numModes, 0.0);
+        else if (ndm == 2)
+            modalNode = new Node(modalTag, numModes, 0.0, 0.0);
+        else
+            modalNode = new Node(modalTag, numModes, 0.0, 0.0, 0.0);
+        if (theDomain->addNode(modalNode) == false) {
+            opserr << "WARNING condensedSubstructure " << tag
+                   << " - could not add modal node " << modalTag << endln;
+            delete modalNode;
+            numModes = 0;
+            modalTag = -1;
+        }
+    }
+
+    Element *theSubstructure = new CondensedSubstructure(tag, boundaryNodes,
+        elements, numElements, interior, numInterior, fixedDOF,
+        numModes, modalTag, useTangent);
+
+    delete [] elements;
+    delete [] interior;
+
+    return theSubstructure;
+}
+
+
+CondensedSubstructure::CondensedSubstructure(int tag, const ID &boundaryNodes,
+    Element **elements, int numEle, Node **interiorNodes, int numInterior,
+    const ID &fixedDOF, int nModes, int modalNode, bool tangent)
+    : Element(tag, ELE_TAG_CondensedSubstructure),
+    connectedExternalNodes(boundaryNodes.Size() + (nModes > 0 ? 1 : 0)),
+    theNodes(0), numBoundaryNodes(boundaryNodes.Size()),
+    numBoundaryDOF(0), numDOF(0),
+    theElements(0), numElements(numEle),
+    theInteriorNodes(0), numInteriorNodes(numInterior),
+    fixedInteriorDOF(fixedDOF), numModes(nModes), useTangent(tangent),
+    numFullDOF(0), T(1,1), Kc(1,1), Mc(1,1), theVector(1), theLoad(1),
+    uc(1), uFull(1), isCondensed(false)
+{
+    for (int i=0; i<numBoundaryNodes; i++)
+        connectedExternalNodes(i) = boundaryNodes(i);
+    if (numModes > 0)
+        connectedExternalNodes(numBoundaryNodes) = modalNode;
+
+    int numExternalNodes = connectedExternalNodes.Size();
+    theNodes = new Node *[numExternalNodes];
+    for (int i=0; i<numExternalNodes; i++)
+        theNodes[i] = 0;
+
+    theElements = new Element *[numElements];
+    for (int i=0; i<numElements; i++)
+        theElements[i] = elements[i];
+
+    theInteriorNodes = new Node *[numInteriorNodes > 0 ? numInteriorNodes : 1];
+    for (int i=0; i<numInteriorNodes; i++)
+        theInteriorNodes[i] = interiorNodes[i];
+}
+
+
+// invoked by a FEM_ObjectBroker - blank object that recvSelf
+// needs to be invoked upon
+CondensedSubstructure::CondensedSubstructure()
+    : Element(0, ELE_TAG_CondensedSubstructure),
+    connectedExternalNodes(1), theNodes(0), numBoundaryNodes(0),
+    numBoundaryDOF(0), numDOF(0), theElements(0), numElements(0),
+    theInteriorNodes(0), numInteriorNodes(0), fixedInteriorDOF(0),
+    numModes(0), useTangent(false), numFullDOF(0),
+    T(1,1), Kc(1,1), Mc(1,1), theVector(1), theLoad(1),
+    uc(1), uFull(1), isCondensed(false)
+{
+
+}
+
+
+CondensedSubstructure::~CondensedSubstructure()
+{
+    for (Response *theResponse : subResponses)
+        delete theResponse;
+
+    if (theElements != 0) {
+        for (int i=0; i<numElements; i++)
+            delete theElements[i];
+        delete [] theElements;
+    }
+
+    if (theInteriorNodes != 0) {
+        for (int i=0; i<numInteriorNodes; i++)
+            delete theInteriorNodes[i];
+        delete [] theInteriorNodes;
+    }
+
+    if (theNodes != 0)
+        delete [] theNodes;
+}
+
+
+int CondensedSubstructure::getNumExternalNodes() const
+{
+    return connectedExternalNodes.Size();
+}
+
+
+const ID& CondensedSubstructure::getExternalNodes()
+{
+    return connectedExternalNodes;
+}
+
+
+Node** CondensedSubstructure::getNodePtrs()
+{
+    return theNodes;
+}
+
+
+int CondensedSubstructure::getNumDOF()
+{
+    return numDOF;
+}
+
+
+void CondensedSubstructure::setDomain(Domain *theDomain)
+{
+    int numExternalNodes = connectedExternalNodes.Size();
+
+    // check Domain is not null - invoked when object removed from a domain
+    if (theDomain == 0) {
+        for (int i=0; i<numExternalNodes; i++)
+            theNodes[i] = 0;
+        return;
+    }
+
+    // set the node pointers
+    for (int i=0; i<numExternalNodes; i++) {
+        theNodes[i] = theDomain->getNode(connectedExternalNodes(i));
+        if (theNodes[i] == 0) {
+            opserr << "CondensedSubstructure::setDomain() - Nd" << i << ": "
+                   << connectedExternalNodes(i) << " does not exist in the "
+                   << "model for CondensedSubstructure ele: " << this->getTag() << endln;
+            return;
+        }
+    }
+
+    // lay out the full system: boundary nodes first, then the interior
+    numBoundaryDOF = 0;
+    fullOffset.clear();
+    for (int i=0; i<numBoundaryNodes; i++) {
+        fullOffset[connectedExternalNodes(i)] = numBoundaryDOF;
+        numBoundaryDOF += theNodes[i]->getNumberDOF();
+    }
+    numFullDOF = numBoundaryDOF;
+    for (int i=0; i<numInteriorNodes; i++) {
+        fullOffset[theInteriorNodes[i]->getTag()] = numFullDOF;
+        numFullDOF += theInteriorNodes[i]->getNumberDOF();
+    }
+
+    // call the base class method
+    this->DomainComponent::setDomain(theDomain);
+
+    // the element has no dof, and so adds nothing, if it can't be condensed
+    numDOF = numBoundaryDOF + numModes;
+    if (numModes > 0 && theNodes[numBoundaryNodes]->getNumberDOF() != numModes) {
+        opserr << "CondensedSubstructure::setDomain() - modal node "
+               << connectedExternalNodes(numBoundaryNodes) << " must have "
+               << numModes << " dof\n";
+        numDOF = 0;
+    } else if (isCondensed == false && this->condense() < 0) {
+        opserr << "CondensedSubstructure::setDomain() - element " << this->getTag()
+               << " could not be condensed\n";
+        numDOF = 0;
+    }
+
+    if (numDOF == 0) {
+        opserr << "CondensedSubstructure::setDomain() - element " << this->getTag()
+               << " is left out of the analysis\n";
+        isCondensed = false;
+        Kc.resize(0, 0);
+        Mc.resize(0, 0);
+    }
+
+    theVector.resize(numDOF);
+    theVector.Zero();
+    theLoad.resize(numDOF);
+    theLoad.Zero();
+    uc.resize(numDOF);
+    uFull.resize(numFullDOF);
+}
+
+
+int CondensedSubstructure::condense()
+{
+    //
+    // assemble the stiffness and mass of the substructure elements
+    //
+    Matrix K(numFullDOF, numFullDOF);
+    Matrix M(numFullDOF, numFullDOF);
+    for (int e=0; e<numElements; e++) {
+        Element *theEle = theElements[e];
+        int numEleNodes = theEle->getNumExternalNodes();
+        Node **eleNodes = theEle->getNodePtrs();
+
+        ID loc(theEle->getNumDOF());
+        int pos = 0;
+        for (int i=0; i<numEleNodes; i++) {
+            int offset = fullOffset[eleNodes[i]->getTag()];
+            int ndf = eleNodes[i]->getNumberDOF();
+            for (int j=0; j<ndf; j++)
+                loc(pos++) = offset + j;
+        }
+
+        const Matrix &ke = useTangent ? theEle->getTangentStiff() : theEle->getInitialStiff();
+        K.Assemble(ke, loc, loc);
+        const Matrix &me = theEle->getMass();
+        M.Assemble(me, loc, loc);
+    }
+
+    //
+    // split the interior into free and fixed dof
+    //
+    ID isFixed(numFullDOF);
+    for (int i=0; i<fixedInteriorDOF.Size(); i+=2) {
+        std::map<int,int>::iterator it = fullOffset.find(fixedInteriorDOF(i));
+        if (it != fullOffset.end())
+            isFixed(it->second + fixedInteriorDOF(i+1)) = 1;
+    }
+    ID interior(0, numFullDOF);
+    int ni = 0;
+    for (int i=numBoundaryDOF; i<numFullDOF; i++)
+        if (isFixed(i) == 0)
+            interior[ni++] = i;
+
+    int nb = numBoundaryDOF;
+    T.resize(numFullDOF, numDOF);
+    T.Zero();
+    for (int i=0; i<nb; i++)
+        T(i,i) = 1.0;
+
+    if (ni > 0) {
+        Matrix Kii(ni, ni);
+        Matrix Kib(ni, nb);
+        for (int i=0; i<ni; i++) {
+            for (int j=0; j<ni; j++)
+                Kii(i,j) = K(interior(i), interior(j));
+            for (int j=0; j<nb; j++)
+                Kib(i,j) = K(interior(i), j);
+        }
+
+        // static constraint modes: u_i = -inv(Kii) Kib u_b
+        Matrix X(ni, nb);
+        if (Kii.Solve(Kib, X) < 0) {
+            opserr << "CondensedSubstructure::condense() - element " << this->getTag()
+                   << " failed to factor the interior stiffness\n";
+            return -1;
+        }
+        for (int i=0; i<ni; i++)
+            for (int j=0; j<nb; j++)
+                T(interior(i), j) = -X(i,j);
+
+        // fixed-interface normal modes (Craig-Bampton)
+        if (numModes > 0) {
+            if (numModes > ni) {
+                opserr << "CondensedSubstructure::condense() - element " << this->getTag()
+                       << " cannot retain more modes than interior dof\n";
+                return -1;
+            }
+            Matrix A(Kii);
+            Matrix B(ni, ni);
+            for (int i=0; i<ni; i++)
+                for (int j=0; j<ni; j++)
+                    B(i,j) = M(interior(i), interior(j));
+
+            int itype = 1;
+            char jobz[] = "V";
+            char uplo[] = "U";
+            int n = ni;
+            int lwork = 3*ni;
+            int info = 0;
+            double *w = new double[ni];
+            double *work = new double[lwork];
+#ifdef _WIN32
+            DSYGV(&itype, jobz, uplo, &n, &A(0,0), &n, &B(0,0), &n, w, work, &lwork, &info);
+#else
+            dsygv_(&itype, jobz, uplo, &n, &A(0,0), &n, &B(0,0), &n, w, work, &lwork, &info);
+#endif
+            delete [] w;
+            delete [] work;
+            if (info != 0) {
+                opserr << "CondensedSubstructure::condense() - element " << this->getTag()
+                       << " failed to compute interior modes, info = " << info
+                       << " (the interior mass must be positive definite)\n";
+                return -1;
+            }
+
+            // eigenvectors are mass normalized and stored column-wise in A
+            for (int m=0; m<numModes; m++)
+                for (int i=0; i<ni; i++)
+                    T(interior(i), nb+m) = A(i,m);
+        }
+    }
+
+    //
+    // project onto the condensed coordinates
+    //
+    Kc.resize(numDOF, numDOF);
+    Kc.addMatrixTripleProduct(0.0, T, K, 1.0);
+    Mc.resize(numDOF, numDOF);
+    Mc.addMatrixTripleProduct(0.0, T, M, 1.0);
+
+    isCondensed = true;
+    return 0;
+}
+
+
+const Vector& CondensedSubstructure::getCondensedDisp()
+{
+    if (numDOF == 0)
+        return uc;
+
+    int pos = 0;
+    int numExternalNodes = connectedExternalNodes.Size();
+    for (int i=0; i<numExternalNodes; i++) {
+        const Vector &disp = theNodes[i]->getTrialDisp();
+        for (int j=0; j<disp.Size(); j++)
+            uc(pos++) = disp(j);
+    }
+    return uc;
+}
+
+
+int CondensedSubstructure::recoverInterior()
+{
+    if (numDOF == 0)
+        return -1;
+
+    uFull.addMatrixVector(0.0, T, this->getCondensedDisp(), 1.0);
+
+    for (int i=0; i<numInteriorNodes; i++) {
+        Node *theNode = theInteriorNodes[i];
+        int offset = fullOffset[theNode->getTag()];
+        Vector disp(&uFull(offset), theNode->getNumberDOF());
+        theNode->setTrialDisp(disp);
+    }
+
+    int result = 0;
+    for (int e=0; e<numElements; e++)
+        result += theElements[e]->update();
+
+    return result;
+}
+
+
+int CondensedSubstructure::commitState()
+{
+    int retVal = 0;
+    // call element commitState to do any base class stuff
+    if ((retVal = this->Element::commitState()) != 0) {
+        opserr << "CondensedSubstructure::commitState () - failed in base class";
+    }
+    return retVal;
+}
+
+
+int CondensedSubstructure::revertToLastCommit()
+{
+    // linear substructure - nothing to revert
+    return 0;
+}
+
+
+int CondensedSubstructure::revertToStart()
+{
+    // linear substructure - nothing to revert
+    return 0;
+}
+
+
+int CondensedSubstructure::update()
+{
+    // interior state is only recovered on request
+    return 0;
+}
+
+
+const Matrix& CondensedSubstructure::getTangentStiff()
+{
+    return Kc;
+}
+
+
+const Matrix& CondensedSubstructure::getInitialStiff()
+{
+    return Kc;
+}
+
+
+const Matrix& CondensedSubstructure::getMass()
+{
+    return Mc;
+}
+
+
+void CondensedSubstructure::zeroLoad()
+{
+    theLoad.Zero();
+}
+
+
+int CondensedSubstructure::addLoad(ElementalLoad *theLoad, double loadFactor)
+{
+    // loads on the condensed elements are refused when the substructure
+    // is created; loads on the substructure itself are not supported
+    opserr <<"CondensedSubstructure::addLoad() - "
+           << "element loads are not condensed, load ignored for element: "
+           << this->getTag() << endln;
+
+    return -1;
+}
+
+
+int CondensedSubstructure::addInertiaLoadToUnbalance(const Vector &accel)
+{
+    if (numDOF == 0)
+        return 0;
+
+    // the modal coordinates are relative to the boundary motion,
+    // so only the boundary nodes see the support acceleration
+    Vector Raccel(numDOF);
+    int ndim = 0;
+    for (int i=0; i<numBoundaryNodes; i++) {
+        Raccel.Assemble(theNodes[i]->getRV(accel), ndim);
+        ndim += theNodes[i]->getNumberDOF();
+    }
+
+    // want to add ( - fact * M R * accel ) to unbalance
+    theLoad.addMatrixVector(1.0, Mc, Raccel, -1.0);
+
+    return 0;
+}
+
+
+const Vector& CondensedSubstructure::getResistingForce()
+{
+    theVector.addMatrixVector(0.0, Kc, this->getCondensedDisp(), 1.0);
+
+    // subtract external load
+    theVector.addVector(1.0, theLoad, -1.0);
+
+    return theVector;
+}
+
+
+const Vector& CondensedSubstructure::getResistingForceIncInertia()
+{
+    this->getResistingForce();
+    if (numDOF == 0)
+        return theVector;
+
+    // add inertia forces from the condensed mass
+    Vector accel(numDOF);
+    int ndim = 0;
+    int numExternalNodes = connectedExternalNodes.Size();
+    for (int i=0; i<numExternalNodes; i++) {
+        accel.Assemble(theNodes[i]->getTrialAccel(), ndim);
+        ndim += theNodes[i]->getNumberDOF();
+    }
+    theVector.addMatrixVector(1.0, Mc, accel, 1.0);
+
+    // add the damping forces if rayleigh damping
+    if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
+        theVector.addVector(1.0, this->getRayleighDampingForces(), 1.0);
+
+    return theVector;
+}
+
+
+// the elements and interior nodes owned by a substructure are not
+// sent, so it cannot be moved to another process or to a database
+int CondensedSubstructure::sendSelf(int commitTag, Channel &sChannel)
+{
+    opserr << "CondensedSubstructure::sendSelf() - element " << this->getTag()
+           << " cannot be sent; condensed substructures are only supported "
+           << "in sequential models without a database\n";
+    return -1;
+}
+
+
+int CondensedSubstructure::recvSelf(int commitTag, Channel &rChannel,
+    FEM_ObjectBroker &theBroker)
+{
+    opserr << "CondensedSubstructure::recvSelf() - element " << this->getTag()
+           << " cannot be received; condensed substructures are only supported "
+           << "in sequential models without a database\n";
+    return -1;
+}
+
+
+void CondensedSubstructure::Print(OPS_Stream &s, int flag)
+{
+    if (flag == OPS_PRINT_PRINTMODEL_JSON) {
+        s << "\t\t\t{";
+        s << "\"name\": " << this->getTag() << ", ";
+        s << "\"type\": \"CondensedSubstructure\", ";
+        s << "\"nodes\": [";
+        for (int i=0; i<connectedExternalNodes.Size(); i++) {
+            if (i > 0)
+                s << ", ";
+            s << connectedExternalNodes(i);
+        }
+        s << "], ";
+        s << "\"elements\": [";
+        for (int i=0; i<numElements; i++) {
+            if (i > 0)
+                s << ", ";
+            s << theElements[i]->getTag();
+        }
+        s << "], ";
+        s << "\"modes\": " << numModes << "}";
+        return;
+    }
+
+    s << "Element: " << this->getTag() << endln;
+    s << "  type: CondensedSubstructure\n";
+    s << "  boundary nodes: " << numBoundaryNodes
+      << "  interior nodes: " << numInteriorNodes
+      << "  elements: " << numElements << endln;
+    s << "  condensed dof: " << numDOF << " (of " << numFullDOF << ")"
+      << "  retained modes: " << numModes << endln;
+    s << "  resisting force: " << this->getResistingForce();
+}
+
+
+Response* CondensedSubstructure::setResponse(const char **argv, int argc,
+    OPS_Stream &output)
+{
+    Response *theResponse = 0;
+
+    output.tag("ElementOutput");
+    output.attr("eleType", "CondensedSubstructure");
+    output.attr("eleTag", this->getTag());
+
+    if (strcmp(argv[0],"force") == 0 || strcmp(argv[0],"forces") == 0 ||
+        strcmp(argv[0],"globalForce") == 0 || strcmp(argv[0],"globalForces") == 0) {
+        theResponse = new ElementResponse(this, 1, theVector);
+
+    } else if (strcmp(argv[0],"interiorDisplacement") == 0 ||
+               strcmp(argv[0],"interiorDisp") == 0) {
+        theResponse = new ElementResponse(this, 2, Vector(numFullDOF - numBoundaryDOF));
+
+    } else if ((strcmp(argv[0],"element") == 0 || strcmp(argv[0],"subElement") == 0) && argc > 2) {
+        // responses of the condensed elements; these are only computed
+        // from the boundary displacements when requested
+        int subTag = atoi(argv[1]);
+        Element *theEle = 0;
+        for (int i=0; i<numElements && theEle == 0; i++)
+            if (theElements[i]->getTag() == subTag)
+                theEle = theElements[i];
+        if (theEle == 0)
+            return 0;
+
+        std::string key;
+        for (int i=1; i<argc; i++)
+            key += std::string(argv[i]) + " ";
+
+        int index = -1;
+        std::map<std::string,int>::iterator it = subResponseKeys.find(key);
+        if (it != subResponseKeys.end()) {
+            index = it->second;
+        } else {
+            Response *subResponse = theEle->setResponse(&argv[2], argc-2, output);
+            if (subResponse == 0)
+                return 0;
+            index = (int)subResponses.size();
+            subResponses.push_back(subResponse);
+            subResponseKeys[key] = index;
+        }
+        theResponse = new ElementResponse(this, 100 + index,
+                                          subResponses[index]->getInformation().getData());
+    }
+
+    output.endTag();
+
+    return theResponse;
+}
+
+
+int CondensedSubstructure::getResponse(int responseID, Information &eleInfo)
+{
+    if (responseID == 1)
+        return eleInfo.setVector(this->getResistingForce());
+
+    if (responseID == 2) {
+        this->recoverInterior();
+        Vector interiorDisp(numFullDOF - numBoundaryDOF);
+        for (int i=numBoundaryDOF; i<numFullDOF; i++)
+            interiorDisp(i - numBoundaryDOF) = uFull(i);
+        return eleInfo.setVector(interiorDisp);
+    }
+
+    int index = responseID - 100;
+    if (index >= 0 && index < (int)subResponses.size()) {
+        this->recoverInterior();
+        Response *subResponse = subResponses[index];
+        if (subResponse->getResponse() < 0)
+            return -1;
+        return eleInfo.setVector(subResponse->getInformation().getData());
+    }
+
+    return -1;
+}
@@ -0,0 +1,141 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef CondensedSubstructure_h
+#define CondensedSubstructure_h
+
+// Description: This file contains the class definition for
+// CondensedSubstructure. A CondensedSubstructure takes ownership of the
+// elements of a linear region of the model together with the nodes that
+// are interior to that region, and condenses their stiffness and mass
+// onto the boundary nodes once. Optionally, a number of fixed-interface
+// modes of the interior are retained (Craig-Bampton); the generalized
+// coordinates of these modes are carried by an additional modal node.
+// Interior displacements are only recovered when a response that needs
+// them is requested.
+// Loads are not condensed: the region may not carry nodal loads on its
+// interior nodes or element loads, and the substructure cannot be sent
+// to another process or a database.
+
+#include <Element.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+class Response;
+
+class CondensedSubstructure : public Element
+{
+public:
+    // constructors
+    CondensedSubstructure(int tag, const ID &boundaryNodes,
+                          Element **elements, int numElements,
+                          Node **interiorNodes, int numInteriorNodes,
+                          const ID &fixedInteriorDOF,
+                          int numModes = 0, int modalNode = -1,
+                          bool useTangent = false);
+    CondensedSubstructure();
+
+    // destructor
+    ~CondensedSubstructure();
+
+    // method to get class type
+    const char *getClassType() const {return "CondensedSubstructure";};
+
+    // public methods to obtain information about dof & connectivity
+    int getNumExternalNodes() const;
+    const ID &getExternalNodes();
+    Node **getNodePtrs();
+    int getNumDOF();
+    void setDomain(Domain *theDomain);
+
+    // public methods to set the state of the element
+    int commitState();
+    int revertToLastCommit();
+    int revertToStart();
+    int update();
+
+    // public methods to obtain stiffness, mass, damping and residual information
+    const Matrix &getTangentStiff();
+    const Matrix &getInitialStiff();
+    const Matrix &getMass();
+
+    void zeroLoad();
+    int addLoad(ElementalLoad *theLoad, double loadFactor);
+    int addInertiaLoadToUnbalance(const Vector &accel);
+
+    const Vector &getResistingForce();
+    const Vector &getResistingForceIncInertia();
+
+    // public methods for element output
+    int sendSelf(int commitTag, Channel &sChannel);
+    int recvSelf(int commitTag, Channel &rChannel, FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag = 0);
+
+    // public methods for element recorder
+    Response *setResponse(const char **argv, int argc, OPS_Stream &s);
+    int getResponse(int responseID, Information &eleInfo);
+
+protected:
+
+private:
+    // condense the interior onto the boundary; invoked once from setDomain
+    int condense();
+    // gather the trial displacements of the external nodes
+    const Vector &getCondensedDisp();
+    // set the interior nodes to the state implied by the boundary
+    int recoverInterior();
+
+    ID connectedExternalNodes;  // boundary nodes followed by the modal node
+    Node **theNodes;            // pointers to the external nodes
+    int numBoundaryNodes;       // number of boundary nodes
+    int numBoundaryDOF;         // number of dof at the boundary nodes
+    int numDOF;                 // number of condensed dof
+
+    Element **theElements;      // elements of the substructure (owned)
+    int numElements;
+    Node **theInteriorNodes;    // interior nodes of the substructure (owned)
+    int numInteriorNodes;
+    ID fixedInteriorDOF;        // pairs of (node tag, dof) fixed in the interior
+
+    int numModes;               // number of retained fixed-interface modes
+    bool useTangent;            // condense current tangent rather than initial stiffness
+
+    std::map<int,int> fullOffset; // node tag -> first row in the full system
+    int numFullDOF;
+
+    Matrix T;                   // full dof = T * condensed dof
+    Matrix Kc;                  // condensed stiffness
+    Matrix Mc;                  // condensed mass
+    Vector theVector;           // resisting force
+    Vector theLoad;             // load vector
+    Vector uc;                  // condensed displacement
+    Vector uFull;               // recovered full displacement
+
+    bool isCondensed;
+    std::vector<Response *> subResponses;
+    std::map<std::string, int> subResponseKeys;
+};
+
+#endif
@@ -46,6 +46,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <ShapeFunctionCache.h>
 #include <map>
 
 void* OPS_FourNodeTetrahedron()
@@ -227,16 +228,12 @@ const double  FourNodeTetrahedron::sg[] = { 0.25 } ;
 
 const double  FourNodeTetrahedron::wg[] = { 0.166666666666666667 } ;
 
-  
-Matrix FourNodeTetrahedron::B(NumStressComponents,NumDOFsPerNode) ;
 
 //null constructor
 FourNodeTetrahedron::FourNodeTetrahedron( ) 
 :Element( 0, ELE_TAG_FourNodeTetrahedron ),
- connectedExternalNodes(NumNodes), applyLoad(0), load(0), Ki(0), do_init_disp(false)
+ connectedExternalNodes(NumNodes), applyLoad(0), load(0), Ki(0), theShapes(0), shapesStamp(0), do_init_disp(false)
 {
-  B.Zero();
-
   for (int i=0; i < NumNodes; i++ ) {
     nodePointers[i] = 0;
   }
@@ -266,9 +263,8 @@ FourNodeTetrahedron::FourNodeTetrahedron(int tag,
        NDMaterial &theMaterial,
        double b1, double b2, double b3, bool do_init_disp_)
   :Element(tag, ELE_TAG_FourNodeTetrahedron),
-   connectedExternalNodes(4), applyLoad(0), load(0), Ki(0), do_init_disp(do_init_disp_)
+   connectedExternalNodes(4), applyLoad(0), load(0), Ki(0), theShapes(0), shapesStamp(0), do_init_disp(do_init_disp_)
 {
-  B.Zero();
   do_update = true;
   connectedExternalNodes(0) = node1 ;
   connectedExternalNodes(1) = node2 ;
@@ -314,7 +310,8 @@ FourNodeTetrahedron::~FourNodeTetrahedron( )
 
   if (Ki != 0)
     delete Ki;
-  
+
+  ShapeFunctionCache::releaseCache(theShapes);
 }
 
 
@@ -324,6 +321,10 @@ void  FourNodeTetrahedron::setDomain( Domain *theDomain )
 
   int i ;
 
+  //the nodes or their coordinates may have changed
+  ShapeFunctionCache::releaseCache(theShapes);
+  theShapes = 0;
+
   //node pointers
   for ( i=0; i<NumNodes; i++ ) 
   {
@@ -336,6 +337,12 @@ void  FourNodeTetrahedron::setDomain( Domain *theDomain )
       }
   }
 
+  //form the shared shape functions here, as the pool of caches is not
+  //safe to use from elements updated on threads
+  for ( i=0; i<NumNodes && nodePointers[i] != 0; i++ ) ;
+  if ( i == NumNodes )
+    getShapes( ) ;
+
   this->DomainComponent::setDomain(theDomain);
 
 }
@@ -518,146 +525,35 @@ const Matrix&  FourNodeTetrahedron::getInitialStiff( )
     return *Ki;
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
-  static const int ndm = 3 ;
   static const int ndf = NumDOFsPerNode ; 
   static const int nstress = NumStressComponents ;
   static const int numberNodes = NumNodes ;
   static const int numberGauss = NumGaussPoints ;
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
-  int jj, kk ;
-
-  
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-  static Matrix dd(nstress,nstress) ;  //material tangent
-
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+  //B matrix of all the nodes
+  double Bdata[nstress*ndf*numberNodes] ;
+  Matrix B( Bdata, nstress, ndf*numberNodes ) ;
+  B.Zero( ) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
-  
   //zero stiffness and residual 
   stiff.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  // for ( i = 0; i < NumGaussPointsm; i++ ) 
-  {
-    // for ( j = 0; j < NumGaussPointsm; j++ ) 
-    {
-      // for ( k = 0; k < NumGaussPointsm; k++ ) 
-      {
-
-        i = j = k = 0; // Just one Gauss point in a tet
-
-        gaussPoint[0] = sg[i] ;        
-        gaussPoint[1] = sg[j] ;        
-        gaussPoint[2] = sg[k] ;
-
-        //get shape functions    
-        shp3d( gaussPoint, xsj, shp, xl ) ;
-
-        //save shape functions
-        for ( p = 0; p < nShape; p++ ) 
-        {
-          for ( q = 0; q < numberNodes; q++ )
-          {
-            Shape[p][q][count] = shp[p][q] ;
-          }
-         } // end for p
-
-        //volume element to also be saved
-        dvol[count] = wg[count] * xsj ;  
-
-        //volume += dvol[count] ;
-
-        count++ ;
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop 
-  for ( i = 0; i < numberGauss; i++ ) 
+  for ( int i = 0; i < numberGauss; i++ ) 
   {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) 
-    {
-       for ( q = 0; q < numberNodes; q++ )
-       {
-         shp[p][q]  = Shape[p][q][i] ;
-       }
-    } // end for p
-
-
-    dd = materialPointers[i]->getInitialTangent( ) ;
-    dd *= dvol[i] ;
-    
-    jj = 0;
-    for ( j = 0; j < numberNodes; j++ ) 
-    {
+    const double (*shp)[numberNodes] = 
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
-      BJ = computeB( j, shp ) ;
-   
-      //transpose 
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) 
-      {
-        for (q=0; q<nstress; q++) 
-        {
-          BJtran(p,q) = BJ(q,p) ;
-        }
-      }//end for p
+    computeB( shp, B ) ;
 
-      //BJtranD = BJtran * dd ;
-      BJtranD.addMatrixProduct(0.0,  BJtran, dd, 1.0) ;
-      
-      kk = 0 ;
-      for ( k = 0; k < numberNodes; k++ ) 
-      {
-  
-         BK = computeB( k, shp ) ;
-  
-  
-        //stiffJK =  BJtranD * BK  ;
-        stiffJK.addMatrixProduct(0.0,  BJtranD, BK, 1.0) ;
-        
-        for ( p = 0; p < ndf; p++ )  
-        {
-          for ( q = 0; q < ndf; q++ )
-          {
-            stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-          }
-        } //end for p
-       kk += ndf ;
-      } // end for k loop
+    //stiff += B' * dd * B * dvol
+    const Matrix &dd = materialPointers[i]->getInitialTangent( ) ;
+    stiff.addMatrixTripleProduct( 1.0, B, dd, shapes->getWeight(i) ) ;
 
-      jj += ndf ;
-    } // end for j loop
   } //end for i gauss loop 
 
 
@@ -819,8 +715,6 @@ const Vector&  FourNodeTetrahedron::getResistingForceIncInertia( )
 void   FourNodeTetrahedron::formInertiaTerms( int tangFlag ) 
 {
 
-  static const int ndm = 3 ;
-
   static const int ndf = NumDOFsPerNode ; 
 
   static const int numberNodes = NumNodes ;
@@ -831,19 +725,9 @@ void   FourNodeTetrahedron::formInertiaTerms( int tangFlag )
 
   static const int massIndex = nShape - 1 ;
 
-  double xsj ;  // determinant jacaobian matrix 
-
-  double dvol[numberGauss] ; //volume element
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  double momentum[ndf] ;
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static double gaussPoint[ndm] ;
-
-  static Vector momentum(ndf) ;
-
-  int i, j, k, p, q ;
+  int i, j, k, p ;
   int jj, kk ;
 
   double temp, rho, massJK ;
@@ -858,67 +742,26 @@ void   FourNodeTetrahedron::formInertiaTerms( int tangFlag )
   }
 
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-
-  // for ( i = 0; i < 2; i++ ) 
-  {
-    // for ( j = 0; j < 2; j++ ) 
-    {
-      // for ( k = 0; k < 2; k++ ) 
-      {
-        i = j = k = 0;
-
-        gaussPoint[0] = sg[i] ;        
-        gaussPoint[1] = sg[j] ;        
-        gaussPoint[2] = sg[k] ;
-
-        //get shape functions    
-        shp3d( gaussPoint, xsj, shp, xl ) ;
-
-        //save shape functions
-        for ( p = 0; p < nShape; p++ ) 
-        {
-          for ( q = 0; q < numberNodes; q++ )
-          {
-            Shape[p][q][count] = shp[p][q] ;
-          }
-        } // end for p
-
-      //volume element to also be saved
-      dvol[count] = wg[count] * xsj ;  
-
-      count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
-  
-
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) 
   {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) 
-    {
-        for ( q = 0; q < numberNodes; q++ )
-        {
-          shp[p][q]  = Shape[p][q][i] ;
-        }
-    } // end for p
+    const double (*shp)[numberNodes] = 
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
+    double dvol = shapes->getWeight(i) ;
 
     //node loop to compute acceleration
-    momentum.Zero( ) ;
+    for ( p = 0; p < ndf; p++ )
+      momentum[p] = 0.0 ;
     for ( j = 0; j < numberNodes; j++ ) 
     {
-      momentum.addVector( 1.0, nodePointers[j]->getTrialAccel(), shp[massIndex][j] ) ;
+      const Vector &accel = nodePointers[j]->getTrialAccel() ;
+      for ( p = 0; p < ndf; p++ )
+        momentum[p] += shp[massIndex][j] * accel(p) ;
     }
 
 
@@ -927,7 +770,8 @@ void   FourNodeTetrahedron::formInertiaTerms( int tangFlag )
 
 
     //multiply acceleration by density to form momentum
-    momentum *= rho ;
+    for ( p = 0; p < ndf; p++ )
+      momentum[p] *= rho ;
 
 
     //residual and tangent calculations node loops
@@ -935,11 +779,11 @@ void   FourNodeTetrahedron::formInertiaTerms( int tangFlag )
     for ( j = 0; j < numberNodes; j++ ) 
     {
 
-      temp = shp[massIndex][j] * dvol[i] ;
+      temp = shp[massIndex][j] * dvol ;
 
       for ( p = 0; p < ndf; p++ )
       {
-        resid( jj+p ) += ( temp * momentum(p) )  ;
+        resid( jj+p ) += ( temp * momentum[p] )  ;
       }
 
       if ( tangFlag == 1 ) 
@@ -983,104 +827,32 @@ FourNodeTetrahedron::update(void)
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
-  static const int ndf = NumDOFsPerNode ; 
-
   static const int nstress = NumStressComponents ;
  
   static const int numberNodes = NumNodes ;
 
   static const int numberGauss = NumGaussPoints ;
 
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
+  int i, j ;
   int success ;
   
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
-  static Vector strain(nstress) ;  //strain
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  //---------B-matrices------------------------------------
-
-  static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-  static Matrix BJtran(ndf,nstress) ;
-
-  static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-  static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
-  
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
+  double strainData[nstress] ;
+  Vector strain( strainData, nstress ) ;  //strain
 
-  int count = 0 ;
-  volume = 0.0 ;
-
-  // for ( i = 0; i < 2; i++ ) 
-  {
-    // for ( j = 0; j < 2; j++ ) 
-    {
-      // for ( k = 0; k < 2; k++ ) 
-      {
-        i = j = k = 0;
-
-        gaussPoint[0] = sg[i] ;        
-        gaussPoint[1] = sg[j] ;        
-        gaussPoint[2] = sg[k] ;
-
-        //get shape functions    
-        shp3d( gaussPoint, xsj, shp, xl ) ;
-
-        //save shape functions
-        for ( p = 0; p < nShape; p++ ) 
-        {
-          for ( q = 0; q < numberNodes; q++ )
-          {
-            Shape[p][q][count] = shp[p][q] ;
-          }
-        } // end for p
-
-        //volume element to also be saved
-        dvol[count] = wg[count] * xsj ;  
-        count++ ;
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) 
   {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) 
-    {
-      for ( q = 0; q < numberNodes; q++ )
-      {
-        shp[p][q]  = Shape[p][q][i] ;
-      }
-    } // end for p
+    const double (*shp)[numberNodes] = 
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
     //zero the strains
     strain.Zero( ) ;
 
+
     // j-node loop to compute strain 
     for ( j = 0; j < numberNodes; j++ )  {
 
@@ -1124,11 +896,11 @@ FourNodeTetrahedron::update(void)
       double b50 = shp[2][j];
       double b52 = shp[0][j];
 
-      const Vector &ul = nodePointers[j]->getTrialDisp() - initDisp[j];
+      const Vector &ul = nodePointers[j]->getTrialDisp();
 
-      double ul0 = ul(0);
-      double ul1 = ul(1);
-      double ul2 = ul(2);
+      double ul0 = ul(0) - initDisp[j](0);
+      double ul1 = ul(1) - initDisp[j](1);
+      double ul2 = ul(2) - initDisp[j](2);
 
       strain(0) += b00 * ul0;
       strain(1) += b11 * ul1;
@@ -1157,8 +929,6 @@ void  FourNodeTetrahedron::formResidAndTangent( int tang_flag )
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
   static const int ndf = NumDOFsPerNode ; 
 
   static const int nstress = NumStressComponents ;
@@ -1167,45 +937,15 @@ void  FourNodeTetrahedron::formResidAndTangent( int tang_flag )
 
   static const int numberGauss = NumGaussPoints ;
 
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
-
-
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static Vector residJ(ndf) ; //nodeJ residual 
-
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-
-  static Vector stress(nstress) ;  //stress
+  int i, j, p ;
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  double residJ[ndf] ; //nodeJ residual 
 
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
-  // opserr << "DEBUGME!" << endln;
+  //B matrix of all the nodes
+  double Bdata[nstress*ndf*numberNodes] ;
+  Matrix B( Bdata, nstress, ndf*numberNodes ) ;
+  if ( tang_flag == 1 )
+    B.Zero( ) ;
 
   //zero stiffness and residual 
   stiff.Zero( ) ;
@@ -1216,80 +956,30 @@ void  FourNodeTetrahedron::formResidAndTangent( int tang_flag )
     return ;
   }
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  // opserr << "DEBUGME!" << endln;
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  // for ( i = 0; i < 2; i++ ) 
-  {
-    // for ( j = 0; j < 2; j++ ) 
-    {
-      // for ( k = 0; k < 2; k++ ) 
-      {
-        i = j = k = 0;
-
-        gaussPoint[0] = sg[i] ;        
-        gaussPoint[1] = sg[j] ;        
-        gaussPoint[2] = sg[k] ;
-
-        //get shape functions    
-        shp3d( gaussPoint, xsj, shp, xl ) ;
-
-        //save shape functions
-        for ( p = 0; p < nShape; p++ ) {
-          for ( q = 0; q < numberNodes; q++ )
-            Shape[p][q][count] = shp[p][q] ;
-        } // end for p
-
-        //volume element to also be saved
-        dvol[count] = wg[count] * xsj ;  
-
-        count++ ;
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  //shape functions at the gauss points
+  ShapeFunctionCache *shapes = getShapes( ) ;
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) 
   {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) 
-    {
-      for ( q = 0; q < numberNodes; q++ )
-      {
-        shp[p][q]  = Shape[p][q][i] ;
-      }
-    } // end for p
+    const double (*shp)[numberNodes] = 
+      reinterpret_cast<const double (*)[numberNodes]>( shapes->getShape(i) ) ;
 
+    double dvol = shapes->getWeight(i) ;
 
     //compute the stress
-    stress = materialPointers[i]->getStress( ) ;
-
+    const Vector &stress = materialPointers[i]->getStress( ) ;
 
     //multiply by volume element
-    stress  *= dvol[i] ;
-
-    if ( tang_flag == 1 ) {
-      dd = materialPointers[i]->getTangent( ) ;
-      dd *= dvol[i] ;
-    } //end if tang_flag
+    double stress0 = stress(0) * dvol ;
+    double stress1 = stress(1) * dvol ;
+    double stress2 = stress(2) * dvol ;
+    double stress3 = stress(3) * dvol ;
+    double stress4 = stress(4) * dvol ;
+    double stress5 = stress(5) * dvol ;
 
-    double stress0 = stress(0);
-    double stress1 = stress(1);
-    double stress2 = stress(2);
-    double stress3 = stress(3);
-    double stress4 = stress(4);
-    double stress5 = stress(5);
-
-    //residual and tangent calculations node loops
+    //residual calculations node loop
 
     int jj = 0 ;
     for ( j = 0; j < numberNodes; j++ ) 
@@ -1305,16 +995,6 @@ void  FourNodeTetrahedron::formResidAndTangent( int tang_flag )
       //               |   0     N,3    N,2  |
       //               | N,3      0     N,1  |
 
-      //      B(0,0) = shp[0][node] ;
-      //      B(1,1) = shp[1][node] ;
-      //      B(2,2) = shp[2][node] ;
-      //      B(3,0) = shp[1][node] ;
-      //      B(3,1) = shp[0][node] ;
-      //      B(4,1) = shp[2][node] ;
-      //      B(4,2) = shp[1][node] ;
-      //      B(5,0) = shp[2][node] ;
-      //      B(5,2) = shp[0][node] ;
-
       double b00 = shp[0][j];
       double b11 = shp[1][j];
       double b22 = shp[2][j];
@@ -1325,76 +1005,89 @@ void  FourNodeTetrahedron::formResidAndTangent( int tang_flag )
       double b50 = shp[2][j];
       double b52 = shp[0][j];
 
-      residJ(0) = b00 * stress0 + b30 * stress3 + b50 * stress5;
-      residJ(1) = b11 * stress1 + b31 * stress3 + b41 * stress4;
-      residJ(2) = b22 * stress2 + b42 * stress4 + b52 * stress5;
-      
-      BJ = computeB( j, shp ) ;
-   
-      //transpose 
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) 
-      {
-        for (q=0; q<nstress; q++) 
-        {
-          BJtran(p,q) = BJ(q,p) ;
-        }
-      }//end for p
-
+      residJ[0] = b00 * stress0 + b30 * stress3 + b50 * stress5;
+      residJ[1] = b11 * stress1 + b31 * stress3 + b41 * stress4;
+      residJ[2] = b22 * stress2 + b42 * stress4 + b52 * stress5;
 
       //residual 
       for ( p = 0; p < ndf; p++ ) 
       {
-        resid( jj + p ) += residJ(p)  ;
+        resid( jj + p ) += residJ[p]  ;
         if (applyLoad == 0)
         {
-          resid( jj + p ) -= dvol[i]*b[p]*shp[3][j];
+          resid( jj + p ) -= dvol*b[p]*shp[3][j];
         }
         else
         {
-          resid( jj + p ) -= dvol[i]*appliedB[p]*shp[3][j];
+          resid( jj + p ) -= dvol*appliedB[p]*shp[3][j];
         }
       }
 
-      if ( tang_flag == 1 ) 
-      {
+      jj += ndf ;
+    } // end for j loop
 
-        //BJtranD = BJtran * dd ;
-        BJtranD.addMatrixProduct(0.0,  BJtran, dd,1.0) ;
-        // opserr << "DEBUUG!! BJtranD = " << BJtranD << endln;
-        // opserr << "DEBUUG!! dd = " << dd << endln;
+    if ( tang_flag == 1 ) 
+    {
+      computeB( shp, B ) ;
 
-        int kk = 0 ;
-        for ( k = 0; k < numberNodes; k++ ) 
-        {
-          // opserr << "DEBUUG!! k = " << k << endln;
+      //stiff += B' * dd * B * dvol
+      const Matrix &dd = materialPointers[i]->getTangent( ) ;
+      stiff.addMatrixTripleProduct( 1.0, B, dd, dvol ) ;
+    } // end if tang_flag 
 
-          BK = computeB( k, shp ) ;
-          stiffJK.addMatrixProduct(0.0,  BJtranD, BK,1.0) ;
+  } //end for i gauss loop 
 
-          // opserr << "DEBUUG!! BK = " << BK << endln;
-          // opserr << "DEBUUG!! stiffJK = " << stiffJK << endln;
+  return ;
+}
 
-          for ( p = 0; p < ndf; p++ )  
-          {
-            for ( q = 0; q < ndf; q++ )
-            {
-              stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-            }
-          } //end for p
-          kk += ndf ;
-        } // end for k loop
-        // opserr << "STIFF = " << stiff << endln;
-      } // end if tang_flag 
-      jj += ndf ;
-    } // end for j loop
-  } //end for i gauss loop 
 
-  
-  
+//************************************************************************
+//shape functions at the gauss point
 
+ShapeFunctionCache *
+FourNodeTetrahedron::getShapes( ) 
+{
+  if (theShapes != 0) {
+    if (shapesStamp == Node::getCrdsStamp())
+      return theShapes ;
+
+    //a node may have been moved without setDomain(), e.g. by
+    //setNodeCoord, look the cache up again for the new shape
+    ShapeFunctionCache::releaseCache(theShapes) ;
+    theShapes = 0 ;
+  }
 
-  return ;
+  static const int nShape = 4 ;
+
+  shapesStamp = Node::getCrdsStamp( ) ;
+  theShapes = ShapeFunctionCache::getCache( ELE_TAG_FourNodeTetrahedron, nodePointers, 
+                                            NumNodes, NumGaussPoints, nShape ) ;
+
+  if ( theShapes->isFormed( ) )
+    return theShapes ;
+
+  //compute basis vectors and local nodal coordinates
+  computeBasis( ) ;
+
+  double gaussPoint[3] ;
+  double xsj ;  // determinant jacaobian matrix 
+
+  // Just one Gauss point in a tet
+  gaussPoint[0] = sg[0] ;        
+  gaussPoint[1] = sg[0] ;        
+  gaussPoint[2] = sg[0] ;
+
+  //get shape functions    
+  shp3d( gaussPoint, xsj, 
+         reinterpret_cast<double (*)[NumNodes]>( theShapes->getShape(0) ), 
+         xl ) ;
+
+  //volume element to also be saved
+  theShapes->getWeight(0) = wg[0] * xsj ;  
+
+  theShapes->setFormed( ) ;
+
+  return theShapes ;
 }
 
 
@@ -1417,8 +1110,8 @@ void   FourNodeTetrahedron::computeBasis( )
 //*************************************************************************
 //compute B
 
-const Matrix&   
-FourNodeTetrahedron::computeB( int node, const double shp[4][4] )
+void
+FourNodeTetrahedron::computeB( const double shp[4][NumNodes], Matrix &B )
 {
 
 //---B Matrix in standard {1,2,3} mechanics notation---------
@@ -1426,28 +1119,30 @@ FourNodeTetrahedron::computeB( int node, const double shp[4][4] )
 //                -                   -
 //               | N,1      0     0    | 
 //   B       =   |   0     N,2    0    |
-//               |   0      0     N,3  |   (6x3)
+//               |   0      0     N,3  |   (6x3) for each node
 //               | N,2     N,1     0   |
 //               |   0     N,3    N,2  |
 //               | N,3      0     N,1  |
 //                -                   -       
 //
+// only the nonzero terms are set, B is zeroed by the caller
 //-------------------------------------------------------------------
 
-  B(0,0) = shp[0][node] ;
-  B(1,1) = shp[1][node] ;
-  B(2,2) = shp[2][node] ;
-
-  B(3,0) = shp[1][node] ;
-  B(3,1) = shp[0][node] ;
+  for ( int node = 0, col = 0; node < NumNodes; node++, col += 3 ) 
+  {
+    B(0,col  ) = shp[0][node] ;
+    B(1,col+1) = shp[1][node] ;
+    B(2,col+2) = shp[2][node] ;
 
-  B(4,1) = shp[2][node] ;
-  B(4,2) = shp[1][node] ;
+    B(3,col  ) = shp[1][node] ;
+    B(3,col+1) = shp[0][node] ;
 
-  B(5,0) = shp[2][node] ;
-  B(5,2) = shp[0][node] ;
+    B(4,col+1) = shp[2][node] ;
+    B(4,col+2) = shp[1][node] ;
 
-  return B ;
+    B(5,col  ) = shp[2][node] ;
+    B(5,col+2) = shp[0][node] ;
+  }
 
 }
 
@@ -49,6 +49,8 @@
 #include <Node.h>
 #include <NDMaterial.h>
 
+class ShapeFunctionCache;
+
 class FourNodeTetrahedron : public Element {
 
   public :
@@ -158,6 +160,9 @@ class FourNodeTetrahedron : public Element {
     Vector *load;
     Matrix *Ki;
 
+    ShapeFunctionCache *theShapes; // shape functions at the gauss point
+    int shapesStamp;               // Node::getCrdsStamp() theShapes was got at
+
     //
     // static attributes
     //
@@ -166,7 +171,6 @@ class FourNodeTetrahedron : public Element {
     static Vector resid ;
     static Matrix mass ;
     static Matrix damping ;
-  static Matrix B;
   
     //quadrature data
     static const double root3 ;
@@ -190,8 +194,11 @@ class FourNodeTetrahedron : public Element {
     //compute coordinate system
     void computeBasis( ) ;
 
-    //compute B matrix
-    const Matrix& computeB( int node, const double shp[4][NumNodes] ) ;
+    //shape functions at the gauss point, formed on first use
+    ShapeFunctionCache *getShapes( ) ;
+
+    //compute B matrix of all the nodes
+    void computeB( const double shp[4][NumNodes], Matrix &B ) ;
   
     //Matrix transpose
     Matrix transpose( int dim1, int dim2, const Matrix &M ) ;
@@ -40,6 +40,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <Vector.h>
+#include <MemoryReport.h>
 
 Graph::Graph()
   :myVertices(0), theVertexIter(0), numEdge(0), nextFreeTag(START_VERTEX_NUM),
@@ -368,6 +369,20 @@ Graph::merge(Graph &other) {
 }
 
 
+void
+Graph::reportMemory(MemoryReport &theReport, const char *subsystem)
+{
+  double bytes = sizeof(Graph) + vertices.capacity()*sizeof(Vertex *);
+
+  Vertex *vertexPtr;
+  VertexIter &theVertices = this->getVertices();
+  while ((vertexPtr = theVertices()) != 0)
+    bytes += sizeof(Vertex) + MemoryReport::getBytes(vertexPtr->getAdjacency());
+
+  theReport.add(subsystem, "Graph", bytes);
+}
+
+
 void 
 Graph::Print(OPS_Stream &s, int flag)
 {
@@ -45,6 +45,7 @@ class VertexIter;
 class TaggedObjectStorage;
 class Channel;
 class FEM_ObjectBroker;
+class MemoryReport;
 
 class Graph
 {
@@ -70,6 +71,7 @@ class Graph
     virtual int merge(Graph &other);
     
     virtual void Print(OPS_Stream &s, int flag =0);
+    virtual void reportMemory(MemoryReport &theReport, const char *subsystem);
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
 
@@ -302,22 +302,30 @@ DataFileStream::write(Vector &data)
   // if p0 recv the data & write it out sorted
   //
 
-  // recv data
-  for (int i=0; i<=sendSelfCount; i++) {
-
-    int numColumns = (*sizeColumns)(i);
-    double *dataI = theData[i];
-    if (i == 0) {
-      for (int j=0; j<numColumns; j++) {
-	dataI[j] = data(j);
+  // recv data, posting all the receives before copying the local data
+  static ID requests(0);
+  requests.resize(sendSelfCount+1);
+  for (int i=1; i<=sendSelfCount; i++) {
+    requests(i) = 0;
+    if ((*sizeColumns)(i) != 0) {
+      Vector *theV = theRemoteData[i];
+      requests(i) = theChannels[i-1]->irecvVector(0, 0, *theV);
+      if (requests(i) < 0)
+	opserr << "DataFileStream::write - failed to recv data\n";
+    }
+  }
+
+  int numColumns = (*sizeColumns)(0);
+  double *data0 = theData[0];
+  for (int j=0; j<numColumns; j++) {
+    data0[j] = data(j);
+  }
+
+  for (int i=1; i<=sendSelfCount; i++) {
+    if ((*sizeColumns)(i) != 0 && requests(i) >= 0) {
+      if (theChannels[i-1]->wait(requests(i)) < 0) {
+	opserr << "DataFileStream::write - failed to recv data\n";
       }
-    } else { 
-      if (numColumns != 0) {
-	Vector *theV = theRemoteData[i];
-	if (theChannels[i-1]->recvVector(0, 0, *theV) < 0) {
-	  opserr << "DataFileStream::write - failed to recv data\n";
-	}
-      } 
     }
   }
 
@@ -53,6 +53,9 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <BeamIntegration.h>
 #include <NodalLoad.h>
 #include <AnalysisModel.h>
+#include <MemoryReport.h>
+#include <Profiler.h>
+#include <LinearSOESolver.h>
 #include <PlainHandler.h>
 #include <RCM.h>
 #include <AMDNumberer.h>
@@ -101,6 +104,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <RegulaFalsiLineSearch.h>
 #include <NewtonLineSearch.h>
 #include <FileDatastore.h>
+#include <LogDatastore.h>
 #include <Mesh.h>
 #ifdef _MUMPS
 #include <MumpsSolver.h>
@@ -994,6 +998,16 @@ OpenSeesCommands::setFileDatabase(const char* filename)
     }
 }
 
+void
+OpenSeesCommands::setLogDatabase(const char* filename, bool compress, int bufferSize)
+{
+    if (theDatabase != 0) delete theDatabase;
+    theDatabase = new LogDatastore(filename, *theDomain, theBroker, compress, bufferSize);
+    if (theDatabase == 0) {
+	opserr << "WARNING ran out of memory - database Log " << filename << endln;
+    }
+}
+
 /////////////////////////////
 //// OpenSees APIs  /// /////
 /////////////////////////////
@@ -1773,6 +1787,9 @@ int OPS_Integrator()
     } else if (strcmp(type,"CentralDifferenceNoDamping") == 0) {
 	ti = (TransientIntegrator*)OPS_CentralDifferenceNoDamping();
 
+    } else if (strcmp(type,"ModalSuperposition") == 0) {
+	ti = (TransientIntegrator*)OPS_ModalSuperposition();
+
 	} else if (strcmp(type, "ExplicitDifference") == 0) {
     ti = (TransientIntegrator*)OPS_ExplicitDifference();
 
@@ -2031,6 +2048,61 @@ int OPS_analyze() {
   return 0;
 }
 
+// analyzeLoadCases patternTag1 patternTag2 ... <-noFlush>
+//   runs a linear static step for each load pattern on its own,
+//   factoring the tangent only once with algorithm Linear and
+//   integrator LoadControl
+int OPS_analyzeLoadCases()
+{
+  if (cmds == 0) return 0;
+
+  StaticAnalysis* theStaticAnalysis = cmds->getStaticAnalysis();
+  if (theStaticAnalysis == 0) {
+    opserr << "WARNING analyzeLoadCases - no static analysis has been specified\n";
+    return -1;
+  }
+
+  std::vector<int> tags;
+  bool flush = true;
+  int numdata = 1;
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char* opt = OPS_GetString();
+    if (strcmp(opt, "-noFlush") == 0) {
+      flush = false;
+      continue;
+    }
+    OPS_ResetCurrentInputArg(-1);
+    int tag;
+    if (OPS_GetIntInput(&numdata, &tag) < 0) {
+      opserr << "WARNING analyzeLoadCases - invalid pattern tag\n";
+      return -1;
+    }
+    tags.push_back(tag);
+  }
+
+  if (tags.empty()) {
+    opserr << "WARNING insufficient args: analyzeLoadCases patternTag1 patternTag2 ... <-noFlush>\n";
+    return -1;
+  }
+
+  ID patternTags((int)tags.size());
+  for (int i = 0; i < (int)tags.size(); i++)
+    patternTags(i) = tags[i];
+
+  int result = theStaticAnalysis->analyzeLoadCases(patternTags, flush);
+  if (result < 0) {
+    opserr << "OpenSees > analyzeLoadCases failed, returned: " << result
+           << " error flag\n";
+  }
+
+  if (OPS_SetIntOutput(&numdata, &result, true) < 0) {
+    opserr << "WARNING failed to set output\n";
+    return -1;
+  }
+
+  return 0;
+}
+
 int OPS_eigenAnalysis()
 {
     static bool warning_displayed = false;
@@ -2908,7 +2980,7 @@ int OPS_Database()
     if (cmds == 0) return 0;
     // make sure at least one other argument to contain integrator
     if (OPS_GetNumRemainingInputArgs() < 1) {
-	opserr << "WARNING need to specify a Database type; valid type File, MySQL, BerkeleyDB \n";
+	opserr << "WARNING need to specify a Database type; valid type File, Log, MySQL, BerkeleyDB \n";
 	return -1;
     }
 
@@ -2928,6 +3000,35 @@ int OPS_Database()
 	const char* filename = OPS_GetString();
 	cmds->setFileDatabase(filename);
 
+	return 0;
+
+    } else if (strcmp(type,"Log") == 0) {
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+	    opserr << "WARNING database Log fileName? <-compress> <-buffer numBytes?>\n";
+	    return -1;
+	}
+
+	const char* filename = OPS_GetString();
+	bool compress = false;
+	int bufferSize = 4*1024*1024;
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* opt = OPS_GetString();
+	    if (strcmp(opt,"-compress") == 0) {
+		compress = true;
+	    } else if (strcmp(opt,"-buffer") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+		int numData = 1;
+		if (OPS_GetIntInput(&numData, &bufferSize) < 0) {
+		    opserr << "WARNING database Log - invalid buffer size\n";
+		    return -1;
+		}
+	    } else {
+		opserr << "WARNING database Log - unknown option " << opt << endln;
+		return -1;
+	    }
+	}
+
+	cmds->setLogDatabase(filename, compress, bufferSize);
+
 	return 0;
     }
     opserr << "WARNING No database type exists ";
@@ -3499,6 +3600,111 @@ int OPS_systemSize()
     return 0;
 }
 
+// memoryUsage <-print> <-detail>
+//   returns the bytes held by each subsystem of the model and analysis
+int OPS_memoryUsage()
+{
+    if (cmds == 0) return 0;
+
+    bool print = false;
+    int flag = 0;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+	if (strcmp(opt, "-print") == 0) {
+	    print = true;
+	} else if (strcmp(opt, "-detail") == 0) {
+	    print = true;
+	    flag = 1;
+	} else {
+	    opserr << "WARNING memoryUsage <-print> <-detail> - unknown option " << opt << "\n";
+	    return -1;
+	}
+    }
+
+    MemoryReport theReport;
+    cmds->getDomain()->reportMemory(theReport);
+
+    AnalysisModel* theModel = *(cmds->getAnalysisModel());
+    if (theModel != 0)
+	theModel->reportMemory(theReport);
+
+    LinearSOE* theSOE = cmds->getSOE();
+    if (theSOE != 0) {
+	theSOE->reportMemory(theReport);
+	if (theSOE->getSolver() != 0)
+	    theSOE->getSolver()->reportMemory(theReport);
+    }
+
+    if (print)
+	theReport.Print(opserr, flag);
+
+    // the totals are also kept with the profile
+    std::vector<std::string> names;
+    theReport.getSubsystems(names);
+    std::map<const char*, double> data;
+    for (int i = 0; i < (int)names.size(); i++) {
+	double bytes = theReport.getBytes(names[i].c_str());
+	data[names[i].c_str()] = bytes;
+	Profiler::setMemory(names[i].c_str(), bytes);
+    }
+    data["total"] = theReport.getTotal();
+    Profiler::setMemory("total", theReport.getTotal());
+
+    if (OPS_SetDoubleDictOutput(data) < 0) {
+	opserr << "WARNING memoryUsage - failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+// profile on <-trace> | off | reset | print | write $fileName | trace $fileName
+int OPS_profile()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING want profile on <-trace> | off | reset | print | write $fileName | trace $fileName\n";
+	return -1;
+    }
+
+    const char* opt = OPS_GetString();
+    if (strcmp(opt, "on") == 0 || strcmp(opt, "start") == 0) {
+#ifndef _PROFILER
+	opserr << "WARNING profile - built without _PROFILER, no phases will be timed\n";
+#endif
+	bool trace = false;
+	if (OPS_GetNumRemainingInputArgs() > 0)
+	    trace = strcmp(OPS_GetString(), "-trace") == 0;
+	Profiler::setTracing(trace);
+	Profiler::setEnabled(true);
+
+    } else if (strcmp(opt, "off") == 0 || strcmp(opt, "stop") == 0) {
+	Profiler::setEnabled(false);
+
+    } else if (strcmp(opt, "reset") == 0) {
+	Profiler::reset();
+
+    } else if (strcmp(opt, "print") == 0) {
+	Profiler::Print(opserr);
+
+    } else if (strcmp(opt, "write") == 0 || strcmp(opt, "trace") == 0) {
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+	    opserr << "WARNING want profile " << opt << " $fileName\n";
+	    return -1;
+	}
+	bool write = strcmp(opt, "write") == 0;
+	const char* fileName = OPS_GetString();
+	int res = write ? Profiler::writeJSON(fileName) : Profiler::writeTrace(fileName);
+	if (res < 0)
+	    return -1;
+
+    } else {
+	opserr << "WARNING profile - unknown option '" << opt << "'\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int OPS_domainCommitTag() {
     if (cmds == 0) {
         return 0;
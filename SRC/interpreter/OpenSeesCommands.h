@@ -145,6 +145,7 @@ public:
     EigenSOE** getEigenSOEPointer() {return &theEigenSOE;}
 
     void setFileDatabase(const char* filename);
+    void setLogDatabase(const char* filename, bool compress, int bufferSize);
     FE_Datastore* getDatabase() {return theDatabase;}
 
     Timer* getTimer() {return &theTimer;}
@@ -371,8 +372,11 @@ int OPS_send();
 int OPS_recv();
 int OPS_Bcast();
 int OPS_sdfResponse();
+int OPS_sdfSpectrum();
 int OPS_getNumThreads();
 int OPS_setNumThreads();
+int OPS_elementThreads();
+int OPS_sectionThreads();
 int OPS_setStartNodeTag();
 int OPS_partition();
 
@@ -425,6 +429,7 @@ int OPS_Integrator();
 int OPS_Algorithm();
 int OPS_Analysis();
 int OPS_analyze();
+int OPS_analyzeLoadCases();
 int OPS_eigenAnalysis();
 int OPS_resetModel();
 int OPS_initializeAnalysis();
@@ -448,6 +453,8 @@ int OPS_numFact();
 int OPS_numIter();
 int* OPS_GetNumEigen();
 int OPS_systemSize();
+int OPS_memoryUsage();
+int OPS_profile();
 int OPS_domainCommitTag();
 
 void* OPS_KrylovNewton();
@@ -570,6 +577,7 @@ void* OPS_WilsonTheta();
 void* OPS_CentralDifference();
 void* OPS_CentralDifferenceAlternative();
 void* OPS_CentralDifferenceNoDamping();
+void* OPS_ModalSuperposition();
 void* OPS_ExplicitDifference();
 
 void* OPS_LinearAlgorithm();
@@ -109,6 +109,7 @@ void* OPS_E_SFI();
 void* OPS_MEFI();
 void* OPS_MultiFP2d();
 void* OPS_ShellMITC4();
+void* OPS_CondensedSubstructure();
 void* OPS_ShellMITC9();
 void* OPS_ShellDKGQ();
 void* OPS_ShellDKGT();
@@ -744,6 +745,7 @@ namespace {
 	functionMap.insert(std::make_pair("Shell", &OPS_ShellMITC4));
 	functionMap.insert(std::make_pair("shellMITC4", &OPS_ShellMITC4));
 	functionMap.insert(std::make_pair("ShellMITC4", &OPS_ShellMITC4));
+	functionMap.insert(std::make_pair("condensedSubstructure", &OPS_CondensedSubstructure));
 	functionMap.insert(std::make_pair("shellNL", &OPS_ShellMITC9));
 	functionMap.insert(std::make_pair("ShellNL", &OPS_ShellMITC9));
 	functionMap.insert(std::make_pair("shellMITC9", &OPS_ShellMITC9));
@@ -56,6 +56,8 @@
 #include <TetMesh.h>
 #include <BackgroundMesh.h>
 #include <Damping.h>
+#include <ElementCostModel.h>
+#include <SectionForceDeformation.h>
 
 #ifdef _PARALLEL_INTERPRETERS
 #include <mpi.h>
@@ -1947,6 +1949,94 @@ int OPS_setNumThreads()
     return 0;
 }
 
+// elementThreads $numThreads <-samples $numSamples> <-imbalance $factor>
+// elementThreads -print
+int OPS_elementThreads()
+{
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING: need elementThreads numThreads <-samples numSamples> <-imbalance factor>\n";
+	return -1;
+    }
+
+    const char* first = OPS_GetString();
+    if (strcmp(first, "-print") == 0) {
+	ElementCostModel* theModel = theDomain->getElementCostModel();
+	if (theModel != 0)
+	    theModel->Print(opserr);
+	return 0;
+    }
+    OPS_ResetCurrentInputArg(-1);
+
+    int numThreads;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &numThreads) < 0) {
+	opserr << "WARNING: invalid numThreads -- elementThreads\n";
+	return -1;
+    }
+
+    int numSamples = 2;
+    double factor = 1.2;
+    while (OPS_GetNumRemainingInputArgs() > 1) {
+	const char* opt = OPS_GetString();
+	if (strcmp(opt, "-samples") == 0) {
+	    if (OPS_GetIntInput(&numdata, &numSamples) < 0) {
+		opserr << "WARNING: invalid numSamples -- elementThreads\n";
+		return -1;
+	    }
+	} else if (strcmp(opt, "-imbalance") == 0) {
+	    if (OPS_GetDoubleInput(&numdata, &factor) < 0) {
+		opserr << "WARNING: invalid factor -- elementThreads\n";
+		return -1;
+	    }
+	} else {
+	    opserr << "WARNING: unknown option " << opt << " -- elementThreads\n";
+	    return -1;
+	}
+    }
+
+#ifndef _OPENMP
+    if (numThreads > 1)
+	opserr << "WARNING: built without OpenMP, elements are updated on one thread -- elementThreads\n";
+#endif
+
+    // one thread is the plain element loop of the domain
+    if (numThreads <= 1)
+	theDomain->setElementCostModel(0);
+    else
+	theDomain->setElementCostModel(new ElementCostModel(numThreads, numSamples, factor));
+
+    return 0;
+}
+
+// sectionThreads $numThreads
+// the sections of a force-based beam are set on numThreads threads
+int OPS_sectionThreads()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING: need sectionThreads numThreads\n";
+	return -1;
+    }
+
+    int numThreads;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &numThreads) < 0) {
+	opserr << "WARNING: invalid numThreads -- sectionThreads\n";
+	return -1;
+    }
+
+#ifndef _OPENMP
+    if (numThreads > 1)
+	opserr << "WARNING: built without OpenMP, sections are set on one thread -- sectionThreads\n";
+#endif
+
+    SectionForceDeformation::setNumBatchThreads(numThreads);
+
+    return 0;
+}
+
 int OPS_setStartNodeTag() {
     if (OPS_GetNumRemainingInputArgs() < 1) {
         opserr << "WARNING: needs tag\n";
@@ -2628,6 +2628,7 @@ int OPS_gradientEvaluator() {
     const char *type = OPS_GetString();
     if (strcmp(type, "FiniteDifference") == 0) {
         double perturbationFactor = 1000.0;
+        int numProcesses = 1;
         // bool doGradientCheck = false;
         while (OPS_GetNumRemainingInputArgs() > 0) {
             const char *arg = OPS_GetString();
@@ -2641,6 +2642,14 @@ int OPS_gradientEvaluator() {
                     return -1;
                 }
             }
+            if (strcmp(arg, "-np") == 0 &&
+                OPS_GetNumRemainingInputArgs() > 0) {
+                if (OPS_GetIntInput(&numdata, &numProcesses) < 0) {
+                    opserr << "ERROR: unable to read -np value for "
+                           << type << " gradient evaluator" << endln;
+                    return -1;
+                }
+            }
             if (strcmp(arg, "-check") == 0) {
                 // doGradientCheck = true;
             }
@@ -2657,7 +2666,7 @@ int OPS_gradientEvaluator() {
         }
 
         theEval = new FiniteDifferenceGradient(theEvaluator, theRelDomain,
-                                               theStrDomain);
+                                               theStrDomain, numProcesses);
     } else if (strcmp(type, "OpenSees") == 0 ||
                strcmp(type, "Implicit") == 0) {
         // bool doGradientCheck = false;
@@ -525,6 +525,18 @@ static PyObject *Py_ops_analyze(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_analyzeLoadCases(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_analyzeLoadCases() < 0) {
+	opserr<<(void*)0;
+	return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_test(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1937,6 +1949,30 @@ static PyObject *Py_ops_systemSize(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_memoryUsage(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_memoryUsage() < 0) {
+	opserr<<(void*)0;
+	return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_profile(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_profile() < 0) {
+	opserr<<(void*)0;
+	return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_version(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -2739,6 +2775,18 @@ static PyObject *Py_ops_sdfResponse(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_sdfSpectrum(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_sdfSpectrum() < 0) {
+	opserr<<(void*)0;
+	return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_getNumThreads(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -2763,6 +2811,30 @@ static PyObject *Py_ops_setNumThreads(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_elementThreads(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_elementThreads() < 0) {
+	opserr<<(void*)0;
+	return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_sectionThreads(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_sectionThreads() < 0) {
+	opserr<<(void*)0;
+	return NULL;
+    }
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_logFile(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -2998,6 +3070,7 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("algorithm", &Py_ops_algorithm);
     addCommand("analysis", &Py_ops_analysis);
     addCommand("analyze", &Py_ops_analyze);
+    addCommand("analyzeLoadCases", &Py_ops_analyzeLoadCases);
     addCommand("test", &Py_ops_test);
     addCommand("section", &Py_ops_section);
     addCommand("fiber", &Py_ops_fiber);
@@ -3117,6 +3190,8 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("numFact", &Py_ops_numFact);
     addCommand("numIter", &Py_ops_numIter);
     addCommand("systemSize", &Py_ops_systemSize);
+    addCommand("memoryUsage", &Py_ops_memoryUsage);
+    addCommand("profile", &Py_ops_profile);
     addCommand("version", &Py_ops_version);
     addCommand("pyversion", &Py_ops_pyversion);
     addCommand("setMaxOpenFiles", &Py_ops_setMaxOpenFiles);
@@ -3176,6 +3251,7 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("wipeReliability", &Py_ops_wipeReliability);
     addCommand("updateMaterialStage", &Py_ops_updateMaterialStage);
     addCommand("sdfResponse", &Py_ops_sdfResponse);
+    addCommand("sdfSpectrum", &Py_ops_sdfSpectrum);
     addCommand("probabilityTransformation", &Py_ops_probabilityTransformation);
     addCommand("startPoint", &Py_ops_startPoint);
     addCommand("randomNumberGenerator", &Py_ops_randomNumberGenerator);
@@ -3188,6 +3264,8 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("gradientEvaluator", &Py_ops_gradientEvaluator);
     addCommand("getNumThreads", &Py_ops_getNumThreads);
     addCommand("setNumThreads", &Py_ops_setNumThreads);
+    addCommand("elementThreads", &Py_ops_elementThreads);
+    addCommand("sectionThreads", &Py_ops_sectionThreads);
     addCommand("logFile", &Py_ops_logFile);
     addCommand("setStartNodeTag", &Py_ops_setStartNodeTag);
     addCommand("hystereticBackbone", &Py_ops_hystereticBackbone);
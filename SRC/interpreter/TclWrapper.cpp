@@ -277,6 +277,14 @@ static int Tcl_ops_analyze(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_analyzeLoadCases(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_analyzeLoadCases() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
 static int Tcl_ops_nodeDisp(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1061,6 +1069,22 @@ static int Tcl_ops_systemSize(ClientData clientData, Tcl_Interp *interp, int arg
     return TCL_OK;
 }
 
+static int Tcl_ops_memoryUsage(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_memoryUsage() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
+static int Tcl_ops_profile(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_profile() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
 static int Tcl_ops_version(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1586,6 +1610,15 @@ static int Tcl_ops_sdfResponse(ClientData clientData, Tcl_Interp *interp, int ar
     return TCL_OK;
 }
 
+static int Tcl_ops_sdfSpectrum(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv)
+{
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_sdfSpectrum() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
 static int Tcl_ops_getNumThreads(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv)
 {
     wrapper->resetCommandLine(argc, 1, argv);
@@ -1604,6 +1637,24 @@ static int Tcl_ops_setNumThreads(ClientData clientData, Tcl_Interp *interp, int
     return TCL_OK;
 }
 
+static int Tcl_ops_elementThreads(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv)
+{
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_elementThreads() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
+static int Tcl_ops_sectionThreads(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv)
+{
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_sectionThreads() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
 static int Tcl_ops_logFile(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv)
 {
     wrapper->resetCommandLine(argc, 1, argv);
@@ -1695,6 +1746,7 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"algorithm", &Tcl_ops_algorithm);
     addCommand(interp,"analysis", &Tcl_ops_analysis);
     addCommand(interp,"analyze", &Tcl_ops_analyze);
+    addCommand(interp,"analyzeLoadCases", &Tcl_ops_analyzeLoadCases);
     addCommand(interp,"test", &Tcl_ops_test);
     addCommand(interp,"section", &Tcl_ops_section);
     addCommand(interp,"fiber", &Tcl_ops_fiber);
@@ -1792,6 +1844,8 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"numFact", &Tcl_ops_numFact);
     addCommand(interp,"numIter", &Tcl_ops_numIter);
     addCommand(interp,"systemSize", &Tcl_ops_systemSize);
+    addCommand(interp,"memoryUsage", &Tcl_ops_memoryUsage);
+    addCommand(interp,"profile", &Tcl_ops_profile);
     addCommand(interp,"version", &Tcl_ops_version);
     addCommand(interp,"setMaxOpenFiles", &Tcl_ops_setMaxOpenFiles);
     addCommand(interp,"limitCurve", &Tcl_ops_limitCurve);
@@ -1843,6 +1897,7 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"performanceFunction", &Tcl_ops_performanceFunction);    
     addCommand(interp,"updateMaterialStage", &Tcl_ops_updateMaterialStage);
     addCommand(interp,"sdfResponse", &Tcl_ops_sdfResponse);
+    addCommand(interp,"sdfSpectrum", &Tcl_ops_sdfSpectrum);
     addCommand(interp,"probabilityTransformation", &Tcl_ops_probabilityTransformation);
     addCommand(interp,"startPoint", &Tcl_ops_startPoint);
     addCommand(interp,"randomNumberGenerator", &Tcl_ops_randomNumberGenerator);
@@ -1855,6 +1910,8 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"gradientEvaluator", &Tcl_ops_gradientEvaluator);
     addCommand(interp,"getNumThreads", &Tcl_ops_getNumThreads);
     addCommand(interp,"setNumThreads", &Tcl_ops_setNumThreads);
+    addCommand(interp,"elementThreads", &Tcl_ops_elementThreads);
+    addCommand(interp,"sectionThreads", &Tcl_ops_sectionThreads);
     addCommand(interp,"logFile", &Tcl_ops_logFile);
     addCommand(interp,"setStartNodeTag", &Tcl_ops_setStartNodeTag);
     addCommand(interp,"hystereticBackbone", &Tcl_ops_hystereticBackbone);
@@ -32,6 +32,7 @@
 // What: "@(#) MaterialModel.C, revA"
 
 #include <Material.h>
+#include <MemoryReport.h>
 
 Material::Material(int tag, int clasTag)
 :TaggedObject(tag), MovableObject(clasTag)
@@ -65,3 +66,10 @@ Material::getResponseSensitivity(int responseID, int gradIndex,
 {
   return -1;
 }
+
+void
+Material::reportMemory(MemoryReport &theReport)
+{
+  // the size of a subclass is unknown here, the material is only counted
+  theReport.add("material", this->getClassType(), 0.0);
+}
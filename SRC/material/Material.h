@@ -43,6 +43,7 @@
 class OPS_Stream;
 class Information;
 class Response;
+class MemoryReport;
 
 class Material : public TaggedObject, public MovableObject
 {
@@ -59,6 +60,9 @@ class Material : public TaggedObject, public MovableObject
     // method for this material to update itself according to its new parameters
     virtual void update(void) {return;}
 
+    // method to add the bytes held by the material to a memory report
+    virtual void reportMemory(MemoryReport &theReport);
+
   protected:
     
   private:
@@ -42,6 +42,7 @@
 #include <FEM_ObjectBroker.h>
 #include <Information.h>
 #include <MaterialResponse.h>
+#include <MemoryReport.h>
 #include <UniaxialMaterial.h>
 #include <SectionIntegration.h>
 #include <elementAPI.h>
@@ -370,21 +371,24 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   static double fiberLocs[10000];
   static double fiberArea[10000];
 
+  // fibers are read from matData in place rather than through the
+  // shared buffers, so that sections can be set concurrently
+  const double *locs = matData;
+  const double *areas = matData+1;
+  int stride = 2;
+
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
     sectionIntegr->getFiberWeights(numFibers, fiberArea);
+    locs = fiberLocs;
+    areas = fiberArea;
+    stride = 1;
   }  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
-    }
-  }
   
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
-    double y = fiberLocs[i] - yBar;
-    double A = fiberArea[i];
+    double y = locs[stride*i] - yBar;
+    double A = areas[stride*i];
 
     // determine material strain and set it
     double strain = d0 - y*d1;
@@ -1492,3 +1496,29 @@ double FiberSection2d::getEnergy() const
 	}
 	return energy;
 }
+
+void
+FiberSection2d::reportMemory(MemoryReport &theReport)
+{
+  // s and ks wrap sData and kData, the fiber data is 2 doubles a fiber
+  double bytes = sizeof(FiberSection2d) + sizeFibers*(sizeof(UniaxialMaterial *) + 2*sizeof(double))
+    + e.Size()*sizeof(double) + sizeof(Vector) + sizeof(Matrix);
+  theReport.add("section", "FiberSection2d", bytes);
+
+  for (int i = 0; i < numFibers; i++)
+    theMaterials[i]->reportMemory(theReport);
+}
+
+bool
+FiberSection2d::isReentrant(void)
+{
+  // the section integration shares class wide fiber buffers
+  if (sectionIntegr != 0)
+    return false;
+
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->isReentrant() == false)
+      return false;
+
+  return true;
+}
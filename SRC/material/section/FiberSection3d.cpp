@@ -41,6 +41,7 @@
 #include <FEM_ObjectBroker.h>
 #include <Information.h>
 #include <MaterialResponse.h>
+#include <MemoryReport.h>
 #include <UniaxialMaterial.h>
 #include <ElasticMaterial.h>
 #include <SectionIntegration.h>
@@ -449,26 +450,28 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   static double yLocs[10000];
   static double zLocs[10000];
   static double fiberArea[10000];
+
+  // fibers are read from matData in place rather than through the
+  // shared buffers, so that sections can be set concurrently
+  const double *ys = matData;
+  const double *zs = matData+1;
+  const double *areas = matData+2;
+  int stride = 3;
  
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
     sectionIntegr->getFiberWeights(numFibers, fiberArea);
+    ys = yLocs;
+    zs = zLocs;
+    areas = fiberArea;
+    stride = 1;
   }  
-  else {
-	
-    for (int i = 0; i < numFibers; i++) {
-		
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
-    }
-  }
  
   double tangent, stress;
   for (int i = 0; i < numFibers; i++) {
-    double y = yLocs[i] - yBar;
-    double z = zLocs[i] - zBar;
-    double A = fiberArea[i];
+    double y = ys[stride*i] - yBar;
+    double z = zs[stride*i] - zBar;
+    double A = areas[stride*i];
 
     // determine material strain and set it
     double strain = d0 - y*d1 + z*d2;
@@ -1666,3 +1669,34 @@ double FiberSection3d::getEnergy() const
 	}
 	return energy;
 }
+
+void
+FiberSection3d::reportMemory(MemoryReport &theReport)
+{
+  // s and ks wrap sData and kData, the fiber data is 3 doubles a fiber
+  double bytes = sizeof(FiberSection3d) + sizeFibers*(sizeof(UniaxialMaterial *) + 3*sizeof(double))
+    + e.Size()*sizeof(double) + sizeof(Vector) + sizeof(Matrix);
+  theReport.add("section", "FiberSection3d", bytes);
+
+  for (int i = 0; i < numFibers; i++)
+    theMaterials[i]->reportMemory(theReport);
+  if (theTorsion != 0)
+    theTorsion->reportMemory(theReport);
+}
+
+bool
+FiberSection3d::isReentrant(void)
+{
+  // the section integration shares class wide fiber buffers
+  if (sectionIntegr != 0)
+    return false;
+
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->isReentrant() == false)
+      return false;
+
+  if (theTorsion != 0 && theTorsion->isReentrant() == false)
+    return false;
+
+  return true;
+}
@@ -75,6 +75,8 @@ class FiberSection3d : public SectionForceDeformation
     int recvSelf(int cTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);
     void Print(OPS_Stream &s, int flag = 0);
+    void reportMemory(MemoryReport &theReport);
+    bool isReentrant(void);
 	    
     Response *setResponse(const char **argv, int argc, 
 			  OPS_Stream &s);
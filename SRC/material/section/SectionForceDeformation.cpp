@@ -36,6 +36,7 @@
 #include <Matrix.h>
 #include <Vector.h>
 #include <MaterialResponse.h>
+#include <MemoryReport.h>
 
 #include <elementAPI.h>
 #include <DummyStream.h>
@@ -44,12 +45,18 @@
 
 #include <string.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 #include <MapOfTaggedObjectsIter.h>
 
 static MapOfTaggedObjects theSectionForceDeformationObjects;
 
+int SectionForceDeformation::numBatchThreads = 1;
+
 bool OPS_addSectionForceDeformation(SectionForceDeformation *newComponent) {
   return theSectionForceDeformationObjects.addComponent(newComponent);
 }
@@ -937,3 +944,61 @@ const Vector& SectionForceDeformation::getThermalElong(void)
     errRes.resize(this->getStressResultant().Size());
     return errRes;
 }
+
+void
+SectionForceDeformation::reportMemory(MemoryReport &theReport)
+{
+  // the size of a subclass is unknown here, the section is only counted
+  theReport.add("section", this->getClassType(), 0.0);
+}
+
+// setTrialSectionDeformations():
+//      with more than one batch thread the sections are set on the
+//      threads if they are all reentrant, i.e. setTrialSectionDeformation()
+//      only modifies the state of the section itself. The resultants and
+//      flexibilities are gathered afterwards on the calling thread, as
+//      the default flexibility is inverted with the work area shared by
+//      all Matrix objects.
+int
+SectionForceDeformation::setTrialSectionDeformations(int numSections,
+						     SectionForceDeformation **theSections,
+						     const Vector *vs, Vector *s, Matrix *fs)
+{
+  int numFailed = 0;
+
+#ifdef _OPENMP
+  bool reentrant = (numBatchThreads > 1 && numSections > 1);
+  for (int i = 0; reentrant && i < numSections; i++)
+    reentrant = theSections[i]->isReentrant();
+
+  if (reentrant) {
+#pragma omp parallel for schedule(static) num_threads(numBatchThreads) reduction(+:numFailed)
+    for (int i = 0; i < numSections; i++)
+      if (theSections[i]->setTrialSectionDeformation(vs[i]) < 0)
+	numFailed++;
+  } else
+#endif
+  for (int i = 0; i < numSections; i++)
+    if (theSections[i]->setTrialSectionDeformation(vs[i]) < 0)
+      numFailed++;
+
+  for (int i = 0; i < numSections; i++) {
+    s[i] = theSections[i]->getStressResultant();
+    if (fs != 0)
+      fs[i] = theSections[i]->getSectionFlexibility();
+  }
+
+  return (numFailed > 0) ? -1 : 0;
+}
+
+void
+SectionForceDeformation::setNumBatchThreads(int numThreads)
+{
+  numBatchThreads = (numThreads < 1) ? 1 : numThreads;
+}
+
+int
+SectionForceDeformation::getNumBatchThreads(void)
+{
+  return numBatchThreads;
+}
@@ -44,6 +44,7 @@
 
 class Information;
 class Response;
+class MemoryReport;
 
 #define MAX_SECTION_RESPONSE_ID 10000
 
@@ -126,12 +127,29 @@ class SectionForceDeformation : public Material
   virtual const Vector& getThermalElong(void);
   virtual double getEnergy() const { return 0; };		//by SAJalali
 
+  virtual void reportMemory(MemoryReport &theReport);
+
+  // sections whose setTrialSectionDeformation() only writes their own
+  // state, and no class wide work areas, return true
+  virtual bool isReentrant(void) {return false;};
+
+  // state determination of the sections of an element at once, e.g. at
+  // the integration points of a beam: sets the trial deformations vs[i]
+  // of theSections[i] and returns their stress resultants in s[i] and
+  // flexibilities in fs[i] (if fs is not 0); the sections are only
+  // set on threads when all of them are reentrant
+  static int setTrialSectionDeformations(int numSections,
+					 SectionForceDeformation **theSections,
+					 const Vector *vs, Vector *s, Matrix *fs = 0);
+  static void setNumBatchThreads(int numThreads);
+  static int getNumBatchThreads(void);
+
  protected:
   Matrix *fDefault;	// Default flexibility matrix
   Vector *sDefault;
   
  private:
-
+  static int numBatchThreads;
 };
 
 extern bool OPS_addSectionForceDeformation(SectionForceDeformation *newComponent);
@@ -68,6 +68,7 @@ class Concrete01 : public UniaxialMaterial
 	       FEM_ObjectBroker &theBroker);    
   
   void Print(OPS_Stream &s, int flag =0);
+  bool isReentrant(void) {return true;}
   
   // AddingSensitivity:BEGIN //////////////////////////////////////////
   int    setParameter             (const char **argv, int argc, Parameter &param);
@@ -47,6 +47,7 @@
 #include <Information.h>
 
 #include <elementAPI.h>
+#include <MemoryReport.h>
 #include <OPS_Globals.h>
 
 void *
@@ -506,3 +507,9 @@ Concrete02::getVariable(const char *varName, Information &theInfo)
   } else
     return -1;
 }
+
+void
+Concrete02::reportMemory(MemoryReport &theReport)
+{
+  theReport.add("material", "Concrete02", sizeof(Concrete02));
+}
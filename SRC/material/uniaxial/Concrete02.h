@@ -72,6 +72,8 @@ class Concrete02 : public UniaxialMaterial
 		 FEM_ObjectBroker &theBroker);    
     
     void Print(OPS_Stream &s, int flag =0);
+    void reportMemory(MemoryReport &theReport);
+    bool isReentrant(void) {return true;}
 
     int getVariable(const char *variable, Information &);
     
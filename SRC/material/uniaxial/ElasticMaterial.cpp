@@ -40,6 +40,7 @@
 #include <string.h>
 
 #include <OPS_Globals.h>
+#include <MemoryReport.h>
 
 #include <elementAPI.h>
 
@@ -386,3 +387,9 @@ ElasticMaterial::commitSensitivity(double strainGradient,
   // Nothing to commit ... path independent
   return 0;
 }
+
+void
+ElasticMaterial::reportMemory(MemoryReport &theReport)
+{
+  theReport.add("material", "ElasticMaterial", sizeof(ElasticMaterial));
+}
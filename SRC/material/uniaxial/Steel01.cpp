@@ -47,6 +47,7 @@
 
 #include <elementAPI.h>
 #include <OPS_Globals.h>
+#include <MemoryReport.h>
 
 
 void *
@@ -835,3 +836,8 @@ Steel01::commitSensitivity(double TstrainSensitivity, int gradIndex, int numGrad
 
 // AddingSensitivity:END /////////////////////////////////////////////
 
+void
+Steel01::reportMemory(MemoryReport &theReport)
+{
+  theReport.add("material", "Steel01", sizeof(Steel01));
+}
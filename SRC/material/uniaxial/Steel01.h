@@ -75,6 +75,8 @@ class Steel01 : public UniaxialMaterial
 		 FEM_ObjectBroker &theBroker);    
     
     void Print(OPS_Stream &s, int flag =0);
+    void reportMemory(MemoryReport &theReport);
+    bool isReentrant(void) {return true;}
     
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int setParameter(const char **argv, int argc, Parameter &param);
@@ -46,6 +46,7 @@
 
 #include <elementAPI.h>
 #include <OPS_Globals.h>
+#include <MemoryReport.h>
 
 
 void *
@@ -668,4 +669,8 @@ Steel02::updateParameter(int parameterID, Information &info)
   return 0;
 }
 
-
+void
+Steel02::reportMemory(MemoryReport &theReport)
+{
+  theReport.add("material", "Steel02", sizeof(Steel02));
+}
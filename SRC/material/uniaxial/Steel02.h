@@ -81,6 +81,8 @@ class Steel02 : public UniaxialMaterial
 		 FEM_ObjectBroker &theBroker);    
     
     void Print(OPS_Stream &s, int flag =0);
+    void reportMemory(MemoryReport &theReport);
+    bool isReentrant(void) {return true;}
 
     int setParameter(const char **argv, int argc, Parameter &param);
     int updateParameter(int parameterID, Information &info);
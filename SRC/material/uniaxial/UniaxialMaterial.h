@@ -81,6 +81,11 @@ class UniaxialMaterial : public Material
     virtual int getResponse (int responseID, Information &matInformation);    
     virtual bool hasFailed(void) {return false;}
 
+    // materials whose setTrialStrain() and getters only touch their own
+    // state, and no class wide work areas, return true; the fibers of a
+    // section are only set on threads when all of them do
+    virtual bool isReentrant(void) {return false;}
+
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     virtual double getStressSensitivity     (int gradIndex, bool conditional);
     virtual double getStrainSensitivity     (int gradIndex);
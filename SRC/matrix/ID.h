@@ -86,6 +86,7 @@ class ID
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class LogDatastore;
     
   private:
     static int ID_NOT_VALID_ENTRY;
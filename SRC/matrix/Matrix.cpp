@@ -180,7 +180,6 @@ Matrix::Matrix(const Matrix &other)
 }
 
 // Move ctor
-#ifdef USE_CXX11
 Matrix::Matrix(Matrix &&other)
 :numRows(other.numRows), numCols(other.numCols), dataSize(other.dataSize), data(other.data), fromFree(other.fromFree)
 {
@@ -190,7 +189,6 @@ Matrix::Matrix(Matrix &&other)
   other.data = 0;
   other.fromFree = 1;
 }
-#endif
 
 //
 // DESTRUCTOR
@@ -932,6 +930,28 @@ Matrix::addMatrixTransposeProduct(double thisFact,
 }
 
 
+// growWork(int size):
+//      enlarges the shared work area to hold size doubles, so that the
+//      products need not form temporary matrices.
+int
+Matrix::growWork(int size)
+{
+  if (matrixWork != 0) {
+    delete [] matrixWork;
+    matrixWork = 0;
+  }
+  matrixWork = new (nothrow) double[size];
+  sizeDoubleWork = size;
+
+  if (matrixWork == 0) {
+    opserr << "WARNING: Matrix::growWork() - out of memory creating work area\n";
+    sizeDoubleWork = 0;
+    return -1;
+  }
+  return 0;
+}
+
+
 // to perform this += T' * B * T
 int
 Matrix::addMatrixTripleProduct(double thisFact, 
@@ -949,14 +969,13 @@ Matrix::addMatrixTripleProduct(double thisFact,
     }
 #endif
 
-    // cheack work area can hold the temporary matrix
+    // check work area can hold the temporary matrix
     int dimB = B.numCols;
     int sizeWork = dimB * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
-      this->addMatrix(thisFact, T^B*T, otherFact);
-      return 0;
-    }
+    if (sizeWork > sizeDoubleWork)
+      if (growWork(sizeWork) < 0)
+	return -3;
 
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
@@ -1048,13 +1067,12 @@ Matrix::addMatrixTripleProduct(double thisFact,
     }
 #endif
 
-    // cheack work area can hold the temporary matrix
+    // check work area can hold the temporary matrix
     int sizeWork = B.numRows * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
-      this->addMatrix(thisFact, A^B*C, otherFact);
-      return 0;
-    }
+    if (sizeWork > sizeDoubleWork)
+      if (growWork(sizeWork) < 0)
+	return -3;
 
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
@@ -1065,10 +1083,11 @@ Matrix::addMatrixTripleProduct(double thisFact,
     // NOTE: looping as per blas3 dgemm_: j,k,i
     
     int rowsB = B.numRows;
+    int colsB = B.numCols;
     double *ckjPtr  = &(C.data)[0];
     for (int j=0; j<numCols; j++) {
       double *aijPtrA = &matrixWork[j*rowsB];
-      for (int k=0; k<rowsB; k++) {
+      for (int k=0; k<colsB; k++) {
 	double tmp = *ckjPtr++ * otherFact;
 	double *aijPtr = aijPtrA;
 	double *bikPtr = &(B.data)[k*rowsB];
@@ -1204,26 +1223,27 @@ Matrix::operator=(const Matrix &other)
 
 
 // Move assignment
+//      the data of other is taken over, unless either matrix wraps
+//      memory it does not own; that memory must keep holding the values,
+//      so the data is copied as in the copy assignment.
 //
-#ifdef USE_CXX11
 Matrix &
-Matrix::operator=( Matrix &&other)
+Matrix::operator=(Matrix &&other)
 {
   // first check we are not trying other = other
   if (this == &other) 
     return *this;
 
+  if (fromFree != 0 || other.fromFree != 0)
+    return *this = static_cast<const Matrix &>(other);
 
-  if (this->data != 0 && fromFree == 0){
+  if (this->data != 0)
     delete [] this->data;
-    this->data = 0;
-  }
         
   this->data = other.data;
-  this->dataSize = other.numCols*other.numRows;
+  this->dataSize = other.dataSize;
   this->numCols = other.numCols;
   this->numRows = other.numRows;
-  this->fromFree = other.fromFree;
   other.data = 0;
   other.dataSize = 0;
   other.numCols = 0;
@@ -1232,7 +1252,6 @@ Matrix::operator=( Matrix &&other)
 
   return *this;
 }
-#endif
 
 
 // virtual Matrix &operator+=(double fact);
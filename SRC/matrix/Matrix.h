@@ -53,9 +53,7 @@ class Matrix
     Matrix(int nrows, int ncols);
     Matrix(double *data, int nrows, int ncols);    
     Matrix(const Matrix &M);    
-#ifdef USE_CXX11
-    Matrix( Matrix &&M);    
-#endif
+    Matrix(Matrix &&M);    
     ~Matrix();
 
     // utility methods
@@ -86,10 +84,7 @@ class Matrix
     Matrix operator()(const ID &rows, const ID & cols) const;
     
     Matrix &operator=(const Matrix &M);
-
-#ifdef USE_CXX11
     Matrix &operator=(Matrix &&M);
-#endif
     
     // matrix operations which will preserve the derived type and
     // which can be implemented efficiently without many constructor calls.
@@ -151,10 +146,13 @@ class Matrix
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class LogDatastore;
 
   protected:
 
   private:
+    static int growWork(int size);
+
     static double MATRIX_NOT_VALID_ENTRY;
     static double *matrixWork;
     static int *intWork;
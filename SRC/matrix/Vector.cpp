@@ -115,17 +115,15 @@ Vector::Vector(const Vector &other)
 
 
 
-// Vector(const Vector&):
+// Vector(Vector&&):
 //  Move constructor
-#ifdef USE_CXX11   
 Vector::Vector(Vector &&other)
-: sz(other.sz),theData(other.theData),fromFree(0)
+: sz(other.sz),theData(other.theData),fromFree(other.fromFree)
 {
-  //opserr << "move ctor!\n";
   other.theData = 0;
   other.sz = 0;
+  other.fromFree = 0;
 } 
-#endif
 
 
 
@@ -757,18 +755,22 @@ Vector::operator=(const Vector &V)
   return *this;
 }
 
-// Move assignment operator.  
-#ifdef USE_CXX11   
+// Vector &operator=(Vector  &&V):
+//	the move assignment operator, the data of V is taken over unless
+//	either vector wraps memory it does not own; that memory must keep
+//	holding the values, so the data is copied as in the assignment.
+
 Vector &
 Vector::operator=(Vector &&V) 
 {
   // first check we are not trying v = v
   if (this != &V) {
-    // opserr << "move assign!\n";
-    if (this->theData != 0){ 
+    if (fromFree != 0 || V.fromFree != 0)
+      return *this = static_cast<const Vector &>(V);
+
+    if (this->theData != 0)
       delete [] this->theData;
-      this->theData = 0;
-    }
+
     theData = V.theData;
     this->sz = V.sz;
     V.theData = 0;
@@ -776,7 +778,6 @@ Vector::operator=(Vector &&V)
   }
   return *this;
 }
-#endif
 
 
 
@@ -47,9 +47,7 @@ class Vector
     Vector();
     Vector(int);
     Vector(const Vector &);    
-#ifdef USE_CXX11   
     Vector(Vector &&);    
-#endif
 
     Vector(double *data, int size);
     ~Vector();
@@ -75,9 +73,7 @@ class Vector
     double &operator[](int x);
     Vector operator()(const ID &rows) const;
     Vector &operator=(const Vector  &V);
-#ifdef USE_CXX11   
     Vector &operator=(Vector  &&V);
-#endif
     Vector &operator+=(double fact);
     Vector &operator-=(double fact);
     Vector &operator*=(double fact);
@@ -122,6 +118,7 @@ class Vector
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class LogDatastore;
     
   private:
     static double VECTOR_NOT_VALID_ENTRY;
@@ -39,17 +39,32 @@
 #include <LimitStateFunction.h>
 #include <ReliabilityDomain.h>
 #include <Vector.h>
+#include <Domain.h>
 #include <string.h>
+#include <stdio.h>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 FiniteDifferenceGradient::FiniteDifferenceGradient(
     FunctionEvaluator *passedGFunEvaluator,
     ReliabilityDomain *passedReliabilityDomain,
-    Domain *passedOpenSeesDomain)
+    Domain *passedOpenSeesDomain,
+    int numProc)
 
     : GradientEvaluator(passedReliabilityDomain, passedGFunEvaluator),
-      theOpenSeesDomain(passedOpenSeesDomain) {
+      theOpenSeesDomain(passedOpenSeesDomain), numProcesses(numProc) {
     int nrv = passedReliabilityDomain->getNumberOfRandomVariables();
     grad_g = new Vector(nrv);
+    if (numProcesses < 1) numProcesses = 1;
 }
 
 FiniteDifferenceGradient::~FiniteDifferenceGradient() {
@@ -68,73 +83,191 @@ int FiniteDifferenceGradient::computeGradient(double g) {
     // Initialize gradient vector
     grad_g->Zero();
 
+    int nrv = this->theReliabilityDomain->getNumberOfRandomVariables();
+
+    // forking is left out under MPI, where the children would share the
+    // communicator, and with OpenMP threads, which do not survive fork()
+    bool forked = numProcesses > 1 && nrv > 1;
+#if defined(_WIN32) || defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
+    forked = false;
+#endif
+#ifdef _OPENMP
+    if (omp_get_max_threads() > 1)
+        forked = false;
+#endif
+#ifndef _WIN32
+    if (forked == true)
+        return this->computeGradientForked(g);
+#endif
+
+    // now loop through to create gradient vector
+    // for all RVs
+    for (int i = 0; i < nrv; i++) {
+        double g_perturbed, h;
+        if (this->perturbedValue(i, g_perturbed, h) < 0)
+            return -1;
+        (*grad_g)(i) = (g_perturbed - g) / h;
+    }
+
+    return 0;
+}
+
+int FiniteDifferenceGradient::perturbedValue(int i, double &g_perturbed,
+                                             double &h) {
     // get limit-state function from reliability domain
     int lsf = theReliabilityDomain->getTagOfActiveLimitStateFunction();
     LimitStateFunction *theLimitStateFunction =
         theReliabilityDomain->getLimitStateFunctionPtr(lsf);
     const char *lsfExpression = theLimitStateFunction->getExpression();
 
-    // get RVs created in the reliability domain
+    // get RV
+    auto *theRV = this->theReliabilityDomain->getRandomVariablePtrFromIndex(i);
+    if (theRV == 0) {
+        opserr << "ERROR: can't get RV " << i
+               << " -- FiniteDifferenceGradient::computeGradient\n";
+        return -1;
+    }
+
+    // get RV parameter
+    int param_indx =
+        theReliabilityDomain->getParameterIndexFromRandomVariableIndex(i);
+
+    auto *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+    if (theParam == 0) {
+        opserr << "ERROR: can't get param " << i
+               << " -- FiniteDifferenceGradient::computeGradient\n";
+        return -1;
+    }
+
+    // use parameter defined perturbation
+    h = theParam->getPerturbation();
+    double original = theParam->getValue();
+    theParam->update(original + h);
+
+    // set perturbed values in the variable namespace
+    if (theFunctionEvaluator->setVariables() < 0) {
+        opserr << "ERROR FiniteDifferenceGradient -- error "
+                  "setting variables in namespace"
+               << endln;
+        theParam->update(original);
+        return -1;
+    }
+
+    // run analysis
+    if (theFunctionEvaluator->runAnalysis() < 0) {
+        opserr << "ERROR FiniteDifferenceGradient -- error "
+                  "running analysis"
+               << endln;
+        theParam->update(original);
+        return -1;
+    }
+
+    // evaluate LSF and obtain result
+    theFunctionEvaluator->setExpression(lsfExpression);
+
+    // perturbed lsf
+    g_perturbed = theFunctionEvaluator->evaluateExpression();
+
+    // return parameter values to previous state
+    theParam->update(original);
+
+    return 0;
+}
+
+#ifndef _WIN32
+int FiniteDifferenceGradient::computeGradientForked(double g) {
+    // each perturbation is run in a forked copy of the process, which
+    // gives every analysis its own copy of the domain and interpreter;
+    // the parent only collects the gradient terms through a pipe. up to
+    // numProcesses children run at a time. the recorders are turned off
+    // in the children, only the parent writes them.
     int nrv = this->theReliabilityDomain->getNumberOfRandomVariables();
 
-    // now loop through to create gradient vector
-    // for all RVs
-    for (int i = 0; i < nrv; i++) {
-        // get RV
-        auto *theRV =
-            this->theReliabilityDomain->getRandomVariablePtrFromIndex(i);
-        if (theRV == 0) {
-            opserr << "ERROR: can't get RV " << i
-                   << " -- FiniteDifferenceGradient::computeGradient\n";
-            return -1;
-        }
+    std::vector<pid_t> pids(numProcesses);
+    std::vector<int> fds(numProcesses);
+    int result = 0;
 
-        // get RV parameter
-        int param_indx =
-            theReliabilityDomain->getParameterIndexFromRandomVariableIndex(
-                i);
+    for (int i0 = 0; i0 < nrv; i0 += numProcesses) {
+        int numBatch = (nrv - i0 < numProcesses) ? nrv - i0 : numProcesses;
 
-        auto *theParam =
-            theOpenSeesDomain->getParameterFromIndex(param_indx);
-        if (theParam == 0) {
-            opserr << "ERROR: can't get param " << i
-                   << " -- FiniteDifferenceGradient::computeGradient\n";
-            return -1;
-        }
+        // make sure nothing buffered is written once by every child
+        theOpenSeesDomain->flushRecorders();
+        opserr.flush();
+        fflush(NULL);
 
-        // use parameter defined perturbation
-        double h = theParam->getPerturbation();
-        double original = theParam->getValue();
-        theParam->update(original + h);
-
-        // set perturbed values in the variable namespace
-        if (theFunctionEvaluator->setVariables() < 0) {
-            opserr << "ERROR FiniteDifferenceGradient -- error "
-                      "setting variables in namespace"
-                   << endln;
-            theParam->update(original);
-            return -1;
-        }
+        for (int k = 0; k < numBatch; k++) {
+            int i = i0 + k;
+            int fd[2];
+            pids[k] = -1;
+            fds[k] = -1;
 
-        // run analysis
-        if (theFunctionEvaluator->runAnalysis() < 0) {
-            opserr << "ERROR FiniteDifferenceGradient -- error "
-                      "running analysis"
-                   << endln;
-            theParam->update(original);
-            return -1;
+            if (pipe(fd) == 0) {
+                pids[k] = fork();
+                if (pids[k] < 0) {
+                    close(fd[0]);
+                    close(fd[1]);
+                }
+            }
+
+            if (pids[k] == 0) {
+                // child: evaluate and report (status, gradient term)
+                close(fd[0]);
+                theOpenSeesDomain->setRecording(false);
+                double res[2] = {-1.0, 0.0};
+                double g_perturbed, h;
+                if (this->perturbedValue(i, g_perturbed, h) == 0) {
+                    res[0] = 0.0;
+                    res[1] = (g_perturbed - g) / h;
+                }
+                ssize_t nWrite = write(fd[1], res, sizeof(res));
+                close(fd[1]);
+                _exit(nWrite == sizeof(res) ? 0 : 1);
+            }
+
+            if (pids[k] > 0) {
+                close(fd[1]);
+                fds[k] = fd[0];
+            } else {
+                // could not fork, do this one here
+                double g_perturbed, h;
+                if (this->perturbedValue(i, g_perturbed, h) < 0)
+                    result = -1;
+                else
+                    (*grad_g)(i) = (g_perturbed - g) / h;
+            }
         }
 
-        // evaluate LSF and obtain result
-        theFunctionEvaluator->setExpression(lsfExpression);
+        for (int k = 0; k < numBatch; k++) {
+            if (pids[k] <= 0)
+                continue;
 
-        // perturbed lsf
-        double g_perturbed = theFunctionEvaluator->evaluateExpression();
-        (*grad_g)(i) = (g_perturbed - g) / h;
+            double res[2] = {-1.0, 0.0};
+            size_t numRead = 0;
+            char *buf = (char *)res;
+            while (numRead < sizeof(res)) {
+                ssize_t n = read(fds[k], buf + numRead, sizeof(res) - numRead);
+                if (n <= 0)
+                    break;
+                numRead += n;
+            }
+            close(fds[k]);
 
-        // return parameter values to previous state
-        theParam->update(original);
+            int status;
+            waitpid(pids[k], &status, 0);
+
+            if (numRead != sizeof(res) || res[0] < 0.0) {
+                opserr << "ERROR FiniteDifferenceGradient -- perturbation of "
+                          "random variable "
+                       << i0 + k << " failed" << endln;
+                result = -1;
+            } else
+                (*grad_g)(i0 + k) = res[1];
+        }
+
+        if (result < 0)
+            return result;
     }
 
     return 0;
 }
+#endif
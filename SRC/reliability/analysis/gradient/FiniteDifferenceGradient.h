@@ -47,7 +47,8 @@ class FiniteDifferenceGradient : public GradientEvaluator
 public:
 	FiniteDifferenceGradient(FunctionEvaluator *passedGFunEvaluator,
 				 ReliabilityDomain *passedReliabilityDomain,
-				 Domain *passedOpenSeesDomain);
+				 Domain *passedOpenSeesDomain,
+				 int numProcesses = 1);
 	~FiniteDifferenceGradient();
 	
 	int		computeGradient(double gFunValue);
@@ -56,8 +57,12 @@ public:
 protected:
 	
 private:
+	int perturbedValue(int rvIndex, double &gPerturbed, double &h);
+	int computeGradientForked(double gFunValue);
+
 	Domain *theOpenSeesDomain;
 	Vector *grad_g;
+	int numProcesses;
 	
 };
 
@@ -8,6 +8,7 @@
 
 OPS_Routine OPS_Newmark;
 OPS_Routine OPS_StagedNewmark;
+OPS_Routine OPS_ModalSuperposition;
 OPS_Routine OPS_GimmeMCK;
 OPS_Routine OPS_AlphaOS;
 OPS_Routine OPS_AlphaOS_TP;
@@ -193,6 +194,8 @@ TransientIntegratorLibrary = {
 
   {"NewmarkExplicit",         dispatch<TransientIntegrator, OPS_NewmarkExplicit>},
 
+  {"ModalSuperposition",      dispatch<TransientIntegrator, OPS_ModalSuperposition>},
+
   {"Newmark1",                dispatch<TransientIntegrator, G3Parse_newNewmark1Integrator>},
 
   {"NewmarkHSIncrReduct",     dispatch<TransientIntegrator, OPS_NewmarkHSIncrReduct>},
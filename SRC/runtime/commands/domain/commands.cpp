@@ -115,6 +115,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
 
   Tcl_CreateCommand(interp, "eleForce",            &eleForce,            domain, nullptr);
   Tcl_CreateCommand(interp, "eleResponse",         &eleResponse,         domain, nullptr);
+  Tcl_CreateCommand(interp, "responseHandle",      &responseHandle,      domain, nullptr);
   Tcl_CreateCommand(interp, "eleDynamicalForce",   &eleDynamicalForce,   domain, nullptr);
 
   Tcl_CreateCommand(interp, "nodeDOFs",            &nodeDOFs,            domain, nullptr);
@@ -67,6 +67,7 @@ Tcl_CmdProc localForce;
 Tcl_CmdProc eleDynamicalForce;
 
 Tcl_CmdProc eleResponse;
+Tcl_CmdProc responseHandle;
 
 Tcl_CmdProc findID;
 
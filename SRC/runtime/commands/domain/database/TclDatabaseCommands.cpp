@@ -40,6 +40,7 @@
 
 // known databases
 #include <FileDatastore.h>
+#include <LogDatastore.h>
 
 // linked list of struct for other types of
 // databases that can be added dynamically
@@ -82,7 +83,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
   // make sure at least one other argument to contain integrator
   if (argc < 2) {
     opserr << "WARNING need to specify a Database type; valid type File, "
-              "MySQL, BerkeleyDB \n";
+              "Log, MySQL, BerkeleyDB \n";
     return TCL_ERROR;
   }
 
@@ -110,6 +111,41 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
       return TCL_ERROR;
     }
 
+    return TCL_OK;
+  } else if (strcmp(argv[1], "Log") == 0) {
+    // a single file, append only, Database
+    if (argc < 3) {
+      opserr << "WARNING database Log fileName? <-compress> <-buffer numBytes?>\n";
+      return TCL_ERROR;
+    }
+
+    bool compress = false;
+    int bufferSize = 4*1024*1024;
+    for (int i = 3; i < argc; i++) {
+      if (strcmp(argv[i], "-compress") == 0)
+        compress = true;
+      else if (strcmp(argv[i], "-buffer") == 0 && i+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++i], &bufferSize) != TCL_OK) {
+          opserr << "WARNING database Log - invalid buffer size " << argv[i] << endln;
+          return TCL_ERROR;
+        }
+      } else {
+        opserr << "WARNING database Log - unknown option " << argv[i] << endln;
+        return TCL_ERROR;
+      }
+    }
+
+    // delete the old database
+    if (theDatabase != 0)
+      delete theDatabase;
+
+    theDatabase = new LogDatastore(argv[2], theDomain, theBroker, compress, bufferSize);
+    // check we instantiated a database .. if not ran out of memory
+    if (theDatabase == nullptr) {
+      opserr << "WARNING ran out of memory - database Log " << argv[2] << endln;
+      return TCL_ERROR;
+    }
+
     return TCL_OK;
   } else {
 
@@ -12,6 +12,9 @@
 
 #include <DummyStream.h>
 #include <Element.h>
+#include <ResponseHandle.h>
+#include <map>
+#include <string.h>
 
 int
 basicDeformation(ClientData clientData, Tcl_Interp *interp, int argc,
@@ -736,3 +739,115 @@ sectionDisplacement(ClientData clientData, Tcl_Interp *interp, int argc,
 
     return TCL_OK;
 }
+
+//
+// responseHandle element eleTags? eleArgs...
+// responseHandle node nodeTags? type?
+// responseHandle eval handle?
+// responseHandle size handle?
+// responseHandle delete handle?
+//
+// The handles keep the Response objects of the tags, so the arguments are
+// only parsed once for responses that are queried every step; eval
+// returns the values of all the tags as one flat list, row by row.
+//
+static std::map<int, ResponseHandle *> theResponseHandles;
+static int numResponseHandles = 0;
+
+int
+responseHandle(ClientData clientData, Tcl_Interp *interp, int argc,
+               TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain *the_domain = (Domain*)clientData;
+
+  if (argc < 3) {
+    opserr << G3_ERROR_PROMPT << "want - responseHandle element|node|eval|size|delete ...\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1], "element") == 0 || strcmp(argv[1], "node") == 0) {
+    bool nodal = strcmp(argv[1], "node") == 0;
+    if (argc < 4) {
+      opserr << G3_ERROR_PROMPT << "want - responseHandle " << argv[1] 
+             << (nodal ? " nodeTags? type?\n" : " eleTags? eleArgs...\n");
+      return TCL_ERROR;
+    }
+
+    int numTags;
+    TCL_Char **tagList;
+    if (Tcl_SplitList(interp, argv[2], &numTags, &tagList) != TCL_OK)
+      return TCL_ERROR;
+
+    ID tags(numTags);
+    for (int i = 0; i < numTags; i++) {
+      if (Tcl_GetInt(interp, tagList[i], &tags(i)) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "responseHandle - invalid tag " << tagList[i] << "\n";
+        Tcl_Free((char *)tagList);
+        return TCL_ERROR;
+      }
+    }
+    Tcl_Free((char *)tagList);
+
+    ResponseHandle *theHandle = nullptr;
+    if (nodal) {
+      NodeResponseType type;
+      if (ResponseHandle::getNodeResponseType(argv[3], type) != 0) {
+        opserr << G3_ERROR_PROMPT << "responseHandle node - unknown response " << argv[3] << "\n";
+        return TCL_ERROR;
+      }
+      theHandle = new ResponseHandle(*the_domain, tags, type);
+    } else
+      theHandle = new ResponseHandle(*the_domain, tags, argv + 3, argc - 3);
+
+    if (theHandle->evaluate() < 0) {
+      delete theHandle;
+      return TCL_ERROR;
+    }
+
+    theResponseHandles[++numResponseHandles] = theHandle;
+    Tcl_SetObjResult(interp, Tcl_NewIntObj(numResponseHandles));
+    return TCL_OK;
+  }
+
+  int tag;
+  if (Tcl_GetInt(interp, argv[2], &tag) != TCL_OK) {
+    opserr << G3_ERROR_PROMPT << "responseHandle " << argv[1] << " handle? - could not read handle\n";
+    return TCL_ERROR;
+  }
+
+  auto it = theResponseHandles.find(tag);
+  if (it == theResponseHandles.end()) {
+    opserr << G3_ERROR_PROMPT << "responseHandle - no handle " << tag << "\n";
+    return TCL_ERROR;
+  }
+  ResponseHandle *theHandle = it->second;
+
+  if (strcmp(argv[1], "eval") == 0) {
+    if (theHandle->evaluate() < 0)
+      return TCL_ERROR;
+
+    const Vector &data = theHandle->getData();
+    const int size = data.Size();
+    Tcl_Obj* list = Tcl_NewListObj(0, nullptr);
+    for (int i = 0; i < size; i++)
+      Tcl_ListObjAppendElement(interp, list, Tcl_NewDoubleObj(data(i)));
+    Tcl_SetObjResult(interp, list);
+
+  } else if (strcmp(argv[1], "size") == 0) {
+    Tcl_Obj* list = Tcl_NewListObj(0, nullptr);
+    Tcl_ListObjAppendElement(interp, list, Tcl_NewIntObj(theHandle->getNumRows()));
+    Tcl_ListObjAppendElement(interp, list, Tcl_NewIntObj(theHandle->getNumColumns()));
+    Tcl_SetObjResult(interp, list);
+
+  } else if (strcmp(argv[1], "delete") == 0) {
+    delete theHandle;
+    theResponseHandles.erase(it);
+
+  } else {
+    opserr << G3_ERROR_PROMPT << "responseHandle - unknown option " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
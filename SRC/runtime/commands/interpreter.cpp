@@ -14,6 +14,7 @@
 #include <G3_Runtime.h>
 #include <OPS_Globals.h>
 #include <Timer.h>
+#include <Profiler.h>
 
 static Tcl_ObjCmdProc *Tcl_putsCommand = nullptr;
 static Timer *theTimer = nullptr;
@@ -75,6 +76,52 @@ timer(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const argv
   return TCL_ERROR;
 }
 
+//
+// profile on <-trace> | off | reset | print | write $fileName | trace $fileName
+//
+static int
+profile(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING want profile on <-trace> | off | reset | print | write $fileName | trace $fileName\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "start") == 0) {
+#ifndef _PROFILER
+    opserr << "WARNING profile - built without _PROFILER, no phases will be timed\n";
+#endif
+    bool trace = (argc > 2 && strcmp(argv[2], "-trace") == 0);
+    Profiler::setTracing(trace);
+    Profiler::setEnabled(true);
+
+  } else if (strcmp(argv[1], "off") == 0 || strcmp(argv[1], "stop") == 0) {
+    Profiler::setEnabled(false);
+
+  } else if (strcmp(argv[1], "reset") == 0) {
+    Profiler::reset();
+
+  } else if (strcmp(argv[1], "print") == 0) {
+    Profiler::Print(opserr);
+
+  } else if (strcmp(argv[1], "write") == 0 || strcmp(argv[1], "trace") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING want profile " << argv[1] << " $fileName\n";
+      return TCL_ERROR;
+    }
+    int res = (strcmp(argv[1], "write") == 0) ? Profiler::writeJSON(argv[2])
+                                              : Profiler::writeTrace(argv[2]);
+    if (res < 0)
+      return TCL_ERROR;
+
+  } else {
+    opserr << "WARNING profile - unknown option '" << argv[1] << "'\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
 //
 // revised puts command to send to stderr
 //
@@ -386,6 +433,7 @@ OpenSeesAppInit(Tcl_Interp *interp)
   Tcl_CreateCommand(interp, "start",               startTimer,   nullptr, nullptr);
   Tcl_CreateCommand(interp, "stop",                stopTimer,    nullptr, nullptr);
   Tcl_CreateCommand(interp, "timer",               timer,        nullptr, nullptr);
+  Tcl_CreateCommand(interp, "profile",             profile,      nullptr, nullptr);
 
   // File utilities
   Tcl_CreateCommand(interp, "stripXML",            stripOpenSeesXML,    nullptr, NULL);
@@ -104,6 +104,7 @@ extern OPS_Routine OPS_RockingBC;
 extern OPS_Routine OPS_LehighJoint2d;
 extern OPS_Routine OPS_MasonPan12;
 extern OPS_Routine OPS_MasonPan3D;
+extern OPS_Routine OPS_CondensedSubstructure;
 
 #include <algorithm>
 #include <string>
@@ -336,5 +337,6 @@ element_dispatch = {
   {"CorotActuator",                OPS_ActuatorCorot},
   {"RockingBC",                    OPS_RockingBC},
   {"LehighJoint2D",                OPS_LehighJoint2d},
+  {"condensedSubstructure",        OPS_CondensedSubstructure},
 };
 
@@ -10,6 +10,11 @@
 #include <mpi.h>
 #include <MachineBroker.h>
 #include <MPI_MachineBroker.h>
+#include <MPI_Channel.h>
+#include <MPI_ChannelAddress.h>
+#include <ID.h>
+#include <Message.h>
+#include "task_farm.h"
 
 #define _PARALLEL_MP
 
@@ -64,6 +69,7 @@ int opsBarrier(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
 int opsSend(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
 int opsRecv(ClientData, Tcl_Interp *, int,TCL_Char ** const argv);
 int opsPartition(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
+int opsTaskFarm(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
 int wipePP(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
 void Init_Parallel(Tcl_Interp* interp)
@@ -75,6 +81,7 @@ void Init_Parallel(Tcl_Interp* interp)
   Tcl_CreateCommand(interp, "recv",      &opsRecv, (ClientData)theMachineBroker, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "barrier",   &opsBarrier, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "partition", &opsPartition, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "taskFarm",  &opsTaskFarm, (ClientData)theMachineBroker, (Tcl_CmdDeleteProc *)NULL);
 }
 
 
@@ -320,6 +327,137 @@ opsRecv(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const a
 }
 
 
+//
+// taskFarm <-log fileName?> <-command prefix?> tasks
+//
+// Invoked by all the processes. Process 0 hands the tasks out one at a time
+// to the other processes as they become free and returns the list of the
+// results; the other processes evaluate the tasks they are sent and return
+// an empty result. Messages go over MPI_Channels on a copy of the world
+// communicator so they can not be confused with those of send and recv.
+//
+int
+opsTaskFarm(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  MachineBroker* theMachineBroker = (MachineBroker*)clientData;
+  int myPID = theMachineBroker->getPID();
+  int np = theMachineBroker->getNP();
+
+  MPI_Comm farmComm;
+  MPI_Comm_dup(MPI_COMM_WORLD, &farmComm);
+
+  //
+  // the workers evaluate tasks until they are told to stop
+  //
+
+  if (myPID != 0) {
+    MPI_Channel theChannel(0);
+    MPI_ChannelAddress theAddress(0, farmComm);
+    ID taskData(2);          // task index, -1 to stop, and length of script
+    ID resultData(3);        // task index, status and length of result
+    std::vector<char> script;
+    std::string result;
+
+    while (theChannel.recvID(0, 0, taskData, &theAddress) == 0 && taskData(0) >= 0) {
+      script.resize(taskData(1)+1);
+      Message theMessage(&script[0], taskData(1));
+      theChannel.recvMsg(0, 0, theMessage, &theAddress);
+      script[taskData(1)] = '\0';
+
+      resultData(0) = taskData(0);
+      resultData(1) = TaskFarm_eval(interp, std::string(&script[0]), result);
+      resultData(2) = (int)result.size();
+      theChannel.sendID(0, 0, resultData, &theAddress);
+      Message resultMessage((char *)result.c_str(), (int)result.size());
+      theChannel.sendMsg(0, 0, resultMessage, &theAddress);
+    }
+
+    MPI_Comm_free(&farmComm);
+    Tcl_ResetResult(interp);
+    return TCL_OK;
+  }
+
+  //
+  // process 0 hands out the tasks
+  //
+
+  TaskFarm farm;
+  int res = TaskFarm_parse(interp, argc, (const char **)argv, farm);
+  if (res == TCL_OK)
+    TaskFarm_readLog(farm);
+
+  int numTasks = (int)farm.tasks.size();
+  int nextTask = 0;
+  ID taskData(2);
+  ID resultData(3);
+
+  // sends the next task to do to a worker, or tells it to stop
+  auto sendTask = [&](int worker) -> bool {
+    MPI_Channel theChannel(worker);
+    MPI_ChannelAddress theAddress(worker, farmComm);
+    while (res == TCL_OK && nextTask < numTasks && farm.status[nextTask] == 0)
+      nextTask++;
+    if (res != TCL_OK || nextTask >= numTasks) {
+      taskData(0) = -1;
+      taskData(1) = 0;
+      theChannel.sendID(0, 0, taskData, &theAddress);
+      return false;
+    }
+    std::string &script = farm.tasks[nextTask];
+    taskData(0) = nextTask++;
+    taskData(1) = (int)script.size();
+    theChannel.sendID(0, 0, taskData, &theAddress);
+    Message theMessage((char *)script.c_str(), (int)script.size());
+    theChannel.sendMsg(0, 0, theMessage, &theAddress);
+    return true;
+  };
+
+  int numBusy = 0;
+  for (int worker = 1; worker < np; worker++)
+    if (sendTask(worker) == true)
+      numBusy++;
+
+  // with a single process the tasks are done here
+  if (np == 1 && res == TCL_OK)
+    for (int i = 0; i < numTasks; i++)
+      if (farm.status[i] != 0) {
+        farm.status[i] = TaskFarm_eval(interp, farm.tasks[i], farm.results[i]);
+        TaskFarm_logResult(farm, i);
+      }
+
+  // the results come back in the order the workers finish
+  std::vector<char> result;
+  while (numBusy > 0) {
+    MPI_Status status;
+    MPI_Probe(MPI_ANY_SOURCE, 0, farmComm, &status);
+    int worker = status.MPI_SOURCE;
+
+    MPI_Channel theChannel(worker);
+    MPI_ChannelAddress theAddress(worker, farmComm);
+    theChannel.recvID(0, 0, resultData, &theAddress);
+    result.resize(resultData(2)+1);
+    Message theMessage(&result[0], resultData(2));
+    theChannel.recvMsg(0, 0, theMessage, &theAddress);
+
+    int task = resultData(0);
+    farm.results[task].assign(&result[0], resultData(2));
+    farm.status[task] = resultData(1);
+    TaskFarm_logResult(farm, task);
+
+    if (sendTask(worker) == false)
+      numBusy--;
+  }
+
+  MPI_Comm_free(&farmComm);
+
+  if (res != TCL_OK)
+    return res;
+
+  TaskFarm_setResult(interp, farm);
+  return TCL_OK;
+}
+
+
 int
 opsPartition(ClientData clientData, Tcl_Interp *interp, int argc,
              TCL_Char ** const argv)
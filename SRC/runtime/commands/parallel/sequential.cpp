@@ -8,7 +8,10 @@
 // for use in non-parallel interpreters
 //
 #include <tcl.h>
+#include "task_farm.h"
+#ifndef TCL_Char
 #define TCL_Char CONST84 char
+#endif
 
 Tcl_CmdProc getPIDSequential;
 Tcl_CmdProc getNPSequential;
@@ -16,6 +19,7 @@ Tcl_CmdProc opsBarrierSequential;
 Tcl_CmdProc opsSendSequential;
 Tcl_CmdProc opsRecvSequential;
 Tcl_CmdProc opsPartitionSequential;
+Tcl_CmdProc opsTaskFarmSequential;
 
 void G3_InitTclSequentialAPI(Tcl_Interp* interp)
 {
@@ -25,6 +29,7 @@ void G3_InitTclSequentialAPI(Tcl_Interp* interp)
 //Tcl_CreateCommand(interp, "send",      &opsSendSequential, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "recv",      &opsRecvSequential, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "partition", &opsPartitionSequential, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "taskFarm",  &opsTaskFarmSequential, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
 }
 
 
@@ -63,6 +68,27 @@ opsBarrierSequential(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Ch
   return TCL_OK;
 }
 
+// with one process the tasks of a taskFarm are done one after the other
+int
+opsTaskFarmSequential(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  TaskFarm farm;
+  if (TaskFarm_parse(interp, argc, (const char **)argv, farm) != TCL_OK)
+    return TCL_ERROR;
+
+  TaskFarm_readLog(farm);
+
+  int numTasks = (int)farm.tasks.size();
+  for (int i = 0; i < numTasks; i++)
+    if (farm.status[i] != 0) {
+      farm.status[i] = TaskFarm_eval(interp, farm.tasks[i], farm.results[i]);
+      TaskFarm_logResult(farm, i);
+    }
+
+  TaskFarm_setResult(interp, farm);
+  return TCL_OK;
+}
+
 int
 opsRecvSequential(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
@@ -0,0 +1,214 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the parts of the taskFarm command that
+// are shared by the parallel and the sequential interpreters: parsing the
+// tasks, evaluating a task and the task log.
+//
+//   taskFarm <-log fileName?> <-command prefix?> tasks
+//
+// tasks is a list of scripts or, with -command, of argument lists that are
+// appended to prefix. The result of the command is the list of the
+// results of the tasks in the order given. With -log the result of every
+// task is appended to fileName as it completes; when the command is run
+// again with the same log, the tasks already completed are not run again.
+//
+#ifndef TASK_FARM_H
+#define TASK_FARM_H
+
+#include <tcl.h>
+#include <OPS_Globals.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+struct TaskFarm {
+  std::vector<std::string> tasks;    // the scripts
+  std::vector<std::string> results;
+  std::vector<int> status;           // -1 to do, 0 done, 1 failed
+  std::string logFile;
+};
+
+// FNV-1a hash of a script, a log record is only used if the task is the same
+static unsigned long
+TaskFarm_hash(const std::string &script)
+{
+  unsigned long hash = 2166136261UL;
+  for (size_t i = 0; i < script.size(); i++) {
+    hash ^= (unsigned char)script[i];
+    hash = (hash * 16777619UL) & 0xffffffffUL;
+  }
+  return hash;
+}
+
+static int
+TaskFarm_parse(Tcl_Interp *interp, int argc, const char **argv, TaskFarm &farm)
+{
+  const char *prefix = nullptr;
+  const char *taskList = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-log") == 0 && i+1 < argc)
+      farm.logFile = argv[++i];
+    else if (strcmp(argv[i], "-command") == 0 && i+1 < argc)
+      prefix = argv[++i];
+    else if (taskList == nullptr)
+      taskList = argv[i];
+    else {
+      opserr << "WARNING taskFarm - unknown option " << argv[i] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (taskList == nullptr) {
+    opserr << "WARNING want taskFarm <-log fileName?> <-command prefix?> tasks\n";
+    return TCL_ERROR;
+  }
+
+  int numTasks;
+  const char **taskArgv;
+  if (Tcl_SplitList(interp, taskList, &numTasks, &taskArgv) != TCL_OK) {
+    opserr << "WARNING taskFarm - tasks is not a list\n";
+    return TCL_ERROR;
+  }
+
+  for (int i = 0; i < numTasks; i++) {
+    if (prefix == nullptr)
+      farm.tasks.push_back(taskArgv[i]);
+    else {
+      std::string script(prefix);
+      int numArgs;
+      const char **args;
+      if (Tcl_SplitList(interp, taskArgv[i], &numArgs, &args) != TCL_OK) {
+        opserr << "WARNING taskFarm - task " << i << " is not a list\n";
+        Tcl_Free((char *)taskArgv);
+        return TCL_ERROR;
+      }
+      for (int j = 0; j < numArgs; j++) {
+        char *arg = Tcl_Merge(1, &args[j]);
+        script += " ";
+        script += arg;
+        Tcl_Free(arg);
+      }
+      Tcl_Free((char *)args);
+      farm.tasks.push_back(script);
+    }
+  }
+  Tcl_Free((char *)taskArgv);
+
+  farm.results.assign(numTasks, std::string());
+  farm.status.assign(numTasks, -1);
+
+  return TCL_OK;
+}
+
+// each record is "task index status hash length\n" followed by the result
+// and a newline
+static int
+TaskFarm_logResult(TaskFarm &farm, int index)
+{
+  if (farm.logFile.empty())
+    return 0;
+
+  FILE *theFile = fopen(farm.logFile.c_str(), "ab");
+  if (theFile == nullptr) {
+    opserr << "WARNING taskFarm - could not open log " << farm.logFile.c_str() << "\n";
+    return -1;
+  }
+
+  const std::string &result = farm.results[index];
+  fprintf(theFile, "task %d %d %lu %d\n", index, farm.status[index],
+          TaskFarm_hash(farm.tasks[index]), (int)result.size());
+  fwrite(result.data(), 1, result.size(), theFile);
+  fputc('\n', theFile);
+  fclose(theFile);
+
+  return 0;
+}
+
+// reads the results of the tasks already done from the log. A record cut
+// short by a crash ends the log, which is then written again without it.
+static int
+TaskFarm_readLog(TaskFarm &farm)
+{
+  if (farm.logFile.empty())
+    return 0;
+
+  FILE *theFile = fopen(farm.logFile.c_str(), "rb");
+  if (theFile == nullptr)
+    return 0;
+
+  int numTasks = (int)farm.tasks.size();
+  int numRead = 0;
+  bool complete = true;
+  int index, status, length;
+  unsigned long hash;
+  while (fscanf(theFile, "task %d %d %lu %d", &index, &status, &hash, &length) == 4) {
+    if (fgetc(theFile) != '\n' || length < 0) {
+      complete = false;
+      break;
+    }
+    std::string result(length, ' ');
+    if ((length > 0 && fread(&result[0], 1, length, theFile) != (size_t)length)
+        || fgetc(theFile) != '\n') {
+      complete = false;
+      break;
+    }
+    if (index >= 0 && index < numTasks && status == 0
+        && hash == TaskFarm_hash(farm.tasks[index])) {
+      farm.results[index] = result;
+      farm.status[index] = 0;
+      numRead++;
+    }
+  }
+  if (!feof(theFile))
+    complete = false;
+  fclose(theFile);
+
+  if (complete == false) {
+    opserr << "WARNING taskFarm - log " << farm.logFile.c_str() << " ends with an incomplete record\n";
+    theFile = fopen(farm.logFile.c_str(), "wb");
+    if (theFile == nullptr)
+      return -1;
+    fclose(theFile);
+    for (int i = 0; i < numTasks; i++)
+      if (farm.status[i] == 0)
+        TaskFarm_logResult(farm, i);
+  }
+
+  return numRead;
+}
+
+// evaluates a task at the global level, returns 0 if it succeeded
+static int
+TaskFarm_eval(Tcl_Interp *interp, const std::string &script, std::string &result)
+{
+  int status = Tcl_EvalEx(interp, script.c_str(), -1, TCL_EVAL_GLOBAL);
+  result = Tcl_GetStringResult(interp);
+  Tcl_ResetResult(interp);
+  return (status == TCL_OK) ? 0 : 1;
+}
+
+// sets the list of results as the result of the command
+static int
+TaskFarm_setResult(Tcl_Interp *interp, TaskFarm &farm)
+{
+  Tcl_Obj *theList = Tcl_NewListObj(0, nullptr);
+  int numFailed = 0;
+  for (size_t i = 0; i < farm.results.size(); i++) {
+    Tcl_ListObjAppendElement(interp, theList,
+        Tcl_NewStringObj(farm.results[i].c_str(), (int)farm.results[i].size()));
+    if (farm.status[i] != 0) {
+      opserr << "WARNING taskFarm - task " << (int)i << " failed: " << farm.results[i].c_str() << "\n";
+      numFailed++;
+    }
+  }
+  Tcl_SetObjResult(interp, theList);
+  return numFailed;
+}
+
+#endif
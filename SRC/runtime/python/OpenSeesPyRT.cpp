@@ -9,6 +9,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 #include <pybind11/stl.h>
+#include <algorithm>
+#include <string>
+#include <vector>
 namespace py = pybind11;
 
 #include <G3_Runtime.h>
@@ -18,8 +21,11 @@ namespace py = pybind11;
 #include <Domain.h>
 #include <Vector.h>
 #include <Node.h>
+#include <NodeIter.h>
 #include <NodeData.h>
 #include <Element.h>
+#include <ElementIter.h>
+#include <ResponseHandle.h>
 #include <SectionForceDeformation.h>
 #include <UniaxialMaterial.h>
 #include <NDMaterial.h>
@@ -270,6 +276,205 @@ ground_motion(
 
 }
 
+//
+// Bulk access to domain state
+//
+static const Vector *
+node_state(Node& node, const std::string& type, bool trial)
+{
+  if (type == "displ")
+    return trial ? &node.getTrialDisp()  : &node.getDisp();
+  if (type == "veloc")
+    return trial ? &node.getTrialVel()   : &node.getVel();
+  if (type == "accel")
+    return trial ? &node.getTrialAccel() : &node.getAccel();
+  if (type == "react")
+    return &node.getReaction();
+  if (type == "incrDispl")
+    return &node.getIncrDisp();
+  if (type == "unbalance")
+    return &node.getUnbalancedLoad();
+  throw std::invalid_argument("Unknown node response type '" + type + "'");
+}
+
+static py::array_t<int>
+domain_node_tags(Domain& domain)
+{
+  py::array_t<int> tags(domain.getNumNodes());
+  int *ptr = static_cast<int*>(tags.request().ptr);
+  NodeIter &theNodes = domain.getNodes();
+  Node *theNode;
+  int i = 0;
+  while ((theNode = theNodes()) != nullptr)
+    ptr[i++] = theNode->getTag();
+  return tags;
+}
+
+static py::array_t<int>
+domain_element_tags(Domain& domain)
+{
+  py::array_t<int> tags(domain.getNumElements());
+  int *ptr = static_cast<int*>(tags.request().ptr);
+  ElementIter &theElements = domain.getElements();
+  Element *theElement;
+  int i = 0;
+  while ((theElement = theElements()) != nullptr)
+    ptr[i++] = theElement->getTag();
+  return tags;
+}
+
+//
+// Gather one response quantity of every node (or of the nodes in tags) into
+// a single (N, ndf) array with one pass over the domain. Node state is held
+// per node, so this is a single gather into the result rather than N Python
+// calls; nodes with fewer than ndf DOFs are padded with zeros.
+//
+static py::array_t<double>
+gather_node_state(Domain& domain, const std::string& type, bool trial, py::object tags)
+{
+  std::vector<Node*> nodes;
+  if (tags.is_none()) {
+    nodes.reserve(domain.getNumNodes());
+    NodeIter &theNodes = domain.getNodes();
+    Node *theNode;
+    while ((theNode = theNodes()) != nullptr)
+      nodes.push_back(theNode);
+  } else {
+    auto tag_array = tags.cast<py::array_t<int, ARRAY_FLAGS>>();
+    const int *tag_ptr = tag_array.data();
+    nodes.reserve(tag_array.size());
+    for (py::ssize_t i=0; i<tag_array.size(); i++) {
+      Node *theNode = domain.getNode(tag_ptr[i]);
+      if (theNode == nullptr)
+        throw std::invalid_argument("No node with tag " + std::to_string(tag_ptr[i]));
+      nodes.push_back(theNode);
+    }
+  }
+
+  py::ssize_t ndf = 0;
+  for (Node* node : nodes)
+    ndf = std::max<py::ssize_t>(ndf, node->getNumberDOF());
+
+  py::array_t<double> array({static_cast<py::ssize_t>(nodes.size()), ndf});
+  double *ptr = array.mutable_data();
+  std::fill(ptr, ptr + array.size(), 0.0);
+
+  for (std::size_t i=0; i<nodes.size(); i++) {
+    const Vector &state = *node_state(*nodes[i], type, trial);
+    double *row = ptr + i*ndf;
+    for (int j=0; j<state.Size(); j++)
+      row[j] = state(j);
+  }
+  return array;
+}
+
+//
+// Copy tags given from Python, or all the tags of the domain if none
+//
+static ID
+tag_id(py::object tags, py::array_t<int> all_tags)
+{
+  py::array_t<int, ARRAY_FLAGS> tag_array;
+  if (tags.is_none())
+    tag_array = py::array_t<int, ARRAY_FLAGS>::ensure(all_tags);
+  else
+    tag_array = tags.cast<py::array_t<int, ARRAY_FLAGS>>();
+
+  ID result((int)tag_array.size());
+  const int *tag_ptr = tag_array.data();
+  for (py::ssize_t i=0; i<tag_array.size(); i++)
+    result((int)i) = tag_ptr[i];
+  return result;
+}
+
+static ResponseHandle *
+new_element_handle(Domain& domain, py::object tags, std::vector<std::string> args)
+{
+  if (args.empty())
+    throw std::invalid_argument("No element response given");
+
+  std::vector<const char *> argv;
+  for (const std::string& arg : args)
+    argv.push_back(arg.c_str());
+
+  return new ResponseHandle(domain, tag_id(tags, domain_element_tags(domain)),
+                            argv.data(), (int)argv.size());
+}
+
+static ResponseHandle *
+new_node_handle(Domain& domain, py::object tags, const std::string& type)
+{
+  NodeResponseType response_type;
+  if (ResponseHandle::getNodeResponseType(type.c_str(), response_type) != 0)
+    throw std::invalid_argument("Unknown node response type '" + type + "'");
+
+  return new ResponseHandle(domain, tag_id(tags, domain_node_tags(domain)),
+                            response_type);
+}
+
+//
+// Evaluate a handle into an (N, m) array, where m is the largest response
+// size; shorter responses are zero padded.
+//
+static py::array_t<double>
+evaluate_handle(ResponseHandle& handle)
+{
+  if (handle.evaluate() < 0)
+    throw std::invalid_argument("Not all tags of the handle have the response");
+
+  const py::ssize_t rows = handle.getNumRows();
+  const py::ssize_t cols = handle.getNumColumns();
+  py::array_t<double> array({rows, cols});
+  const Vector &data = handle.getData();
+  double *ptr = array.mutable_data();
+  for (py::ssize_t i=0; i<rows*cols; i++)
+    ptr[i] = data((int)i);
+  return array;
+}
+
+//
+// Gather the same element response for many elements into an (N, m) array,
+// where m is the largest response size; shorter responses are zero padded.
+//
+static py::array_t<double>
+gather_element_response(Domain& domain, py::object tags, std::vector<std::string> args)
+{
+  // the elements read argv[0] without checking, as does the error below
+  if (args.empty())
+    throw std::invalid_argument("No element response given");
+
+  std::vector<const char *> argv;
+  for (const std::string& arg : args)
+    argv.push_back(arg.c_str());
+
+  py::array_t<int, ARRAY_FLAGS> tag_array;
+  if (tags.is_none())
+    tag_array = py::array_t<int, ARRAY_FLAGS>::ensure(domain_element_tags(domain));
+  else
+    tag_array = tags.cast<py::array_t<int, ARRAY_FLAGS>>();
+  const int *tag_ptr = tag_array.data();
+  const py::ssize_t ne = tag_array.size();
+
+  std::vector<Vector> responses(ne);
+  py::ssize_t width = 0;
+  for (py::ssize_t i=0; i<ne; i++) {
+    const Vector *data = domain.getElementResponse(tag_ptr[i], argv.data(), (int)argv.size());
+    if (data == nullptr)
+      throw std::invalid_argument("Element " + std::to_string(tag_ptr[i]) 
+                                  + " has no response '" + args[0] + "'");
+    responses[i] = *data;
+    width = std::max<py::ssize_t>(width, data->Size());
+  }
+
+  py::array_t<double> array({ne, width});
+  double *ptr = array.mutable_data();
+  std::fill(ptr, ptr + array.size(), 0.0);
+  for (py::ssize_t i=0; i<ne; i++)
+    for (int j=0; j<responses[i].Size(); j++)
+      ptr[i*width + j] = responses[i](j);
+  return array;
+}
+
 void
 init_obj_module(py::module &m)
 {
@@ -491,6 +696,19 @@ init_obj_module(py::module &m)
     })
   ;
 
+  py::class_<ResponseHandle>(m, "_ResponseHandle")
+    .def ("evaluate", &evaluate_handle,
+        "Return the current values of the response as an (N, m) array"
+    )
+    .def ("getTags", [](ResponseHandle& handle) {
+        const ID &tags = handle.getTags();
+        py::array_t<int> array(tags.Size());
+        for (int i=0; i<tags.Size(); i++)
+          array.mutable_data()[i] = tags(i);
+        return array;
+    })
+  ;
+
   py::class_<Domain>(m, "_Domain")
     // .def ("getElementResponse", &Domain::getElementResponse)
     .def ("getNodeResponse", [](Domain& domain, int node, std::string type) {
@@ -501,6 +719,40 @@ init_obj_module(py::module &m)
         if (type == "react") typ = NodeData::Reaction;
       return copy_vector(*domain.getNodeResponse(node, typ));
     })
+    //
+    // Bulk accessors
+    //
+    .def ("getNodeTags",    &domain_node_tags)
+    .def ("getElementTags", &domain_element_tags)
+    .def ("getNodeState",   &gather_node_state,
+        "Return an (N, ndf) array with a response quantity of all nodes (or the nodes in `tags`)",
+        py::arg("type") = "displ", py::arg("trial") = false, py::arg("tags") = py::none()
+    )
+    .def ("getNodeStateView", [](py::object self, int tag, std::string type, bool trial) {
+        // Zero-copy view of the state Vector held by a single node; the
+        // view shares memory with the node and is only valid while the
+        // domain keeps the node.
+        Domain &domain = self.cast<Domain&>();
+        Node *theNode = domain.getNode(tag);
+        if (theNode == nullptr)
+          throw std::invalid_argument("No node with tag " + std::to_string(tag));
+        Vector &state = const_cast<Vector&>(*node_state(*theNode, type, trial));
+        return py::array_t<double>({state.Size()}, {sizeof(double)}, &state(0), self);
+      }, 
+      py::arg("tag"), py::arg("type") = "displ", py::arg("trial") = false
+    )
+    .def ("getElementResponses", &gather_element_response,
+        "Return an (N, m) array with the response `args` of all elements (or the elements in `tags`)",
+        py::arg("tags"), py::arg("args")
+    )
+    .def ("getElementResponseHandle", &new_element_handle,
+        "Return a handle that evaluates the response `args` of all elements (or the elements in `tags`)",
+        py::arg("tags"), py::arg("args"), py::keep_alive<0, 1>()
+    )
+    .def ("getNodeResponseHandle", &new_node_handle,
+        "Return a handle that evaluates a response quantity of all nodes (or the nodes in `tags`)",
+        py::arg("tags") = py::none(), py::arg("type") = "displ", py::keep_alive<0, 1>()
+    )
     .def ("getTime", &Domain::getCurrentTime)
   ;
   
@@ -55,6 +55,8 @@
 #include <FE_EleIter.h>
 #include <FE_Element.h>
 #include <Integrator.h>
+#include <Domain.h>
+#include <Node.h>
 #include <string.h>
 #include <Channel.h>
 
@@ -67,7 +69,7 @@ static int sizeWork = 0;
 
 ArpackSolver::ArpackSolver()
 :EigenSolver(EigenSOLVER_TAGS_ArpackSolver),
- theSOE(0), numModesMax(0), numMode(0), size(0),
+ theSOE(0), numModesMax(0), sizeMax(0), numMode(0), size(0),
  eigenvalues(0), eigenvectors(0), 
  v(0), workl(0), workd(0), resid(0), select(0)
 {
@@ -160,7 +162,7 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
   
   // set up the space for ARPACK functions.
   // this is done each time method is called!! .. this needs to be cleaned up
-  if (numModes > numModesMax) {
+  if (numModes > numModesMax || n != sizeMax) {
     
     if (v != 0) delete [] v;
     if (workl != 0) delete [] workl;
@@ -187,6 +189,7 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
       v[i] = 0;
     
     numModesMax = numModes;
+    sizeMax = n;
   }
 
   char which[3];
@@ -203,6 +206,11 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
   // some more variables
   double tol = 0.0;
   int info = 0;
+
+  // start from the modes of the last eigen analysis when the nodes hold
+  // them, otherwise ARPACK picks a random starting vector
+  if (processID == -1)
+    info = this->formStartVector(n, nev);
   int maxitr = 1000;
   int mode = 3;
   
@@ -469,6 +477,71 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 }
 
 
+int
+ArpackSolver::formStartVector(int n, int nev)
+{
+  AnalysisModel *theAnalysisModel = theArpackSOE->theModel;
+  if (theAnalysisModel == 0)
+    return 0;
+  Domain *theDomain = theAnalysisModel->getDomainPtr();
+  if (theDomain == 0)
+    return 0;
+
+  for (int i=0; i<n; i++)
+    resid[i] = 0.0;
+
+  // sum of the stored eigenvectors, mapped to the current equations
+  bool found = false;
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+  while ((dofPtr = theDofs()) != 0) {
+    Node *theNode = theDomain->getNode(dofPtr->getNodeTag());
+    if (theNode == 0)
+      continue;
+    int numVectors = theNode->getNumEigenvectors();
+    if (numVectors == 0)
+      continue;
+    if (numVectors > nev)
+      numVectors = nev;
+
+    const Matrix &theEigenvectors = theNode->getEigenvectors();
+    const ID &id = dofPtr->getID();
+    int numDOF = id.Size();
+    if (numDOF > theEigenvectors.noRows())
+      numDOF = theEigenvectors.noRows();
+
+    for (int i=0; i<numDOF; i++) {
+      int loc = id(i);
+      if (loc >= 0 && loc < n) {
+	for (int j=0; j<numVectors; j++)
+	  resid[loc] += theEigenvectors(i,j);
+	found = true;
+      }
+    }
+  }
+
+  double maxValue = 0.0;
+  for (int i=0; i<n; i++)
+    if (fabs(resid[i]) > maxValue)
+      maxValue = fabs(resid[i]);
+
+  if (found == false || maxValue == 0.0)
+    return 0;
+
+  // a small deterministic perturbation keeps modes that are missing from
+  // the previous set (e.g. after a construction stage) reachable
+  unsigned int seed = 12345u;
+  for (int i=0; i<n; i++) {
+    seed = seed*1103515245u + 12345u;
+    double r = ((seed >> 8) & 0xFFFF)/65535.0 - 0.5;
+    resid[i] += 0.01*maxValue*r;
+  }
+
+  // ARPACK takes resid as the starting vector
+  return 1;
+}
+
+
 int 
 ArpackSolver::getNCV(int n, int nev)
 {
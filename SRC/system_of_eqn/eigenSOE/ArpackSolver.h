@@ -74,6 +74,7 @@ class ArpackSolver : public EigenSolver
     LinearSOE *theSOE;
     ArpackSOE *theArpackSOE;
     int numModesMax;
+    int sizeMax;
     int numMode;
     int size;
     double *eigenvalues;
@@ -94,6 +95,7 @@ class ArpackSolver : public EigenSolver
     void myMv(int n, double *v, double *result);
     void myCopy(int n, double *v, double *result);
     int getNCV(int n, int nev);
+    int formStartVector(int n, int nev);
 };
 
 #endif
@@ -32,6 +32,11 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include <Profiler.h>
+#include <MemoryReport.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -55,6 +60,7 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
+  OPS_PROFILE_SCOPE("solve");
   if (theSolver != 0)
     return (theSolver->solve());
   else 
@@ -108,3 +114,31 @@ int
 LinearSOE::addColA(const Vector &col, int colIndex, double fact) {
   return -1;
 }
+
+// addDiagA(const Vector &diag, double fact):
+//      adds fact times diag, in equation numbering, to the diagonal of A.
+//      This version adds one equation at a time through addA(); systems
+//      that can reach their diagonal directly should provide their own.
+int
+LinearSOE::addDiagA(const Vector &diag, double fact) {
+  static Matrix m(1,1);
+  static ID id(1);
+
+  int numEqn = diag.Size();
+  for (int i=0; i<numEqn; i++) {
+    if (diag(i) == 0.0)
+      continue;
+    m(0,0) = diag(i);
+    id(0) = i;
+    if (this->addA(m, id, fact) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+void
+LinearSOE::reportMemory(MemoryReport &theReport)
+{
+  // the storage of a subclass is unknown here, it is only counted
+  theReport.add("system", this->getClassType(), 0.0);
+}
@@ -47,6 +47,7 @@ class Matrix;
 class Vector;
 class ID;
 class AnalysisModel;
+class MemoryReport;
 
 class LinearSOE : public MovableObject
 {
@@ -68,6 +69,7 @@ class LinearSOE : public MovableObject
 
     virtual int addA(const Matrix &);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
+    virtual int addDiagA(const Vector &diag, double fact = 1.0);
 
     virtual void zeroA(void) =0;
     virtual void zeroB(void) =0;
@@ -82,6 +84,9 @@ class LinearSOE : public MovableObject
 
     virtual void setX(int loc, double value) =0;
     virtual void setX(const Vector &X) =0;
+
+    // adds the bytes held by the system to a memory report
+    virtual void reportMemory(MemoryReport &theReport);
     
     LinearSOESolver *getSolver(void);
     
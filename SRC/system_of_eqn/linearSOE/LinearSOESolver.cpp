@@ -35,6 +35,7 @@
 // What: "@(#) LinearSOESolver.C, revA"
 
 #include <LinearSOESolver.h>
+#include <MemoryReport.h>
 
 
 LinearSOESolver::LinearSOESolver(int classtag)
@@ -51,3 +52,9 @@ LinearSOESolver::~LinearSOESolver()
 
 
 
+
+void
+LinearSOESolver::reportMemory(MemoryReport &theReport)
+{
+  theReport.add("solver", this->getClassType(), 0.0);
+}
@@ -39,6 +39,7 @@
 
 #include <MovableObject.h>
 class LinearSOE;
+class MemoryReport;
 
 class LinearSOESolver : public MovableObject
 {
@@ -49,6 +50,9 @@ class LinearSOESolver : public MovableObject
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
+
+    // adds the bytes held by the solver, e.g. the factors, to a memory report
+    virtual void reportMemory(MemoryReport &theReport);
     
   protected:
     
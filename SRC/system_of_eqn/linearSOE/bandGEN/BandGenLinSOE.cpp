@@ -32,6 +32,7 @@
 #include <BandGenLinSOE.h>
 #include <BandGenLinSolver.h>
 #include <Matrix.h>
+#include <MemoryReport.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -450,6 +451,25 @@ BandGenLinSOE::setB(const Vector &v, double fact)
 }
 
 
+int 
+BandGenLinSOE::addDiagA(const Vector &diag, double fact)
+{
+  // check for a quick return 
+  if (fact == 0.0)  return 0;
+
+  if (diag.Size() != size) {
+    opserr << "BandGenLinSOE::addDiagA() - diag size not equal to n\n";
+    return -1;
+  }
+
+  int ldA = 2*numSubD + numSuperD + 1;
+  double *coliiPtr = A + numSubD + numSuperD;
+  for (int i=0; i<size; i++, coliiPtr += ldA)
+    *coliiPtr += diag(i) * fact;
+
+  return 0;
+}
+
 void 
 BandGenLinSOE::zeroA(void)
 {
@@ -554,3 +574,11 @@ BandGenLinSOE::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &th
 }
 
 
+
+void
+BandGenLinSOE::reportMemory(MemoryReport &theReport)
+{
+  double bytes = sizeof(BandGenLinSOE) + Asize*sizeof(double)
+    + Bsize*2*sizeof(double) + 2*sizeof(Vector);
+  theReport.add("system", "BandGenLinSOE", bytes);
+}
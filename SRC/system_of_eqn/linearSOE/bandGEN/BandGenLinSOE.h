@@ -40,6 +40,7 @@
 #include <Vector.h>
 
 class BandGenLinSolver;
+class MemoryReport;
 
 class BandGenLinSOE : public LinearSOE
 {
@@ -58,6 +59,7 @@ class BandGenLinSOE : public LinearSOE
     
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
+    virtual int addDiagA(const Vector &diag, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);        
 
@@ -75,6 +77,7 @@ class BandGenLinSOE : public LinearSOE
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+    void reportMemory(MemoryReport &theReport);
     friend class BandGenLinLapackSolver;
 
   protected:
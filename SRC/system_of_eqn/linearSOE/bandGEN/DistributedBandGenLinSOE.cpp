@@ -40,7 +40,8 @@
 
 DistributedBandGenLinSOE::DistributedBandGenLinSOE(BandGenLinSolver &theSolvr)
   :BandGenLinSOE(LinSOE_TAGS_DistributedBandGenLinSOE), 
-   processID(0), numChannels(0), theChannels(0), localCol(0), workArea(0), sizeWork(0), myB(0), myVectB(0)
+   processID(0), numChannels(0), theChannels(0), localCol(0), workArea(0), sizeWork(0), myB(0), myVectB(0),
+   myDOFs(0), packedB(0), results(0)
 {
 	this->setSolver(theSolvr);
     theSolvr.setLinearSOE(*this);
@@ -48,7 +49,8 @@ DistributedBandGenLinSOE::DistributedBandGenLinSOE(BandGenLinSolver &theSolvr)
 
 DistributedBandGenLinSOE::DistributedBandGenLinSOE()
   :BandGenLinSOE(LinSOE_TAGS_DistributedBandGenLinSOE), 
-   processID(0), numChannels(0), theChannels(0), localCol(0), workArea(0), sizeWork(0), myB(0), myVectB(0)
+   processID(0), numChannels(0), theChannels(0), localCol(0), workArea(0), sizeWork(0), myB(0), myVectB(0),
+   myDOFs(0), packedB(0), results(0)
 {
 
 }
@@ -186,6 +188,10 @@ DistributedBandGenLinSOE::setSize(Graph &theGraph)
     localMap->Zero();
     for (int k=0; k< globalMap.Size(); k++)
       (*localMap)(globalMap(k)) = k; 
+
+    // keep the equations of this process, only B at these is sent to P0
+    myDOFs = globalMap;
+    packedB.resize(globalMap.Size());
     delete localCol[0];
     localCol[0] = localMap;
   }
@@ -280,6 +286,9 @@ DistributedBandGenLinSOE::setSize(Graph &theGraph)
     myVectB = new Vector(myB, size);
   }
 
+  // X, B and the result of the solve go back to the subprocesses together
+  results.resize(2*size+1);
+
     // invoke setSize() on the Solver
   LinearSOESolver *theSolvr = this->getSolver();
   if (theSolvr == 0) {
@@ -388,10 +397,16 @@ DistributedBandGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 }
 
 int 
-DistributedBandGenLinSOE::solve(void)
+DistributedBandGenLinSOE::addDiagA(const Vector &diag, double fact)
 {
-  static ID result(1);
+  // add through addA(), which maps the equations to the local storage
+  return this->LinearSOE::addDiagA(diag, fact);
+}
+
 
+int 
+DistributedBandGenLinSOE::solve(void)
+{
   //
   // if subprocess send B and A and receive back result X, B & result
   //
@@ -399,8 +414,11 @@ DistributedBandGenLinSOE::solve(void)
   if (processID != 0) {
     Channel *theChannel = theChannels[0];
 
-    // send B
-    theChannel->sendVector(0, 0, *myVectB);
+    // send B at my equations only
+    int numMyDOFs = myDOFs.Size();
+    for (int i=0; i<numMyDOFs; i++)
+      packedB(i) = myB[myDOFs(i)];
+    theChannel->sendVector(0, 0, packedB);
 
     // send A in packets placed in vector X
     //    Vector vectA(A, Asize);    
@@ -410,11 +428,14 @@ DistributedBandGenLinSOE::solve(void)
     }
 
     // receive X,B and result
-    theChannel->recvVector(0, 0, *vectX);
-    theChannel->recvVector(0, 0, *vectB);
-    theChannel->recvID(0, 0, result);
-    
+    theChannel->recvVector(0, 0, results);
+    for (int i=0; i<size; i++) {
+      X[i] = results(i);
+      B[i] = results(size+i);
+    }
     factored = true;
+
+    return (int)results(2*size);
   } 
 
   //
@@ -426,13 +447,16 @@ DistributedBandGenLinSOE::solve(void)
     // add P0 contribution to B
     *vectB = *myVectB;
 
-    // receive X and A contribution from subprocess & add them in
+    // receive B and A contribution from subprocess & add them in
     for (int j=0; j<numChannels; j++) {
 
-      // get X & add
+      // get B & add using local map
       Channel *theChannel = theChannels[j];
-      theChannel->recvVector(0, 0, *vectX);
-      *vectB += *vectX;
+      const ID &localMap = *(localCol[j]);
+      Vector remoteB(workArea, localMap.Size());
+      theChannel->recvVector(0, 0, remoteB);
+      for (int i=0; i<localMap.Size(); i++)
+	B[localMap(i)] += workArea[i];
 
       // get A & add using local map
       if (factored == false) {
@@ -450,20 +474,24 @@ DistributedBandGenLinSOE::solve(void)
 	}    
       }
     }
-    
+
     // solve
-    result(0) = this->LinearSOE::solve();
+    int result = this->LinearSOE::solve();
 
     // send results back
+    for (int i=0; i<size; i++) {
+      results(i) = X[i];
+      results(size+i) = B[i];
+    }
+    results(2*size) = result;
+
     for (int j=0; j<numChannels; j++) {
       Channel *theChannel = theChannels[j];
-      theChannel->sendVector(0, 0, *vectX);
-      theChannel->sendVector(0, 0, *vectB);
-      theChannel->sendID(0, 0, result);      
+      theChannel->sendVector(0, 0, results);
     }
-  } 
 
-  return result(0);
+    return result;
+  } 
 }	
 
 
@@ -548,27 +576,30 @@ DistributedBandGenLinSOE::getB(void)
   if (processID != 0) {
     Channel *theChannel = theChannels[0];
 
-    // send B & recv merged B
-    theChannel->sendVector(0, 0, *myVectB);
+    // send B at my equations & recv merged B
+    int numMyDOFs = myDOFs.Size();
+    for (int i=0; i<numMyDOFs; i++)
+      packedB(i) = myB[myDOFs(i)];
+    theChannel->sendVector(0, 0, packedB);
     theChannel->recvVector(0, 0, *vectB);
   } 
 
   //
-  // if main process, recv B & A from all, solve and send back X, B & result
+  // if main process, recv B from all, add them & send back the sum
   //
 
   else {
 
     *vectB = *myVectB;
 
-    Vector remoteB(workArea, size);    
-    // receive X and A contribution from subprocess & add them in
-
     for (int j=0; j<numChannels; j++) {
 
       Channel *theChannel = theChannels[j];
+      const ID &localMap = *(localCol[j]);
+      Vector remoteB(workArea, localMap.Size());
       theChannel->recvVector(0, 0, remoteB);
-      *vectB += remoteB;
+      for (int i=0; i<localMap.Size(); i++)
+	B[localMap(i)] += workArea[i];
     }
   
     // send results back
@@ -36,6 +36,7 @@
 
 #include <BandGenLinSOE.h>
 #include <Vector.h>
+#include <ID.h>
 
 class DistributedBandGenLinSolver;
 
@@ -50,6 +51,7 @@ class DistributedBandGenLinSOE : public BandGenLinSOE
     // these methods need to be rewritten
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addDiagA(const Vector &diag, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);
     int setB(const Vector &, double fact = 1.0);            
     void zeroB(void);
@@ -75,6 +77,10 @@ class DistributedBandGenLinSOE : public BandGenLinSOE
     int sizeWork;
     double *myB;
     Vector *myVectB;
+
+    ID myDOFs;       // equations of a subprocess
+    Vector packedB;  // contribution of a subprocess to B at myDOFs
+    Vector results;  // X, B and solve result as sent back by P0
 };
 
 
@@ -33,6 +33,7 @@
 #include <BandSPDLinSOE.h>
 #include <BandSPDLinSolver.h>
 #include <Matrix.h>
+#include <MemoryReport.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -404,6 +405,24 @@ BandSPDLinSOE::setB(const Vector &v, double fact)
     return 0;
 }
 
+int 
+BandSPDLinSOE::addDiagA(const Vector &diag, double fact)
+{
+  // check for a quick return 
+  if (fact == 0.0)  return 0;
+
+  if (diag.Size() != size) {
+    opserr << "BandSPDLinSOE::addDiagA() - diag size not equal to n\n";
+    return -1;
+  }
+
+  double *coliiPtr = A + half_band - 1;
+  for (int i=0; i<size; i++, coliiPtr += half_band)
+    *coliiPtr += diag(i) * fact;
+
+  return 0;
+}
+
 void 
 BandSPDLinSOE::zeroA(void)
 {
@@ -505,3 +524,11 @@ BandSPDLinSOE::recvSelf(int tag, Channel &theChannel, FEM_ObjectBroker &theBroke
   opserr << "BandSPDLinSOE::recvSelf( - not implemented\n";
   return -1;
 }
+
+void
+BandSPDLinSOE::reportMemory(MemoryReport &theReport)
+{
+  double bytes = sizeof(BandSPDLinSOE) + Asize*sizeof(double)
+    + Bsize*2*sizeof(double) + 2*sizeof(Vector);
+  theReport.add("system", "BandSPDLinSOE", bytes);
+}
@@ -41,6 +41,7 @@
 #include <Vector.h>
 
 class BandSPDLinSolver;
+class MemoryReport;
 
 
 
@@ -59,6 +60,7 @@ class BandSPDLinSOE : public LinearSOE
 
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
+    virtual int addDiagA(const Vector &diag, double fact = 1.0);
 
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);        
@@ -76,6 +78,7 @@ class BandSPDLinSOE : public LinearSOE
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    void reportMemory(MemoryReport &theReport);
     
     friend class BandSPDLinSolver;
     friend class BandSPDLinLapackSolver;    
@@ -343,6 +343,14 @@ DistributedBandSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
   return 0;
 }
 
+int 
+DistributedBandSPDLinSOE::addDiagA(const Vector &diag, double fact)
+{
+  // add through addA(), which maps the equations to the local storage
+  return this->LinearSOE::addDiagA(diag, fact);
+}
+
+
 int 
 DistributedBandSPDLinSOE::solve(void)
 {
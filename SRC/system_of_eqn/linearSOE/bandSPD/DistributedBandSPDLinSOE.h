@@ -49,6 +49,7 @@ class DistributedBandSPDLinSOE : public BandSPDLinSOE
 
     // these methods need to be rewritten
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addDiagA(const Vector &diag, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);            
     void zeroB(void);
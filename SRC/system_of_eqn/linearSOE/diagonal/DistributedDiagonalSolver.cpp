@@ -93,44 +93,81 @@ DistributedDiagonalSolver::solve(void)
 
   // assuming numShared < size .. could do an if statement
 
+  // isShared marks the local equations that must wait for the other processes
+  ID isShared(size);
   for (int i=0; i<numShared; i++) {
     int dof = myDOFsShared(i);
     int loc = myDOFs.getLocation(dof);
     if (loc >= 0) {
       dataShared[i] = A[loc];
       dataShared[i+numShared] = B[loc];
+      isShared(loc) = 1;
     }
   }
 
   //
-  // use P0 to gather & send back out
+  // use P0 to gather & send back out, the receives are posted first
+  // and the unshared equations are solved while the data is on its way
   //
 
   if (numShared != 0) {
     if (processID != 0) {
       Channel *theChannel = theChannels[0];
       theChannel->sendVector(0, 0, *vectShared);
-      theChannel->recvVector(0, 0, *vectShared);
+      int request = theChannel->irecvVector(0, 0, *vectShared);
+
+      for (int i=0; i<size; i++)
+	if (isShared(i) == 0)
+	  X[i] = B[i]/A[i];
+
+      if (request < 0 || theChannel->wait(request) < 0) {
+	opserr << "DistributedDiagonalSolver::solve() - failed to recv the shared data\n";
+	return -1;
+      }
     } 
     else {
 
-      static Vector otherShared(1);
-      otherShared.resize(2*numShared);
+      static Vector *otherShared = 0;
+      static int numOtherShared = 0;
+      if (numOtherShared < numChannels) {
+	if (otherShared != 0)
+	  delete [] otherShared;
+	otherShared = new Vector[numChannels];
+	numOtherShared = numChannels;
+      }
+
+      ID requests(numChannels);
       for (int i=0; i<numChannels; i++) {
-	Channel *theChannel = theChannels[i];
-	theChannel->recvVector(0, 0, otherShared);
-	*vectShared += otherShared;
+	otherShared[i].resize(2*numShared);
+	requests(i) = theChannels[i]->irecvVector(0, 0, otherShared[i]);
       }
+
+      for (int i=0; i<size; i++)
+	if (isShared(i) == 0)
+	  X[i] = B[i]/A[i];
+
+      // sum in channel order so the result does not depend on arrival
       for (int i=0; i<numChannels; i++) {
-	Channel *theChannel = theChannels[i];
-	theChannel->sendVector(0, 0, *vectShared);
+	if (requests(i) < 0 || theChannels[i]->wait(requests(i)) < 0) {
+	  opserr << "DistributedDiagonalSolver::solve() - failed to recv the shared data\n";
+	  return -1;
+	}
+	*vectShared += otherShared[i];
       }
+
+      for (int i=0; i<numChannels; i++)
+	requests(i) = theChannels[i]->isendVector(0, 0, *vectShared);
+      for (int i=0; i<numChannels; i++)
+	if (requests(i) >= 0)
+	  theChannels[i]->wait(requests(i));
     }
   }
   
   
   //
-  // set the corresponding A & B entries
+  // set the corresponding A & B entries and solve the shared equations
+  // now that the data from every process has arrived, the unshared ones
+  // are solved above
   //
   
   
@@ -140,15 +177,13 @@ DistributedDiagonalSolver::solve(void)
     if (loc >= 0) {
       A[loc] = dataShared[i];
       B[loc] = dataShared[i+numShared];
+      X[loc] = B[loc]/A[loc];
     }
   }  
 
-  //
-  // now solve
-  //
-  
-  for (int i=0; i<size; i++) {
-    X[i] = B[i]/A[i];
+  if (numShared == 0) {
+    for (int i=0; i<size; i++)
+      X[i] = B[i]/A[i];
   }
 
   return 0;
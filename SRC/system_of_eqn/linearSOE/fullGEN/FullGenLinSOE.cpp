@@ -35,6 +35,7 @@
 
 #include <FullGenLinSolver.h>
 #include <Matrix.h>
+#include <MemoryReport.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -369,6 +370,24 @@ FullGenLinSOE::setB(const Vector &v, double fact)
     return 0;
 }
 
+int 
+FullGenLinSOE::addDiagA(const Vector &diag, double fact)
+{
+  // check for a quick return 
+  if (fact == 0.0)  return 0;
+
+  if (diag.Size() != size) {
+    opserr << "FullGenLinSOE::addDiagA() - diag size not equal to n\n";
+    return -1;
+  }
+
+  double *coliiPtr = A;
+  for (int i=0; i<size; i++, coliiPtr += size+1)
+    *coliiPtr += diag(i) * fact;
+
+  return 0;
+}
+
 void 
 FullGenLinSOE::zeroA(void)
 {
@@ -502,3 +521,12 @@ FullGenLinSOE::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &th
 
 
 
+
+void
+FullGenLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // matA wraps A
+  double bytes = sizeof(FullGenLinSOE) + Asize*sizeof(double)
+    + Bsize*2*sizeof(double) + 2*sizeof(Vector) + sizeof(Matrix);
+  theReport.add("system", "FullGenLinSOE", bytes);
+}
@@ -42,6 +42,7 @@
 #include <Vector.h>
 
 class FullGenLinSolver;
+class MemoryReport;
 
 class FullGenLinSOE : public LinearSOE
 {
@@ -58,6 +59,7 @@ class FullGenLinSOE : public LinearSOE
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);        
     int addColA(const Vector &col, int colIndex, double fact = 1.0);
+    int addDiagA(const Vector &diag, double fact = 1.0);
     
     void zeroA(void);
     void zeroB(void);
@@ -79,6 +81,7 @@ class FullGenLinSOE : public LinearSOE
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    void reportMemory(MemoryReport &theReport);
 
   protected:
     
@@ -36,6 +36,7 @@
 
 #include <ProfileSPDLinSOE.h>
 #include <Vector.h>
+#include <ID.h>
 
 class DistributedProfileSPDLinSolver;
 
@@ -49,6 +50,7 @@ class DistributedProfileSPDLinSOE : public ProfileSPDLinSOE
 
     // these methods need to be rewritten
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addDiagA(const Vector &diag, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);            
     void zeroB(void);
@@ -82,6 +84,10 @@ class DistributedProfileSPDLinSOE : public ProfileSPDLinSOE
     int sizeWork;
     Vector *myVectB;
     double *myB;
+
+    ID myDOFs;       // equations of a subprocess
+    Vector packedB;  // contribution of a subprocess to B at myDOFs
+    Vector results;  // X, B and solve result as sent back by P0
 };
 
 
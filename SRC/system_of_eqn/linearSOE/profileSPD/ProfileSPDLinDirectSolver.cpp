@@ -44,6 +44,29 @@
 #include <FEM_ObjectBroker.h>
 //#include <Timer.h>
 
+#ifdef _WIN32
+extern "C" int DTRSM(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		     int *M, int *N, double *ALPHA, double *A, int *LDA,
+		     double *B, int *LDB);
+
+extern "C" int DGEMM(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		     double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		     double *BETA, double *C, int *LDC);
+#else
+extern "C" int dtrsm_(char *SIDE, char *UPLO, char *TRANSA, char *DIAG,
+		      int *M, int *N, double *ALPHA, double *A, int *LDA,
+		      double *B, int *LDB);
+
+extern "C" int dgemm_(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		      double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		      double *BETA, double *C, int *LDC);
+#endif
+
+// width of the column panels used by the blocked factorization, and the
+// system size below which the scalar factorization is used throughout
+#define PROFILE_PANEL_WIDTH 64
+#define PROFILE_PANEL_MIN_SIZE 256
+
 void* OPS_ProfileSPDLinDirectSolver()
 {
     ProfileSPDLinSolver *theSolver = new ProfileSPDLinDirectSolver();
@@ -159,6 +182,15 @@ ProfileSPDLinDirectSolver::solve(void)
       opserr << endln;
       */
 
+
+    // large systems are factored in panels first, leaving only the
+    // triangular solves below
+    if (theSOE->isAfactored == false && theSize >= PROFILE_PANEL_MIN_SIZE) {
+	if (this->factorPanels() < 0)
+	    return -2;
+	theSOE->isAfactored = true;
+	theSOE->numInt = 0;
+    }
     
     if (theSOE->isAfactored == false)  {
 
@@ -310,6 +342,209 @@ ProfileSPDLinDirectSolver::solve(void)
     return 0;
 }
 
+int
+ProfileSPDLinDirectSolver::factorColumn(int i)
+{
+    // left-looking reduction of column i by the columns j < i, which
+    // must all have been factored already
+    int rowitop = RowTop[i];
+    double *ajiPtr = topRowPtr[i];
+
+    for (int j=rowitop; j<i; j++) {
+	double tmp = *ajiPtr;
+	int rowjtop = RowTop[j];
+	double *akjPtr, *akiPtr;
+	int k0;
+
+	if (rowitop > rowjtop) {
+	    akjPtr = topRowPtr[j] + (rowitop-rowjtop);
+	    akiPtr = topRowPtr[i];
+	    k0 = rowitop;
+	} else {
+	    akjPtr = topRowPtr[j];
+	    akiPtr = topRowPtr[i] + (rowjtop-rowitop);
+	    k0 = rowjtop;
+	}
+
+	for (int k=k0; k<j; k++) 
+	    tmp -= *akjPtr++ * *akiPtr++ ;
+
+	*ajiPtr++ = tmp;
+    }
+
+    // now form i'th col of [U] and determine [dii]
+    double aii = theSOE->A[theSOE->iDiagLoc[i] -1]; // FORTRAN ARRAY INDEXING
+    ajiPtr = topRowPtr[i];
+    for (int jj=rowitop; jj<i; jj++) {
+	double aji = *ajiPtr;
+	double lij = aji * invD[jj];
+	*ajiPtr++ = lij;
+	aii = aii - lij*aji;
+    }
+
+    // the same tests as solve(): only the first pivot must be positive,
+    // negative pivots of indefinite systems are accepted
+    if (i == 0 && aii <= 0.0) {
+	opserr << "ProfileSPDLinDirectSolver::solve() - ";
+	opserr << " aii < 0 (i, aii): (0,0)\n"; 
+	return -2;
+    }
+    if (aii == 0.0 || fabs(aii) <= minDiagTol) {
+	opserr << "ProfileSPDLinDirectSolver::solve() - ";
+	opserr << " aii < minDiagTol (i, aii): (" << i;
+	opserr << ", " << aii << ")\n"; 
+	return -2;
+    }
+
+    invD[i] = 1.0/aii; 
+    return 0;
+}
+
+int
+ProfileSPDLinDirectSolver::factorPanels(void)
+{
+    int theSize = theSOE->size;
+    double *A = theSOE->A;
+    int *iDiagLoc = theSOE->iDiagLoc;
+
+    char side = 'L', upper = 'U', trans = 'T', noTrans = 'N', unit = 'U';
+    double one = 1.0, zero = 0.0;
+
+    for (int c0=0; c0<theSize; c0+=PROFILE_PANEL_WIDTH) {
+
+	int c1 = c0 + PROFILE_PANEL_WIDTH;
+	if (c1 > theSize)
+	    c1 = theSize;
+	int w = c1 - c0;
+
+	// rows [top, c0) hold the coupling of the panel to the factored part
+	int top = c0;
+	for (int i=c0; i<c1; i++)
+	    if (RowTop[i] < top)
+		top = RowTop[i];
+	int m = c0 - top;
+
+	// the dense update pays only when the envelope of the factored
+	// columns inside [top, c0) is at least half full
+	long nnzU = 0;
+	for (int s=top; s<c0; s++)
+	    nnzU += s - (RowTop[s] > top ? RowTop[s] : top);
+
+	if (m < 2 || 4*nnzU < (long)m*(m-1)) {
+	    for (int i=c0; i<c1; i++)
+		if (this->factorColumn(i) < 0)
+		    return -2;
+	    continue;
+	}
+
+	// work areas: U (m x m), G = D U_p (m x w), U_p (m x w), P (w x w)
+	size_t need = (size_t)m*m + 2*(size_t)m*w + (size_t)w*w;
+	if (work.size() < need)
+	    work.resize(need);
+	double *U = &work[0];
+	double *G = U + (size_t)m*m;
+	double *Up = G + (size_t)m*w;
+	double *P = Up + (size_t)m*w;
+
+	// gather the unit upper triangle of the factored columns
+	for (int s=0; s<m; s++) {
+	    int col = top + s;
+	    int rowTop = RowTop[col];
+	    double *uCol = &U[(size_t)s*m];
+	    for (int r=0; r<s; r++) {
+		int row = top + r;
+		uCol[r] = (row >= rowTop) ? topRowPtr[col][row-rowTop] : 0.0;
+	    }
+	}
+
+	// gather the panel columns above the panel
+	for (int a=0; a<w; a++) {
+	    int col = c0 + a;
+	    int rowTop = RowTop[col];
+	    double *gCol = &G[(size_t)a*m];
+	    for (int r=0; r<m; r++) {
+		int row = top + r;
+		gCol[r] = (row >= rowTop) ? topRowPtr[col][row-rowTop] : 0.0;
+	    }
+	}
+
+	// G <- U^-t G; padded zeros above a column top stay zero
+#ifdef _WIN32
+	DTRSM(&side, &upper, &trans, &unit, &m, &w, &one, U, &m, G, &m);
+#else
+	dtrsm_(&side, &upper, &trans, &unit, &m, &w, &one, U, &m, G, &m);
+#endif
+
+	for (int a=0; a<w; a++) {
+	    double *gCol = &G[(size_t)a*m];
+	    double *uCol = &Up[(size_t)a*m];
+	    for (int r=0; r<m; r++)
+		uCol[r] = gCol[r] * invD[top+r];
+	}
+
+	// P <- U_p^t G, the contribution of the factored part to the panel
+	int ldP = w;
+#ifdef _WIN32
+	DGEMM(&trans, &noTrans, &w, &w, &m, &one, Up, &m, G, &m, &zero, P, &ldP);
+#else
+	dgemm_(&trans, &noTrans, &w, &w, &m, &one, Up, &m, G, &m, &zero, P, &ldP);
+#endif
+
+	// P <- A_pp - P on and above the diagonal
+	for (int a=0; a<w; a++) {
+	    int col = c0 + a;
+	    int rowTop = RowTop[col];
+	    double *pCol = &P[(size_t)a*w];
+	    for (int b=0; b<a; b++) {
+		int row = c0 + b;
+		pCol[b] = (row >= rowTop) ? topRowPtr[col][row-rowTop] - pCol[b] : 0.0;
+	    }
+	    pCol[a] = A[iDiagLoc[col]-1] - pCol[a];
+	}
+
+	// factor the dense diagonal block
+	for (int a=0; a<w; a++) {
+	    double *pCol = &P[(size_t)a*w];
+	    for (int b=1; b<a; b++) {
+		double *pkb = &P[(size_t)b*w];
+		double tmp = pCol[b];
+		for (int k=0; k<b; k++)
+		    tmp -= pkb[k] * pCol[k];
+		pCol[b] = tmp;
+	    }
+	    double aii = pCol[a];
+	    for (int b=0; b<a; b++) {
+		double aji = pCol[b];
+		double lij = aji * invD[c0+b];
+		pCol[b] = lij;
+		aii = aii - lij*aji;
+	    }
+	    if (aii == 0.0 || fabs(aii) <= minDiagTol) {
+		opserr << "ProfileSPDLinDirectSolver::solve() - ";
+		opserr << " aii < minDiagTol (i, aii): (" << c0+a;
+		opserr << ", " << aii << ")\n"; 
+		return -2;
+	    }
+	    invD[c0+a] = 1.0/aii;
+	}
+
+	// scatter the factored panel back into the profile
+	for (int a=0; a<w; a++) {
+	    int col = c0 + a;
+	    int rowTop = RowTop[col];
+	    double *aCol = topRowPtr[col];
+	    double *uCol = &Up[(size_t)a*m];
+	    for (int row=rowTop; row<c0; row++)
+		aCol[row-rowTop] = uCol[row-top];
+	    double *pCol = &P[(size_t)a*w];
+	    for (int row=(rowTop > c0 ? rowTop : c0); row<col; row++)
+		aCol[row-rowTop] = pCol[row-c0];
+	}
+    }
+
+    return 0;
+}
+
 double
 ProfileSPDLinDirectSolver::getDeterminant(void) 
 {
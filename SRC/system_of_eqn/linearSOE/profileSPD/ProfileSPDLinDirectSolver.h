@@ -40,6 +40,7 @@
 #define ProfileSPDLinDirectSolver_h
 
 #include "ProfileSPDLinSolver.h"
+#include <vector>
 
 class ProfileSPDLinSOE;
 
@@ -67,6 +68,13 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
     double **topRowPtr, *invD;
     
   private:
+    // blocked U^t D U factorization; the update of a panel of columns by
+    // the columns to its left is done with level 3 BLAS when the envelope
+    // above the panel is dense enough, otherwise column by column
+    int factorPanels(void);
+    int factorColumn(int i);
+
+    std::vector<double> work;
 
 };
 
@@ -32,6 +32,7 @@
 #include <ProfileSPDLinSOE.h>
 #include <ProfileSPDLinSolver.h>
 #include <Matrix.h>
+#include <MemoryReport.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -489,6 +490,23 @@ ProfileSPDLinSOE::setB(const Vector &v, double fact)
     return 0;
 }
 
+int 
+ProfileSPDLinSOE::addDiagA(const Vector &diag, double fact)
+{
+  // check for a quick return 
+  if (fact == 0.0)  return 0;
+
+  if (diag.Size() != size) {
+    opserr << "ProfileSPDLinSOE::addDiagA() - diag size not equal to n\n";
+    return -1;
+  }
+
+  for (int i=0; i<size; i++)
+    A[iDiagLoc[i]-1] += diag(i) * fact; // -1 as fortran indexing
+
+  return 0;
+}
+
 void 
 ProfileSPDLinSOE::zeroA(void)
 {
@@ -585,3 +603,11 @@ ProfileSPDLinSOE::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theB
 {
     return 0;
 }
+
+void
+ProfileSPDLinSOE::reportMemory(MemoryReport &theReport)
+{
+  double bytes = sizeof(ProfileSPDLinSOE) + Asize*sizeof(double)
+    + Bsize*(2*sizeof(double) + sizeof(int)) + 2*sizeof(Vector);
+  theReport.add("system", "ProfileSPDLinSOE", bytes);
+}
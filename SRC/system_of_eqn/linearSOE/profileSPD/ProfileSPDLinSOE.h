@@ -38,6 +38,7 @@
 #include <LinearSOE.h>
 #include <Vector.h>
 class ProfileSPDLinSolver;
+class MemoryReport;
 
 class ProfileSPDLinSOE : public LinearSOE
 {
@@ -53,6 +54,7 @@ class ProfileSPDLinSOE : public LinearSOE
     virtual int setSize(Graph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
+    virtual int addDiagA(const Vector &diag, double fact = 1.0);
 
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);
@@ -70,6 +72,7 @@ class ProfileSPDLinSOE : public LinearSOE
     virtual int setProfileSPDSolver(ProfileSPDLinSolver &newSolver);    
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    void reportMemory(MemoryReport &theReport);
 
     friend class ProfileSPDLinSolver;    
     friend class ProfileSPDLinDirectSolver;
@@ -35,6 +35,7 @@
 #include <SparseGenColLinSOE.h>
 #include <SparseGenColLinSolver.h>
 #include <Matrix.h>
+#include <MemoryReport.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -526,3 +527,12 @@ SparseGenColLinSOE::recvSelf(int cTag, Channel &theChannel,
     return 0;
 }
 
+
+void
+SparseGenColLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // A and rowA hold the nonzeros, colStartA the start of each column
+  double bytes = sizeof(SparseGenColLinSOE) + Asize*(sizeof(double) + sizeof(int))
+    + Bsize*2*sizeof(double) + (Bsize+1)*sizeof(int) + 2*sizeof(Vector);
+  theReport.add("system", "SparseGenColLinSOE", bytes);
+}
@@ -40,6 +40,7 @@
 #include <Vector.h>
 
 class SparseGenColLinSolver;
+class MemoryReport;
 
 class SparseGenColLinSOE : public LinearSOE
 {
@@ -72,6 +73,7 @@ class SparseGenColLinSOE : public LinearSOE
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+    void reportMemory(MemoryReport &theReport);
 #ifdef _PARALLEL_PROCESSING
     friend class SuperLU;    
     friend class ThreadedSuperLU;        
@@ -30,6 +30,7 @@
 #include <SparseGenRowLinSOE.h>
 #include <SparseGenRowLinSolver.h>
 #include <Matrix.h>
+#include <MemoryReport.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -488,3 +489,12 @@ SparseGenRowLinSOE::recvSelf(int cTag, Channel &theChannel,
     return 0;
 }
 
+
+void
+SparseGenRowLinSOE::reportMemory(MemoryReport &theReport)
+{
+  // A and colA hold the nonzeros, rowStartA the start of each row
+  double bytes = sizeof(SparseGenRowLinSOE) + Asize*(sizeof(double) + sizeof(int))
+    + Bsize*2*sizeof(double) + (Bsize+1)*sizeof(int) + 2*sizeof(Vector);
+  theReport.add("system", "SparseGenRowLinSOE", bytes);
+}
@@ -40,6 +40,7 @@
 #include <Vector.h>
 
 class SparseGenRowLinSolver;
+class MemoryReport;
 
 class SparseGenRowLinSOE : public LinearSOE
 {
@@ -67,6 +68,7 @@ class SparseGenRowLinSOE : public LinearSOE
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+    void reportMemory(MemoryReport &theReport);
     friend class PetscSparseSeqSolver;    
     friend class CulaSparseSolverS4;    
     friend class CulaSparseSolverS5;    
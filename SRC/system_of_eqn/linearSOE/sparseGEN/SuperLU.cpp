@@ -38,6 +38,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <DataFileStream.h>
+#include <MemoryReport.h>
 #include <iostream>
 #include <elementAPI.h>
 #include <string>
@@ -370,3 +371,21 @@ SuperLU::recvSelf(int ctag,
 
 
 
+
+void
+SuperLU::reportMemory(MemoryReport &theReport)
+{
+  double bytes = sizeof(SuperLU) + 3*sizePerm*sizeof(int);
+
+  // the supernodal L and the column compressed U, once factored
+  if (L.ncol != 0) {
+    int n = L.ncol;
+    SCformat *Lstore = (SCformat *)L.Store;
+    NCformat *Ustore = (NCformat *)U.Store;
+    bytes += Lstore->nnz*sizeof(double) + Lstore->rowind_colptr[n]*sizeof(int)
+      + (4*n + 3)*sizeof(int);
+    bytes += Ustore->nnz*(sizeof(double) + sizeof(int)) + (n + 1)*sizeof(int);
+  }
+
+  theReport.add("solver", "SuperLU", bytes);
+}
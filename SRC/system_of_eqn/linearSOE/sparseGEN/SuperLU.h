@@ -63,6 +63,7 @@ class SuperLU : public SparseGenColLinSolver
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+    void reportMemory(MemoryReport &theReport);
     
   protected:
 
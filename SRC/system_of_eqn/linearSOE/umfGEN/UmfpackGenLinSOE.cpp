@@ -36,6 +36,7 @@
 #include <UmfpackGenLinSOE.h>
 #include <UmfpackGenLinSolver.h>
 #include <Matrix.h>
+#include <MemoryReport.h>
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
@@ -353,3 +354,11 @@ UmfpackGenLinSOE::recvSelf(int cTag, Channel &theChannel,
 {
     return 0;
 }
+
+void
+UmfpackGenLinSOE::reportMemory(MemoryReport &theReport)
+{
+  double bytes = sizeof(UmfpackGenLinSOE) + (X.Size() + B.Size())*sizeof(double)
+    + (Ap.capacity() + Ai.capacity())*sizeof(int) + Ax.capacity()*sizeof(double);
+  theReport.add("system", "UmfpackGenLinSOE", bytes);
+}
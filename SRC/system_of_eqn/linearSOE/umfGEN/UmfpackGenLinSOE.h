@@ -40,6 +40,7 @@
 #include <vector>
 
 class UmfpackGenLinSolver;
+class MemoryReport;
 
 class UmfpackGenLinSOE : public LinearSOE
 {
@@ -69,6 +70,7 @@ public:
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker); 
+    void reportMemory(MemoryReport &theReport);
 
     friend class UmfpackGenLinSolver;
 
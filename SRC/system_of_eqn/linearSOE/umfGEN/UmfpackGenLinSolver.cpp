@@ -37,6 +37,7 @@
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <MemoryReport.h>
 
 void* OPS_UmfpackGenLinSolver()
 {
@@ -159,3 +160,15 @@ UmfpackGenLinSolver::recvSelf(int ctag,
     return 0;
 }
 
+
+void
+UmfpackGenLinSolver::reportMemory(MemoryReport &theReport)
+{
+  // only the symbolic factorization is kept, the numeric one is freed
+  // after each solve; its peak size is in Info[UMFPACK_NUMERIC_SIZE]
+  double bytes = sizeof(UmfpackGenLinSolver);
+  if (Symbolic != 0)
+    bytes += Info[UMFPACK_SYMBOLIC_SIZE]*Info[UMFPACK_SIZE_OF_UNIT];
+
+  theReport.add("solver", "UmfpackGenLinSolver", bytes);
+}
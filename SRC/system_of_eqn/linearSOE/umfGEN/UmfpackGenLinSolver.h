@@ -39,6 +39,7 @@
 #include "../../../../OTHER/UMFPACK/umfpack.h"
 
 class UmfpackGenLinSOE;
+class MemoryReport;
 
 class UmfpackGenLinSolver : public LinearSOESolver
 {
@@ -54,6 +55,7 @@ class UmfpackGenLinSolver : public LinearSOESolver
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);    
+    void reportMemory(MemoryReport &theReport);
     
   protected:
 
@@ -113,6 +113,7 @@ extern "C" int         OPS_ResetInputNoBuilder(ClientData clientData, Tcl_Interp
 
 #include <Information.h>
 #include <Element.h>
+#include <SectionForceDeformation.h>
 #include <Node.h>
 #include <ElementIter.h>
 #include <NodeIter.h>
@@ -228,6 +229,7 @@ extern void *OPS_ExplicitDifference(void);
 extern void *OPS_CentralDifference(void);
 extern void *OPS_CentralDifferenceAlternative(void);
 extern void *OPS_CentralDifferenceNoDamping(void);
+extern void *OPS_ModalSuperposition(void);
 extern void *OPS_Collocation(void);
 extern void *OPS_CollocationHSFixedNumIter(void);
 extern void *OPS_CollocationHSIncrLimit(void);
@@ -259,6 +261,7 @@ extern void *OPS_WilsonTheta(void);
 extern int OPS_DomainModalProperties(void);
 extern int OPS_ResponseSpectrumAnalysis(void);
 extern int OPS_sdfResponse(void);
+extern int OPS_sdfSpectrum(void);
 
 extern void OPS_SetReliabilityDomain(ReliabilityDomain *);
 
@@ -877,6 +880,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "analyze", &analyzeModel, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "analyzeLoadCases", &analyzeLoadCases, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "print", &printModel, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "printModel", &printModel, 
@@ -1066,6 +1071,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 
     Tcl_CreateCommand(interp, "sdfResponse", &sdfResponse, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+    Tcl_CreateCommand(interp, "sdfSpectrum", &sdfSpectrum, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
 
     Tcl_CreateCommand(interp, "sectionForce", &sectionForce, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
@@ -1107,6 +1114,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
     Tcl_CreateCommand(interp, "systemSize", &systemSize, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+    Tcl_CreateCommand(interp, "sectionThreads", &sectionThreads, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
     Tcl_CreateCommand(interp, "version", &version, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
 
@@ -2034,6 +2043,57 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
 
 }
 
+//
+// command invoked to run a linear static step for each of the given
+// load patterns on its own, factoring the tangent only once
+//
+int 
+analyzeLoadCases(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (theStaticAnalysis == 0) {
+    opserr << "WARNING analyzeLoadCases - no static analysis has been specified\n";
+    return TCL_ERROR;
+  }
+
+  bool flush = true;
+  int numTags = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-noFlush") == 0)
+      flush = false;
+    else
+      numTags++;
+  }
+
+  if (numTags == 0) {
+    opserr << "WARNING insufficient args: analyzeLoadCases patternTag1 patternTag2 ... <-noFlush>\n";
+    return TCL_ERROR;
+  }
+
+  ID patternTags(numTags);
+  int loc = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-noFlush") == 0)
+      continue;
+    int tag;
+    if (Tcl_GetInt(interp, argv[i], &tag) != TCL_OK) {
+      opserr << "WARNING analyzeLoadCases - invalid pattern tag " << argv[i] << endln;
+      return TCL_ERROR;
+    }
+    patternTags(loc++) = tag;
+  }
+
+  int result = theStaticAnalysis->analyzeLoadCases(patternTags, flush);
+  if (result < 0) {
+    opserr << "OpenSees > analyzeLoadCases failed, returned: " << result << " error flag\n";
+  }
+
+  char buffer [10];
+  sprintf(buffer,"%d", result);
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
 int 
 printElement(ClientData clientData, Tcl_Interp *interp, int argc, 
 	     TCL_Char **argv, OPS_Stream &output);
@@ -5367,6 +5427,13 @@ specifyIntegrator(ClientData clientData, Tcl_Interp *interp, int argc,
     if (theTransientAnalysis != 0)
       theTransientAnalysis->setIntegrator(*theTransientIntegrator);
   }  
+
+  else if (strcmp(argv[1],"ModalSuperposition") == 0) {
+    theTransientIntegrator = (TransientIntegrator *)OPS_ModalSuperposition();
+    
+    if (theTransientAnalysis != 0)
+      theTransientAnalysis->setIntegrator(*theTransientIntegrator);
+  }
   
   else if (strcmp(argv[1], "Explicitdifference") == 0) {
   theTransientIntegrator = new ExplicitDifference();
@@ -9411,6 +9478,15 @@ sdfResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv
   return TCL_OK;
 }
 
+int
+sdfSpectrum(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+  if (OPS_sdfSpectrum() < 0)
+    return TCL_ERROR;
+  return TCL_OK;
+}
+
 int 
 opsBarrier(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -10121,6 +10197,32 @@ numIter(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   return TCL_OK;
 }
 
+// sectionThreads $numThreads
+// the sections of a force-based beam are set on numThreads threads
+int
+sectionThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING: need sectionThreads numThreads\n";
+    return TCL_ERROR;
+  }
+
+  int numThreads;
+  if (Tcl_GetInt(interp, argv[1], &numThreads) != TCL_OK) {
+    opserr << "WARNING: invalid numThreads -- sectionThreads\n";
+    return TCL_ERROR;
+  }
+
+#ifndef _OPENMP
+  if (numThreads > 1)
+    opserr << "WARNING: built without OpenMP, sections are set on one thread -- sectionThreads\n";
+#endif
+
+  SectionForceDeformation::setNumBatchThreads(numThreads);
+
+  return TCL_OK;
+}
+
 int
 elementActivate(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
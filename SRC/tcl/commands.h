@@ -86,6 +86,9 @@ buildModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 int 
 analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+analyzeLoadCases(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 printModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
@@ -253,6 +256,9 @@ getParamValue(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **ar
 int 
 sdfResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+sdfSpectrum(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 // AddingSensitivity:BEGIN /////////////////////////////////////////////////
 
 
@@ -382,6 +388,9 @@ numIter(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
 systemSize(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+sectionThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int
 elementActivate(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int
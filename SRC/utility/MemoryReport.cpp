@@ -0,0 +1,164 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of MemoryReport.
+
+#include <MemoryReport.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <stdio.h>
+
+MemoryReport::MemoryReport()
+{
+
+}
+
+
+// add():
+//      an object that does not know its size adds 0 bytes, it is then
+//      counted but not sized.
+void
+MemoryReport::add(const char *subsystem, const char *className,
+		  double numBytes, int count)
+{
+  Entry &theEntry = theSubsystems[subsystem][className];
+  theEntry.count += count;
+  if (numBytes > 0.0)
+    theEntry.bytes += numBytes;
+  else
+    theEntry.numUnknown += count;
+}
+
+
+double
+MemoryReport::getBytes(const char *subsystem) const
+{
+  std::map<std::string, ClassEntries>::const_iterator theSubsystem = theSubsystems.find(subsystem);
+  if (theSubsystem == theSubsystems.end())
+    return 0.0;
+
+  double bytes = 0.0;
+  const ClassEntries &theClasses = theSubsystem->second;
+  for (ClassEntries::const_iterator it = theClasses.begin(); it != theClasses.end(); it++)
+    bytes += it->second.bytes;
+
+  return bytes;
+}
+
+
+double
+MemoryReport::getTotal(void) const
+{
+  double bytes = 0.0;
+  std::map<std::string, ClassEntries>::const_iterator it;
+  for (it = theSubsystems.begin(); it != theSubsystems.end(); it++)
+    bytes += this->getBytes(it->first.c_str());
+
+  return bytes;
+}
+
+
+void
+MemoryReport::getSubsystems(std::vector<std::string> &names) const
+{
+  names.clear();
+  std::map<std::string, ClassEntries>::const_iterator it;
+  for (it = theSubsystems.begin(); it != theSubsystems.end(); it++)
+    names.push_back(it->first);
+}
+
+
+void
+MemoryReport::Print(OPS_Stream &s, int flag)
+{
+  const double MB = 1024.0*1024.0;
+  char line[256];
+
+  snprintf(line, 256, "%-40s %10s %12s %12s\n", "subsystem / class", "objects", "total (MB)", "bytes/object");
+  s << line;
+
+  bool notSized = false;
+  std::map<std::string, ClassEntries>::const_iterator it;
+  for (it = theSubsystems.begin(); it != theSubsystems.end(); it++) {
+    const ClassEntries &theClasses = it->second;
+    long count = 0;
+    for (ClassEntries::const_iterator c = theClasses.begin(); c != theClasses.end(); c++)
+      count += c->second.count;
+
+    snprintf(line, 256, "%-40s %10ld %12.3f\n", it->first.c_str(), count,
+	     this->getBytes(it->first.c_str())/MB);
+    s << line;
+
+    if (flag == 0)
+      continue;
+
+    for (ClassEntries::const_iterator c = theClasses.begin(); c != theClasses.end(); c++) {
+      const Entry &theEntry = c->second;
+      if (theEntry.numUnknown > 0)
+	notSized = true;
+      int numSized = theEntry.count - theEntry.numUnknown;
+      if (numSized > 0)
+	snprintf(line, 256, "  %-38s %10d %12.3f %12.0f", c->first.c_str(), theEntry.count,
+		 theEntry.bytes/MB, theEntry.bytes/numSized);
+      else
+	snprintf(line, 256, "  %-38s %10d %12s %12s", c->first.c_str(), theEntry.count,
+		 "-", "-");
+      s << line;
+      if (theEntry.numUnknown > 0 && numSized > 0)
+	s << "  (" << theEntry.numUnknown << " not sized)";
+      s << endln;
+    }
+  }
+
+  snprintf(line, 256, "%-40s %10s %12.3f\n", "total", "", this->getTotal()/MB);
+  s << line;
+
+  // an object that is not sized does not report what it holds either
+  if (notSized == true)
+    s << "classes not sized are only counted; the sections and materials they hold are not in the report\n";
+}
+
+
+double
+MemoryReport::getBytes(const Vector *theVector)
+{
+  if (theVector == 0)
+    return 0.0;
+
+  return sizeof(Vector) + theVector->Size()*sizeof(double);
+}
+
+
+double
+MemoryReport::getBytes(const Matrix *theMatrix)
+{
+  if (theMatrix == 0)
+    return 0.0;
+
+  return sizeof(Matrix) + theMatrix->noRows()*theMatrix->noCols()*sizeof(double);
+}
+
+
+double
+MemoryReport::getBytes(const ID &theID)
+{
+  return theID.Size()*sizeof(int);
+}
@@ -0,0 +1,73 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for MemoryReport.
+// A MemoryReport collects the number of bytes held by the objects of a
+// model and an analysis, by subsystem (nodes, elements, materials,
+// analysis model, system of equations, solver) and by class, so that
+// it can be seen which part of a model fills the memory. The objects
+// add themselves to the report through their reportMemory() methods;
+// a class that does not know its size is only counted, and neither are
+// the sections and materials it holds, which is noted when the report
+// is printed in detail.
+
+#ifndef MemoryReport_h
+#define MemoryReport_h
+
+#include <OPS_Globals.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Vector;
+class Matrix;
+class ID;
+
+class MemoryReport
+{
+  public:
+    MemoryReport();
+
+    void add(const char *subsystem, const char *className,
+	     double numBytes, int count = 1);
+
+    double getBytes(const char *subsystem) const;
+    double getTotal(void) const;
+    void getSubsystems(std::vector<std::string> &names) const;
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+    // bytes held by the data of a Vector, Matrix or ID (0 if none)
+    static double getBytes(const Vector *theVector);
+    static double getBytes(const Matrix *theMatrix);
+    static double getBytes(const ID &theID);
+
+  private:
+    struct Entry {
+      int count;
+      int numUnknown;       // objects counted without their size
+      double bytes;
+    };
+    typedef std::map<std::string, Entry> ClassEntries;
+
+    std::map<std::string, ClassEntries> theSubsystems;
+};
+
+#endif
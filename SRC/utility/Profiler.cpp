@@ -0,0 +1,341 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of Profiler.
+
+#include <Profiler.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <string.h>
+#include <stdio.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// upper bound on the number of intervals kept for the trace
+#define PROFILER_MAX_EVENTS 2000000
+
+namespace {
+
+  struct ProfileNode {
+    const char *key;      // pointer the phase was last entered with
+    std::string name;
+    int parent;
+    std::vector<int> children;
+    long calls;
+    double total, min, max;
+  };
+
+  struct ProfileEvent {
+    int node;
+    double start, duration;
+  };
+
+  struct ProfileFrame {
+    int node;
+    double start;
+  };
+
+  typedef std::chrono::steady_clock ProfileClock;
+
+  std::vector<ProfileNode> theNodes;
+  std::vector<ProfileFrame> theStack;
+  std::vector<ProfileEvent> theEvents;
+  std::vector<std::pair<std::string, double> > theMemory;
+  bool tracing = false;
+  bool eventsDropped = false;
+  ProfileClock::time_point epoch = ProfileClock::now();
+
+  double
+  now(void)
+  {
+    return std::chrono::duration<double>(ProfileClock::now() - epoch).count();
+  }
+
+  void
+  addRoot(void)
+  {
+    ProfileNode root;
+    root.key = 0;
+    root.name = "root";
+    root.parent = -1;
+    root.calls = 0;
+    root.total = root.min = root.max = 0.0;
+    theNodes.push_back(root);
+  }
+
+  bool
+  onMainThread(void)
+  {
+#ifdef _OPENMP
+    return omp_get_thread_num() == 0;
+#else
+    return true;
+#endif
+  }
+
+  void
+  printNode(OPS_Stream &s, int n, int depth, double parentTotal)
+  {
+    const ProfileNode &node = theNodes[n];
+    char line[256];
+    double percent = (parentTotal > 0.0) ? 100.0*node.total/parentTotal : 100.0;
+    snprintf(line, 256, "%*s%-*s %10ld %12.6f %12.6f %6.1f%%\n",
+	     2*depth, "", 40-2*depth > 0 ? 40-2*depth : 1, node.name.c_str(),
+	     node.calls, node.total, node.calls > 0 ? node.total/node.calls : 0.0,
+	     percent);
+    s << line;
+    for (size_t i = 0; i < node.children.size(); i++)
+      printNode(s, node.children[i], depth+1, node.total);
+  }
+
+  void
+  writeName(FILE *fp, const char *name)
+  {
+    fputc('"', fp);
+    for (const char *c = name; *c != 0; c++) {
+      if (*c == '"' || *c == '\\')
+	fputc('\\', fp);
+      fputc(*c, fp);
+    }
+    fputc('"', fp);
+  }
+
+  void
+  writeNode(FILE *fp, int n, int depth)
+  {
+    const ProfileNode &node = theNodes[n];
+    fprintf(fp, "%*s{\"name\": ", 2*depth, "");
+    writeName(fp, node.name.c_str());
+    fprintf(fp, ", \"calls\": %ld, \"total\": %.9g, \"mean\": %.9g, \"min\": %.9g, \"max\": %.9g",
+	    node.calls, node.total, node.calls > 0 ? node.total/node.calls : 0.0,
+	    node.min, node.max);
+    if (node.children.empty() == false) {
+      fprintf(fp, ", \"children\": [\n");
+      for (size_t i = 0; i < node.children.size(); i++) {
+	writeNode(fp, node.children[i], depth+1);
+	fprintf(fp, (i+1 < node.children.size()) ? ",\n" : "\n");
+      }
+      fprintf(fp, "%*s]", 2*depth, "");
+    }
+    fprintf(fp, "}");
+  }
+}
+
+bool Profiler::enabled = false;
+
+void
+Profiler::setEnabled(bool onOff)
+{
+  if (theNodes.empty())
+    addRoot();
+  enabled = onOff;
+}
+
+void
+Profiler::setTracing(bool onOff)
+{
+  tracing = onOff;
+}
+
+void
+Profiler::enter(const char *name)
+{
+  if (onMainThread() == false)
+    return;
+
+  if (theNodes.empty())
+    addRoot();
+
+  int parent = theStack.empty() ? 0 : theStack.back().node;
+
+  // find the child of the current phase with this name
+  int child = -1;
+  std::vector<int> &children = theNodes[parent].children;
+  for (size_t i = 0; i < children.size(); i++) {
+    ProfileNode &node = theNodes[children[i]];
+    if (node.key == name || strcmp(node.name.c_str(), name) == 0) {
+      node.key = name;
+      child = children[i];
+      break;
+    }
+  }
+
+  if (child == -1) {
+    ProfileNode node;
+    node.key = name;
+    node.name = name;
+    node.parent = parent;
+    node.calls = 0;
+    node.total = node.max = 0.0;
+    node.min = 1.0e300;
+    child = (int)theNodes.size();
+    theNodes.push_back(node);
+    theNodes[parent].children.push_back(child);
+  }
+
+  ProfileFrame frame;
+  frame.node = child;
+  frame.start = now();
+  theStack.push_back(frame);
+}
+
+void
+Profiler::leave(void)
+{
+  if (onMainThread() == false || theStack.empty())
+    return;
+
+  ProfileFrame frame = theStack.back();
+  theStack.pop_back();
+
+  double duration = now() - frame.start;
+  ProfileNode &node = theNodes[frame.node];
+  node.calls++;
+  node.total += duration;
+  if (duration < node.min)
+    node.min = duration;
+  if (duration > node.max)
+    node.max = duration;
+
+  if (tracing == true) {
+    if (theEvents.size() < PROFILER_MAX_EVENTS) {
+      ProfileEvent event;
+      event.node = frame.node;
+      event.start = frame.start;
+      event.duration = duration;
+      theEvents.push_back(event);
+    } else if (eventsDropped == false) {
+      opserr << "WARNING Profiler - trace is full, further intervals are not kept\n";
+      eventsDropped = true;
+    }
+  }
+}
+
+void
+Profiler::setMemory(const char *subsystem, double bytes)
+{
+  for (size_t i = 0; i < theMemory.size(); i++)
+    if (theMemory[i].first == subsystem) {
+      theMemory[i].second = bytes;
+      return;
+    }
+  theMemory.push_back(std::make_pair(std::string(subsystem), bytes));
+}
+
+void
+Profiler::reset(void)
+{
+  theNodes.clear();
+  theStack.clear();
+  theEvents.clear();
+  theMemory.clear();
+  eventsDropped = false;
+  epoch = ProfileClock::now();
+  addRoot();
+}
+
+void
+Profiler::Print(OPS_Stream &s)
+{
+  if (theNodes.empty())
+    return;
+
+  char line[256];
+  snprintf(line, 256, "%-40s %10s %12s %12s %7s\n", "phase", "calls", "total (s)", "mean (s)", "parent");
+  s << line;
+
+  // the root is not timed itself; its children are the top level phases
+  const ProfileNode &root = theNodes[0];
+  double total = 0.0;
+  for (size_t i = 0; i < root.children.size(); i++)
+    total += theNodes[root.children[i]].total;
+  for (size_t i = 0; i < root.children.size(); i++)
+    printNode(s, root.children[i], 0, total);
+
+  if (theMemory.empty() == false) {
+    snprintf(line, 256, "\n%-40s %12s\n", "memory", "MB");
+    s << line;
+    for (size_t i = 0; i < theMemory.size(); i++) {
+      snprintf(line, 256, "%-40s %12.3f\n", theMemory[i].first.c_str(), theMemory[i].second/1048576.0);
+      s << line;
+    }
+  }
+}
+
+int
+Profiler::writeJSON(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "w");
+  if (fp == 0) {
+    opserr << "WARNING Profiler::writeJSON() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  fprintf(fp, "{\"phases\": [\n");
+  if (theNodes.empty() == false) {
+    const ProfileNode &root = theNodes[0];
+    for (size_t i = 0; i < root.children.size(); i++) {
+      writeNode(fp, root.children[i], 1);
+      fprintf(fp, (i+1 < root.children.size()) ? ",\n" : "\n");
+    }
+  }
+  fprintf(fp, "]");
+  if (theMemory.empty() == false) {
+    fprintf(fp, ",\n\"memory\": {");
+    for (size_t i = 0; i < theMemory.size(); i++) {
+      fprintf(fp, (i > 0) ? ", " : "");
+      writeName(fp, theMemory[i].first.c_str());
+      fprintf(fp, ": %.0f", theMemory[i].second);
+    }
+    fprintf(fp, "}");
+  }
+  fprintf(fp, "}\n");
+
+  fclose(fp);
+  return 0;
+}
+
+int
+Profiler::writeTrace(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "w");
+  if (fp == 0) {
+    opserr << "WARNING Profiler::writeTrace() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  // complete events, times in microseconds
+  fprintf(fp, "{\"traceEvents\": [\n");
+  for (size_t i = 0; i < theEvents.size(); i++) {
+    const ProfileEvent &event = theEvents[i];
+    fprintf(fp, "{\"name\": ");
+    writeName(fp, theNodes[event.node].name.c_str());
+    fprintf(fp, ", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": %.3f, \"dur\": %.3f}%s\n",
+	    1.0e6*event.start, 1.0e6*event.duration,
+	    (i+1 < theEvents.size()) ? "," : "");
+  }
+  fprintf(fp, "], \"displayTimeUnit\": \"ms\"}\n");
+
+  fclose(fp);
+  return 0;
+}
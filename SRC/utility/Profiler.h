@@ -0,0 +1,82 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for Profiler.
+// Profiler accumulates the wall clock time spent in nested phases of
+// an analysis (a step, Domain::update, formTangent, an element class,
+// ...) into a call tree, keyed by the path of phase names from the
+// root. Each node of the tree keeps the number of calls and the total,
+// minimum and maximum time, so the time per step of any phase follows
+// from the counts. When tracing is on, the individual intervals are
+// also kept so they can be written out in the Chrome trace format.
+//
+// Phases are marked with OPS_PROFILE_SCOPE(name), which only compiles
+// to a timer when the code is built with _PROFILER; the timers do
+// nothing until the profiler has been enabled.
+//
+// The profiler also keeps the bytes last reported for each subsystem
+// by the memoryUsage command, which are written after the phases.
+
+#ifndef Profiler_h
+#define Profiler_h
+
+#include <OPS_Globals.h>
+
+class Profiler
+{
+  public:
+    static void setEnabled(bool onOff);
+    static bool isEnabled(void) {return enabled;};
+    static void setTracing(bool onOff);
+
+    static void enter(const char *name);
+    static void leave(void);
+    static void setMemory(const char *subsystem, double bytes);
+
+    static void reset(void);
+    static void Print(OPS_Stream &s);
+    static int writeJSON(const char *fileName);
+    static int writeTrace(const char *fileName);
+
+  private:
+    static bool enabled;
+};
+
+class ProfileScope
+{
+  public:
+    ProfileScope(const char *name) : active(Profiler::isEnabled())
+      {if (active) Profiler::enter(name);};
+    ~ProfileScope()
+      {if (active) Profiler::leave();};
+
+  private:
+    bool active;
+};
+
+#ifdef _PROFILER
+#define OPS_PROFILE_CONCAT_(a, b) a##b
+#define OPS_PROFILE_CONCAT(a, b) OPS_PROFILE_CONCAT_(a, b)
+#define OPS_PROFILE_SCOPE(name) ProfileScope OPS_PROFILE_CONCAT(opsProfileScope, __LINE__)(name)
+#else
+#define OPS_PROFILE_SCOPE(name)
+#endif
+
+#endif